@@ -78,13 +78,38 @@ void aes::registers()
 		addroundkey_ready_o.write(next_addroundkey_ready_o);
 		first_round_reg.write(next_first_round_reg.read());
 		addroundkey_start_i.write(next_addroundkey_start_i.read());
+
+		//Keep each round key as keysched produces it
+		if (keysched_ready_o.read())
+		{
+			round_key_ram[(int)addroundkey_round.read()] = keysched_new_key_o.read();
+			round_key_valid |= 1 << (int)addroundkey_round.read();
+		}
 	}
 }
 
+void aes::load_round_keys(const aes_uint128 keys[11])
+{
+	for (int i = 0; i < 11; i++)
+		round_key_ram[i] = keys[i];
+	round_key_valid = 0x7FE;
+}
+
+void aes::clear_round_keys()
+{
+	round_key_valid = 0;
+}
+
+//Rounds 1 to 10 are needed, round 0 uses key_i
+bool aes::round_keys_complete()
+{
+	return (round_key_valid & 0x7FE) == 0x7FE;
+}
+
 
 void aes::addroundkey()
 {
-	sc_biguint<128> data_var, round_data_var, round_key_var;
+	aes_uint128 data_var, round_data_var, round_key_var;
 
 	round_data_var = addroundkey_data_reg.read();
 	next_addroundkey_data_reg.write(addroundkey_data_reg.read());
@@ -110,6 +135,15 @@ void aes::addroundkey()
 		next_addroundkey_data_reg.write(round_data_var);
 		next_addroundkey_ready_o.write(1);
 	}
+	else if (addroundkey_start_i.read() && round.read() != 0 && use_round_keys_i.read())
+	{
+		//Round key already known, no key schedule needed
+		data_var = addroundkey_data_i.read();
+		round_key_var = round_key_ram[(int)round.read()];
+		round_data_var = round_key_var ^ data_var;
+		next_addroundkey_data_reg.write(round_data_var);
+		next_addroundkey_ready_o.write(1);
+	}
 	else if (addroundkey_start_i.read() && round.read() != 0)
 	{
 		keysched_last_key_i.write(key_i.read());
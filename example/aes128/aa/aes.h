@@ -59,6 +59,7 @@
 
 
 #include "systemc.h"
+#include "aes_uint128.h"
 //Include modules
 #include "subbytes.h"
 #include "mixcolum.h"
@@ -73,11 +74,13 @@ SC_MODULE(aes)
 
 	sc_in<bool> load_i;
 	sc_in<bool> decrypt_i;
-	sc_in<sc_biguint<128> > data_i;
-	sc_in<sc_biguint<128> > key_i;
+	//Take round keys from the round key RAM instead of keysched
+	sc_in<bool> use_round_keys_i;
+	sc_in<aes_uint128> data_i;
+	sc_in<aes_uint128> key_i;
 
 	sc_out<bool> ready_o;
-	sc_out<sc_biguint<128> > data_o;
+	sc_out<aes_uint128> data_o;
 
 	//Output registers
 	sc_signal<bool> next_ready_o;
@@ -85,8 +88,8 @@ SC_MODULE(aes)
 	//To key schedule module
 	sc_signal<bool> keysched_start_i;
 	sc_signal<sc_uint<4> > keysched_round_i;
-	sc_signal<sc_biguint<128> > keysched_last_key_i;
-	sc_signal<sc_biguint<128> > keysched_new_key_o;
+	sc_signal<aes_uint128> keysched_last_key_i;
+	sc_signal<aes_uint128> keysched_new_key_o;
 	sc_signal<bool> keysched_ready_o;
 	sc_signal<bool> keysched_sbox_access_o;
 	sc_signal<sc_uint<8> > keysched_sbox_data_o;
@@ -94,15 +97,15 @@ SC_MODULE(aes)
 
 	//From mixcolums
 	sc_signal<bool> mixcol_start_i;
-	sc_signal<sc_biguint<128> > mixcol_data_i;
+	sc_signal<aes_uint128> mixcol_data_i;
 	sc_signal<bool> mixcol_ready_o;
-	sc_signal<sc_biguint<128> > mixcol_data_o;
+	sc_signal<aes_uint128> mixcol_data_o;
 
 	//From subbytes
 	sc_signal<bool> subbytes_start_i;
-	sc_signal<sc_biguint<128> > subbytes_data_i;
+	sc_signal<aes_uint128> subbytes_data_i;
 	sc_signal<bool> subbytes_ready_o;
-	sc_signal<sc_biguint<128> > subbytes_data_o;
+	sc_signal<aes_uint128> subbytes_data_o;
 	sc_signal<sc_uint<8> > subbytes_sbox_data_o;
 	sc_signal<bool> subbytes_sbox_decrypt_o;
 
@@ -116,14 +119,22 @@ SC_MODULE(aes)
         enum state_t {IDLE, ROUNDS};
 	sc_signal<state_t> state, next_state;
 	
-	sc_signal<sc_biguint<128> > addroundkey_data_o, next_addroundkey_data_reg, addroundkey_data_reg;
-	sc_signal<sc_biguint<128> > addroundkey_data_i;
+	sc_signal<aes_uint128> addroundkey_data_o, next_addroundkey_data_reg, addroundkey_data_reg;
+	sc_signal<aes_uint128> addroundkey_data_i;
 	sc_signal<bool> addroundkey_ready_o, next_addroundkey_ready_o;
 	sc_signal<bool> addroundkey_start_i, next_addroundkey_start_i;
 	sc_signal<sc_uint<4> > addroundkey_round, next_addroundkey_round;
 
 	sc_signal<bool> first_round_reg, next_first_round_reg;
 
+	//Round key RAM, filled from keysched or loaded by the host
+	aes_uint128 round_key_ram[11];
+	unsigned int round_key_valid;
+
+	void load_round_keys(const aes_uint128 keys[11]);
+	void clear_round_keys();
+	bool round_keys_complete();
+
 	void registers();
 	void control();
 	void addroundkey();
@@ -138,6 +149,8 @@ SC_MODULE(aes)
 	SC_CTOR(aes)
 	{
 
+		round_key_valid = 0;
+
 		sbox1 = new sbox("sbox");
 		sub1 = new subbytes("subbytes");
 		mix1 = new mixcolum("mixcolum");
@@ -191,7 +204,7 @@ SC_MODULE(aes)
 
 		SC_METHOD(addroundkey);
 			sensitive << addroundkey_data_i << addroundkey_start_i << addroundkey_data_reg << addroundkey_round << keysched_new_key_o << keysched_ready_o;
-			sensitive << key_i << round;
+			sensitive << key_i << round << use_round_keys_i;
 
 		SC_METHOD(sbox_muxes);	
 			sensitive << keysched_sbox_access_o << keysched_sbox_decrypt_o << keysched_sbox_data_o << subbytes_sbox_decrypt_o << subbytes_sbox_data_o;
@@ -0,0 +1,19 @@
+/**
+ * MURAC Test Application - AES 128 bit cryptography, streaming
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <iostream>
+#include <systemc.h>
+#include "../../../framework/murac.h"
+
+using std::cout;
+using std::endl;
+
+extern int run_aes_stream_simulation(unsigned long int stack);
+
+MURAC_AA_EXECUTE(aes128_stream) {
+    cout << "[AA] Running AES stream AA simulation" << endl;
+    return run_aes_stream_simulation(stack);
+}
@@ -5,10 +5,16 @@
  */
 #define SC_INCLUDE_DYNAMIC_PROCESSES
 #include <iostream>
+#include <map>
+#include <string>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
 #include <systemc.h>
 #include "../../../framework/murac.h"
 
 #include "aes.h"
+#include "aes_tlm.h"
 
 //static aes_transactor *tr;
 //static adapter *ad1;
@@ -21,20 +27,22 @@ public:
     sc_signal<bool> reset;
     sc_signal<bool> do_load;
     sc_signal<bool> mode_decrypt;
-    sc_signal<sc_biguint<128> > data_in;
-    sc_signal<sc_biguint<128> > key;
-    sc_signal<sc_biguint<128> > data_out;
+    sc_signal<bool> use_round_keys;
+    sc_signal<aes_uint128> data_in;
+    sc_signal<aes_uint128> key;
+    sc_signal<aes_uint128> data_out;
     aes *crypt_obj;
 
     sc_signal<bool> ready;
 
-    aes_invoker(): aes_clock("aes_clock", 1, SC_MS) {
+    aes_invoker(const sc_time &period): aes_clock("aes_clock", period) {
 
         crypt_obj = new aes("aes");
         crypt_obj->clk(aes_clock);
         crypt_obj->reset(reset);
         crypt_obj->load_i(do_load);
         crypt_obj->decrypt_i(mode_decrypt);
+        crypt_obj->use_round_keys_i(use_round_keys);
         crypt_obj->data_i(data_in);
         crypt_obj->key_i(key);
         crypt_obj->data_o(data_out);
@@ -42,13 +50,98 @@ public:
     }
 };
 
-static aes_invoker *invoker;
+/* Core model, selected at init from the AES128_MODEL environment variable */
+enum aes_model_t {
+    AES_MODEL_RTL,      /* translated RTL aes module (default) */
+    AES_MODEL_TLM,      /* functional model, time advanced by the RTL latency */
+    AES_MODEL_VERIFY    /* RTL, checked block by block against the functional model */
+};
+
+static aes_model_t model = AES_MODEL_RTL;
+static aes_invoker *invoker = 0;
+static aes_tlm *tlm = 0;
+static sc_time clock_period;
 static BusInterface* bus;
+static bool core_reset = false;
+static bool fips_checked = false;
+
+/* Streaming modes, shared with pa/aes128_stream.cpp */
+#define AES_MODE_ECB     0
+#define AES_MODE_CTR     1
+#define AES_MODE_CBC     2
+#define AES_MODE_DECRYPT 0x80   /* or'd with ECB or CBC */
+
+/*
+ * Round keys of recently used keys. On a hit they are loaded into the
+ * core's round key RAM and keysched is skipped for every block; on a miss
+ * they are captured from keysched during the first block. When the cache
+ * is full, the least recently used key is evicted.
+ */
+#define AES_KEY_CACHE_SIZE 64
+
+struct round_key_entry {
+    aes_uint128 keys[11];
+    unsigned long long last_use;
+};
+
+static std::map<std::string, round_key_entry> key_cache;
+static unsigned long long key_cache_uses = 0;
+static bool keys_cached = false;
+static unsigned long long key_cache_hits = 0;
+static unsigned long long key_cache_misses = 0;
+static unsigned long long key_cache_blocks = 0;
+
+/* Bytes moved per bus burst when streaming */
+#define AES_STREAM_CHUNK 4096
+
+/* Byte 0 of a block is the most significant byte of the core's data bus */
+static aes_uint128 bytes_to_128(const unsigned char *b) {
+    aes_uint128 v;
+    for (int i = 0; i < 16; i++) {
+        v.set_byte(i, b[i]);
+    }
+    return v;
+}
+
+static void bytes_from_128(const aes_uint128 &v, unsigned char *b) {
+    for (int i = 0; i < 16; i++) {
+        b[i] = v.byte(i);
+    }
+}
+
+static double wall_seconds(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
 
+static void print_block(const char *label, const unsigned char *b) {
+    printf("%s", label);
+    for (int i = 0; i < 16; i++) {
+        printf("%02x", b[i]);
+    }
+    printf("\n");
+}
 
 MURAC_AA_INIT(aes128) {
     ::bus = bus;
-    invoker = new aes_invoker();
+
+    const char *selected = getenv("AES128_MODEL");
+    if (selected && strcmp(selected, "tlm") == 0) {
+        model = AES_MODEL_TLM;
+    } else if (selected && strcmp(selected, "verify") == 0) {
+        model = AES_MODEL_VERIFY;
+    } else if (selected && strcmp(selected, "rtl") != 0) {
+        printf("Unknown AES128_MODEL '%s', using rtl\n", selected);
+    }
+
+    clock_period = sc_time(1, SC_MS);
+    if (model != AES_MODEL_RTL) {
+        tlm = new aes_tlm();
+    }
+    if (model != AES_MODEL_TLM) {
+        invoker = new aes_invoker(clock_period);
+    }
     return 0;
 }
 
@@ -56,28 +149,183 @@ void reset(void) {
     invoker->reset.write(0);
     wait(invoker->aes_clock.posedge_event());
     invoker->reset.write(1);
+    core_reset = true;
 }
 
-void encrypt(sc_biguint<128> k, sc_biguint<128> d) {
-    wait(invoker->aes_clock.posedge_event());
-    invoker->do_load.write(1);
+/* Load the next block as soon as the core is idle and wait for its result */
+static aes_uint128 rtl_block(const aes_uint128 &d) {
     invoker->data_in.write(d);
-    invoker->key.write(k);
-    invoker->mode_decrypt.write(0);
-    cout << "@" << sc_time_stamp() << " Loading data" << endl;
+    invoker->do_load.write(1);
     wait(invoker->aes_clock.posedge_event());
-    cout << "@" << sc_time_stamp() << " Encrypting data" << endl;
     invoker->do_load.write(0);
     wait(invoker->ready.posedge_event());
+    return invoker->data_out.read();
+}
+
+/* Bring the core out of reset if needed, present the key and look up its round keys */
+static void load_key(const unsigned char key[16]) {
+    std::map<std::string, round_key_entry>::iterator entry = key_cache.find(std::string((const char *) key, 16));
+
+    keys_cached = entry != key_cache.end();
+    if (keys_cached) {
+        entry->second.last_use = ++key_cache_uses;
+        key_cache_hits++;
+    } else {
+        key_cache_misses++;
+    }
+
+    if (invoker) {
+        if (!core_reset) {
+            reset();
+        }
+        invoker->key.write(bytes_to_128(key));
+        if (keys_cached) {
+            invoker->crypt_obj->load_round_keys(entry->second.keys);
+        } else {
+            invoker->crypt_obj->clear_round_keys();
+        }
+        invoker->use_round_keys.write(keys_cached);
+    }
+}
+
+/* Keep the round keys of the current key once the first block has produced them */
+static void cache_round_keys(const unsigned char key[16]) {
+    round_key_entry entry;
+
+    if (invoker) {
+        if (!invoker->crypt_obj->round_keys_complete()) {
+            return;
+        }
+        for (int i = 0; i < 11; i++) {
+            entry.keys[i] = invoker->crypt_obj->round_key_ram[i];
+        }
+        invoker->use_round_keys.write(1);
+    } else {
+        const uint32_t *schedule = tlm->schedule(key);
+        for (int i = 0; i < 11; i++) {
+            for (int j = 0; j < 4; j++) {
+                entry.keys[i].set_word(j, schedule[4*i + j]);
+            }
+        }
+    }
+
+    if (key_cache.size() >= AES_KEY_CACHE_SIZE) {
+        std::map<std::string, round_key_entry>::iterator lru = key_cache.begin();
+        for (std::map<std::string, round_key_entry>::iterator it = key_cache.begin(); it != key_cache.end(); ++it) {
+            if (it->second.last_use < lru->second.last_use) {
+                lru = it;
+            }
+        }
+        key_cache.erase(lru);
+    }
+    entry.last_use = ++key_cache_uses;
+    key_cache[std::string((const char *) key, 16)] = entry;
+    keys_cached = true;
+}
+
+static void print_key_cache_stats(void) {
+    printf("[AA] Round-key cache: %llu hits, %llu misses, %llu blocks used cached keys, %llu cycles saved\n",
+           key_cache_hits, key_cache_misses, key_cache_blocks,
+           key_cache_blocks * aes_tlm::keysched_cycles());
+}
+
+/*
+ * Encrypt or decrypt one block with the key given to load_key, issued on
+ * the current cycle. Returns the number of cycles taken, including the
+ * issue cycle.
+ */
+static int crypt_block(const unsigned char key[16], const unsigned char in[16], unsigned char out[16], bool decrypt) {
+    bool cached = keys_cached;
+    int cycles;
+
+    if (cached) {
+        key_cache_blocks++;
+    }
+
+    if (model == AES_MODEL_TLM) {
+        cycles = (decrypt ? tlm->decrypt(key, in, out, cached) : tlm->encrypt(key, in, out, cached)) + 1;
+        wait(cycles * clock_period);
+        if (!cached) {
+            cache_round_keys(key);
+        }
+        return cycles;
+    }
+
+    unsigned char expected[16];
+    int expected_cycles = 0;
+    if (model == AES_MODEL_VERIFY) {
+        expected_cycles = (decrypt ? tlm->decrypt(key, in, expected, cached) : tlm->encrypt(key, in, expected, cached)) + 1;
+    }
+
+    sc_time start = sc_time_stamp();
+    invoker->mode_decrypt.write(decrypt);
+    bytes_from_128(rtl_block(bytes_to_128(in)), out);
+    cycles = (int) ((sc_time_stamp() - start) / clock_period + 0.5);
+
+    if (!cached) {
+        cache_round_keys(key);
+    }
+
+    if (model == AES_MODEL_VERIFY) {
+        if (memcmp(out, expected, 16) != 0 || cycles != expected_cycles) {
+            printf("[AA] AES model mismatch: RTL %d cycles, TLM %d cycles\n", cycles, expected_cycles);
+            print_block("[AA]   RTL ", out);
+            print_block("[AA]   TLM ", expected);
+            return -1;
+        }
+    }
+    return cycles;
+}
+
+/*
+ * Run the FIPS-197 AES-128 vectors (Appendix B and C.1) through both
+ * models, checking results and latency and reporting the host speedup
+ */
+static int verify_fips197(void) {
+    static const unsigned char vectors[2][3][16] = {
+        { { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c },
+          { 0x32, 0x43, 0xf6, 0xa8, 0x88, 0x5a, 0x30, 0x8d, 0x31, 0x31, 0x98, 0xa2, 0xe0, 0x37, 0x07, 0x34 },
+          { 0x39, 0x25, 0x84, 0x1d, 0x02, 0xdc, 0x09, 0xfb, 0xdc, 0x11, 0x85, 0x97, 0x19, 0x6a, 0x0b, 0x32 } },
+        { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f },
+          { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff },
+          { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a } }
+    };
+    const int tlm_repeat = 10000;
+    int errors = 0;
+
+    for (int v = 0; v < 2; v++) {
+        unsigned char out[16];
+
+        double rtl_start = wall_seconds();
+        load_key(vectors[v][0]);
+        int cycles = crypt_block(vectors[v][0], vectors[v][1], out, false);
+        double rtl_wall = wall_seconds() - rtl_start;
+
+        if (cycles < 0 || memcmp(out, vectors[v][2], 16) != 0) {
+            print_block("[AA] FIPS-197 vector failed, got ", out);
+            errors++;
+            continue;
+        }
+
+        double tlm_start = wall_seconds();
+        for (int i = 0; i < tlm_repeat; i++) {
+            tlm->encrypt(vectors[v][0], vectors[v][1], out);
+        }
+        double tlm_wall = (wall_seconds() - tlm_start) / tlm_repeat;
+
+        printf("[AA] FIPS-197 vector %d passed: %d cycles, RTL %.6f s, TLM %.9f s, speedup %.0fx\n",
+               v, cycles, rtl_wall, tlm_wall, tlm_wall > 0 ? rtl_wall / tlm_wall : 0.0);
+    }
+    return errors ? -1 : 0;
 }
 
 int run_aes_simulation(unsigned long int stack) {
-    
+
     /* Read the stack */
     unsigned int variables[4];
-    printf("Reading addresses from bus at 0x%x\n", stack);
+    printf("Reading addresses from bus at 0x%lx\n", stack);
     if (bus->read(stack, (unsigned char*) variables, 4*sizeof(unsigned int))) {
-        printf("Error reading fom bus 0x%x\n", stack);
+        printf("Error reading fom bus 0x%lx\n", stack);
         return -1;
     }
     for (int i = 0; i < 4; i++) {
@@ -85,61 +333,190 @@ int run_aes_simulation(unsigned long int stack) {
     }
 
     /* Key */
-    char key_data[16];
-    if (bus->read(variables[0], (unsigned char*) key_data, 16)) {
+    unsigned char key_data[16];
+    if (bus->read(variables[0], key_data, 16)) {
         printf("Error reading fom bus 0x%x\n", variables[0]);
         return -1;
     }
 
     /* Input */
-    char input_data[16];
+    unsigned char input_data[16];
     printf("Reading 16 bytes from bus at 0x%x\n", variables[1]);
-    if (bus->read(variables[1], (unsigned char*) key_data, 16)) {
+    if (bus->read(variables[1], input_data, 16)) {
         printf("Error reading fom bus 0x%x\n", variables[1]);
         return -1;
     }
+    print_block("   Input  ", input_data);
 
-    for (int i = 0; i < 16; i++) {
-        printf(" 0x%x", (int) input_data[i] & 0xFF);
+    if (model == AES_MODEL_VERIFY && !fips_checked) {
+        fips_checked = true;
+        if (verify_fips197() < 0) {
+            return -1;
+        }
     }
-    printf("\n");
 
-    sc_biguint<128> test_key = ( 
-        *((unsigned int*) &key_data[0]),
-        *((unsigned int*) &key_data[4]),
-        *((unsigned int*) &key_data[8]),
-        *((unsigned int*) &key_data[12]) );
-    sc_biguint<128> test_data = ( 
-        *((unsigned int*) &input_data[0]),
-        *((unsigned int*) &input_data[4]),
-        *((unsigned int*) &input_data[8]),
-        *((unsigned int*) &input_data[12]) );
-    
     cout << "@" << sc_time_stamp() << " Running encrypt" << endl;
 
+    unsigned char output_data[16];
+    load_key(key_data);
+    if (crypt_block(key_data, input_data, output_data, false) < 0) {
+        return -1;
+    }
 
-
-    reset();
-    encrypt(test_key, test_data);
-    
     cout << "@" << sc_time_stamp() << " Writing result to memory" << endl;
+    print_block("   Output ", output_data);
 
-    sc_biguint<128> test_output = invoker->data_out.read();
-    char output_data[16];
+    /* Output */
+    if (bus->write(variables[2], output_data, 16)) {
+        printf("Error writing to bus 0x%x\n", variables[2]);
+        return -1;
+    }
 
-    *((unsigned int *) &output_data[0]) = test_output.range(0,31).to_uint();
-    *((unsigned int *) &output_data[4]) = test_output.range(32,63).to_uint();
-    *((unsigned int *) &output_data[8]) = test_output.range(64,95).to_uint();
-    *((unsigned int *) &output_data[12]) = test_output.range(96,127).to_uint();
+    /* Decrypt the result again if the caller asked for it */
+    if (variables[3]) {
+        unsigned char decrypt_data[16];
 
-    for (int i = 0; i < 16; i++) {
-        printf(" 0x%x", (int) output_data[i] & 0xFF);
+        cout << "@" << sc_time_stamp() << " Running decrypt" << endl;
+        if (crypt_block(key_data, output_data, decrypt_data, true) < 0) {
+            return -1;
+        }
+        print_block("   Decrypted ", decrypt_data);
+
+        if (bus->write(variables[3], decrypt_data, 16)) {
+            printf("Error writing to bus 0x%x\n", variables[3]);
+            return -1;
+        }
     }
-    printf("\n");
 
-    /* Output */
-    if (bus->write(variables[2], (unsigned char*) output_data, 16)) {
-        printf("Error writing to bus 0x%x\n", variables[2]);
+    print_key_cache_stats();
+    return 0;
+}
+
+/*
+ * Stream a buffer through the core
+ *
+ * stack[0] key, stack[1] input, stack[2] output, stack[3] length in bytes,
+ * stack[4] mode (AES_MODE_*, ECB and CBC may add AES_MODE_DECRYPT),
+ * stack[5] IV / initial counter block.
+ * The key is loaded once and blocks are issued back-to-back, without a
+ * reset between them. ECB and CBC need a whole number of blocks.
+ */
+int run_aes_stream_simulation(unsigned long int stack) {
+
+    unsigned int variables[6];
+    if (bus->read(stack, (unsigned char*) variables, 6*sizeof(unsigned int))) {
+        printf("Error reading fom bus 0x%lx\n", stack);
         return -1;
     }
-}
\ No newline at end of file
+
+    unsigned int length  = variables[3];
+    unsigned int mode    = variables[4] & ~AES_MODE_DECRYPT;
+    bool         decrypt = (variables[4] & AES_MODE_DECRYPT) != 0;
+    if (mode > AES_MODE_CBC || (mode == AES_MODE_CTR && decrypt) ||
+        (mode != AES_MODE_CTR && (length % 16) != 0)) {
+        printf("Invalid AES stream request: mode %u, length %u\n", mode, length);
+        return -1;
+    }
+
+    unsigned char key_data[16];
+    unsigned char chain[16];
+    if (bus->read(variables[0], key_data, 16) || bus->read(variables[5], chain, 16)) {
+        printf("Error reading key or IV from bus\n");
+        return -1;
+    }
+
+    if (model == AES_MODEL_VERIFY && !fips_checked) {
+        fips_checked = true;
+        if (verify_fips197() < 0) {
+            return -1;
+        }
+    }
+
+    double wall_start = wall_seconds();
+    sc_time sim_start = sc_time_stamp();
+
+    load_key(key_data);
+
+    unsigned char buffer[AES_STREAM_CHUNK];
+    unsigned long long blocks = 0;
+
+    for (unsigned int offset = 0; offset < length; offset += AES_STREAM_CHUNK) {
+        unsigned int chunk = length - offset < AES_STREAM_CHUNK ? length - offset : AES_STREAM_CHUNK;
+
+        if (bus->read(variables[1] + offset, buffer, chunk)) {
+            printf("Error reading fom bus 0x%x\n", variables[1] + offset);
+            return -1;
+        }
+
+        for (unsigned int i = 0; i < chunk; i += 16) {
+            unsigned char *block = &buffer[i];
+            unsigned int n = chunk - i < 16 ? chunk - i : 16;
+            unsigned char pad[16];
+            int status;
+
+            if (mode == AES_MODE_ECB) {
+                status = crypt_block(key_data, block, block, decrypt);
+            } else if (mode == AES_MODE_CBC && decrypt) {
+                status = crypt_block(key_data, block, pad, true);
+                for (int j = 0; j < 16; j++) {
+                    pad[j] ^= chain[j];
+                }
+                memcpy(chain, block, 16);
+                memcpy(block, pad, 16);
+            } else if (mode == AES_MODE_CBC) {
+                for (int j = 0; j < 16; j++) {
+                    chain[j] ^= block[j];
+                }
+                status = crypt_block(key_data, chain, chain, false);
+                memcpy(block, chain, 16);
+            } else {
+                status = crypt_block(key_data, chain, pad, false);
+                for (unsigned int j = 0; j < n; j++) {
+                    block[j] ^= pad[j];
+                }
+                /* Big-endian counter increment */
+                for (int j = 15; j >= 0 && ++chain[j] == 0; j--);
+            }
+            if (status < 0) {
+                return -1;
+            }
+            blocks++;
+        }
+
+        if (bus->write(variables[2] + offset, buffer, chunk)) {
+            printf("Error writing to bus 0x%x\n", variables[2] + offset);
+            return -1;
+        }
+    }
+
+    double wall_s = wall_seconds() - wall_start;
+    double sim_ms = (sc_time_stamp() - sim_start).to_seconds() * 1000.0;
+
+    printf("[AA] AES stream: %llu blocks in %.0f simulated ms, %.3f s wall\n", blocks, sim_ms, wall_s);
+    printf("[AA]   %.6f blocks/simulated ms, %.1f blocks/wall second\n",
+           sim_ms > 0 ? blocks / sim_ms : 0.0, wall_s > 0 ? blocks / wall_s : 0.0);
+    print_key_cache_stats();
+
+    return 0;
+}
+
+/*
+ * Micro-benchmark: encrypt count blocks through aes_invoker and return the
+ * average wall time per block in seconds. Must be called from a thread.
+ */
+double run_aes_invoker_benchmark(int count) {
+    static const unsigned char key[16] = { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c };
+    unsigned char block[16] = { 0x32, 0x43, 0xf6, 0xa8, 0x88, 0x5a, 0x30, 0x8d, 0x31, 0x31, 0x98, 0xa2, 0xe0, 0x37, 0x07, 0x34 };
+
+    if (!invoker || count <= 0) {
+        return 0.0;
+    }
+
+    load_key(key);
+    double start = wall_seconds();
+    for (int i = 0; i < count; i++) {
+        invoker->mode_decrypt.write(0);
+        bytes_from_128(rtl_block(bytes_to_128(block)), block);
+    }
+    return (wall_seconds() - start) / count;
+}
@@ -0,0 +1,225 @@
+/**
+ * MURAC Test Application - AES 128 bit cryptography
+ * Transaction-level model of the aes core
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <string.h>
+#include "aes_tlm.h"
+
+/* Clock cycles spent by each stage of the RTL core */
+#define RTL_SUBBYTES          17  /* one byte per cycle through the registered sbox */
+#define RTL_MIXCOLUMNS        4   /* one word per cycle */
+#define RTL_KEYSCHED          5   /* four sbox accesses and the XOR stage */
+#define RTL_ADDROUNDKEY       2   /* start registered, result registered */
+#define RTL_READY             1   /* ready_o is registered */
+
+#define ROTL8(x) (((x) << 8) | ((x) >> 24))
+
+static unsigned char xtime(unsigned char a) {
+    return (a << 1) ^ ((a & 0x80) ? 0x1B : 0);
+}
+
+static unsigned char gmul(unsigned char a, unsigned char b) {
+    unsigned char p = 0;
+    while (b) {
+        if (b & 1) {
+            p ^= a;
+        }
+        a = xtime(a);
+        b >>= 1;
+    }
+    return p;
+}
+
+static uint32_t load_be(const unsigned char *b) {
+    return ((uint32_t) b[0] << 24) | ((uint32_t) b[1] << 16) | ((uint32_t) b[2] << 8) | b[3];
+}
+
+static void store_be(uint32_t v, unsigned char *b) {
+    b[0] = v >> 24;
+    b[1] = v >> 16;
+    b[2] = v >> 8;
+    b[3] = v;
+}
+
+aes_tlm::aes_tlm() : key_valid(false) {
+    build_tables();
+}
+
+void aes_tlm::build_tables() {
+    /* S-box: multiplicative inverse in GF(2^8) followed by the affine map */
+    for (int i = 0; i < 256; i++) {
+        unsigned char inv = 0;
+        for (int j = 1; j < 256 && i; j++) {
+            if (gmul(i, j) == 1) {
+                inv = j;
+                break;
+            }
+        }
+        unsigned char s = inv;
+        for (int k = 1; k < 5; k++) {
+            s ^= (unsigned char) ((inv << k) | (inv >> (8 - k)));
+        }
+        sbox[i] = s ^ 0x63;
+        inv_sbox[sbox[i]] = i;
+    }
+
+    /* Combined SubBytes, ShiftRows and MixColumns tables */
+    for (int i = 0; i < 256; i++) {
+        unsigned char s = sbox[i];
+        uint32_t t = ((uint32_t) gmul(s, 2) << 24) | ((uint32_t) s << 16) | ((uint32_t) s << 8) | gmul(s, 3);
+        te[0][i] = t;
+        te[1][i] = (t >> 8) | (t << 24);
+        te[2][i] = (t >> 16) | (t << 16);
+        te[3][i] = (t >> 24) | (t << 8);
+
+        s = inv_sbox[i];
+        t = ((uint32_t) gmul(s, 0x0e) << 24) | ((uint32_t) gmul(s, 0x09) << 16) |
+            ((uint32_t) gmul(s, 0x0d) << 8) | gmul(s, 0x0b);
+        td[0][i] = t;
+        td[1][i] = (t >> 8) | (t << 24);
+        td[2][i] = (t >> 16) | (t << 16);
+        td[3][i] = (t >> 24) | (t << 8);
+    }
+}
+
+void aes_tlm::expand_key(const unsigned char key[16]) {
+    if (key_valid && memcmp(key, key_bytes, 16) == 0) {
+        return;
+    }
+
+    unsigned char rcon = 1;
+    for (int i = 0; i < 4; i++) {
+        round_keys[i] = load_be(&key[4*i]);
+    }
+    for (int i = 4; i < 44; i++) {
+        uint32_t t = round_keys[i - 1];
+        if ((i & 3) == 0) {
+            t = ROTL8(t);
+            t = ((uint32_t) sbox[t >> 24] << 24) | ((uint32_t) sbox[(t >> 16) & 0xFF] << 16) |
+                ((uint32_t) sbox[(t >> 8) & 0xFF] << 8) | sbox[t & 0xFF];
+            t ^= (uint32_t) rcon << 24;
+            rcon = xtime(rcon);
+        }
+        round_keys[i] = round_keys[i - 4] ^ t;
+    }
+
+    /* Equivalent inverse cipher: reversed order, InvMixColumns on rounds 1-9 */
+    for (int r = 0; r <= 10; r++) {
+        for (int c = 0; c < 4; c++) {
+            uint32_t w = round_keys[4*(10 - r) + c];
+            if (r > 0 && r < 10) {
+                w = td[0][sbox[w >> 24]] ^ td[1][sbox[(w >> 16) & 0xFF]] ^
+                    td[2][sbox[(w >> 8) & 0xFF]] ^ td[3][sbox[w & 0xFF]];
+            }
+            inv_round_keys[4*r + c] = w;
+        }
+    }
+
+    memcpy(key_bytes, key, 16);
+    key_valid = true;
+}
+
+const uint32_t *aes_tlm::schedule(const unsigned char key[16]) {
+    expand_key(key);
+    return round_keys;
+}
+
+unsigned int aes_tlm::encrypt(const unsigned char key[16], const unsigned char in[16], unsigned char out[16], bool cached) {
+    expand_key(key);
+
+    const uint32_t *rk = round_keys;
+    uint32_t s0 = load_be(&in[0])  ^ rk[0];
+    uint32_t s1 = load_be(&in[4])  ^ rk[1];
+    uint32_t s2 = load_be(&in[8])  ^ rk[2];
+    uint32_t s3 = load_be(&in[12]) ^ rk[3];
+    uint32_t t0, t1, t2, t3;
+
+    for (int round = 1; round < 10; round++) {
+        rk += 4;
+        t0 = te[0][s0 >> 24] ^ te[1][(s1 >> 16) & 0xFF] ^ te[2][(s2 >> 8) & 0xFF] ^ te[3][s3 & 0xFF] ^ rk[0];
+        t1 = te[0][s1 >> 24] ^ te[1][(s2 >> 16) & 0xFF] ^ te[2][(s3 >> 8) & 0xFF] ^ te[3][s0 & 0xFF] ^ rk[1];
+        t2 = te[0][s2 >> 24] ^ te[1][(s3 >> 16) & 0xFF] ^ te[2][(s0 >> 8) & 0xFF] ^ te[3][s1 & 0xFF] ^ rk[2];
+        t3 = te[0][s3 >> 24] ^ te[1][(s0 >> 16) & 0xFF] ^ te[2][(s1 >> 8) & 0xFF] ^ te[3][s2 & 0xFF] ^ rk[3];
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    rk += 4;
+    t0 = ((uint32_t) sbox[s0 >> 24] << 24) | ((uint32_t) sbox[(s1 >> 16) & 0xFF] << 16) |
+         ((uint32_t) sbox[(s2 >> 8) & 0xFF] << 8) | sbox[s3 & 0xFF];
+    t1 = ((uint32_t) sbox[s1 >> 24] << 24) | ((uint32_t) sbox[(s2 >> 16) & 0xFF] << 16) |
+         ((uint32_t) sbox[(s3 >> 8) & 0xFF] << 8) | sbox[s0 & 0xFF];
+    t2 = ((uint32_t) sbox[s2 >> 24] << 24) | ((uint32_t) sbox[(s3 >> 16) & 0xFF] << 16) |
+         ((uint32_t) sbox[(s0 >> 8) & 0xFF] << 8) | sbox[s1 & 0xFF];
+    t3 = ((uint32_t) sbox[s3 >> 24] << 24) | ((uint32_t) sbox[(s0 >> 16) & 0xFF] << 16) |
+         ((uint32_t) sbox[(s1 >> 8) & 0xFF] << 8) | sbox[s2 & 0xFF];
+
+    store_be(t0 ^ rk[0], &out[0]);
+    store_be(t1 ^ rk[1], &out[4]);
+    store_be(t2 ^ rk[2], &out[8]);
+    store_be(t3 ^ rk[3], &out[12]);
+
+    return block_cycles(cached);
+}
+
+unsigned int aes_tlm::decrypt(const unsigned char key[16], const unsigned char in[16], unsigned char out[16], bool cached) {
+    expand_key(key);
+
+    const uint32_t *rk = inv_round_keys;
+    uint32_t s0 = load_be(&in[0])  ^ rk[0];
+    uint32_t s1 = load_be(&in[4])  ^ rk[1];
+    uint32_t s2 = load_be(&in[8])  ^ rk[2];
+    uint32_t s3 = load_be(&in[12]) ^ rk[3];
+    uint32_t t0, t1, t2, t3;
+
+    for (int round = 1; round < 10; round++) {
+        rk += 4;
+        t0 = td[0][s0 >> 24] ^ td[1][(s3 >> 16) & 0xFF] ^ td[2][(s2 >> 8) & 0xFF] ^ td[3][s1 & 0xFF] ^ rk[0];
+        t1 = td[0][s1 >> 24] ^ td[1][(s0 >> 16) & 0xFF] ^ td[2][(s3 >> 8) & 0xFF] ^ td[3][s2 & 0xFF] ^ rk[1];
+        t2 = td[0][s2 >> 24] ^ td[1][(s1 >> 16) & 0xFF] ^ td[2][(s0 >> 8) & 0xFF] ^ td[3][s3 & 0xFF] ^ rk[2];
+        t3 = td[0][s3 >> 24] ^ td[1][(s2 >> 16) & 0xFF] ^ td[2][(s1 >> 8) & 0xFF] ^ td[3][s0 & 0xFF] ^ rk[3];
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    rk += 4;
+    t0 = ((uint32_t) inv_sbox[s0 >> 24] << 24) | ((uint32_t) inv_sbox[(s3 >> 16) & 0xFF] << 16) |
+         ((uint32_t) inv_sbox[(s2 >> 8) & 0xFF] << 8) | inv_sbox[s1 & 0xFF];
+    t1 = ((uint32_t) inv_sbox[s1 >> 24] << 24) | ((uint32_t) inv_sbox[(s0 >> 16) & 0xFF] << 16) |
+         ((uint32_t) inv_sbox[(s3 >> 8) & 0xFF] << 8) | inv_sbox[s2 & 0xFF];
+    t2 = ((uint32_t) inv_sbox[s2 >> 24] << 24) | ((uint32_t) inv_sbox[(s1 >> 16) & 0xFF] << 16) |
+         ((uint32_t) inv_sbox[(s0 >> 8) & 0xFF] << 8) | inv_sbox[s3 & 0xFF];
+    t3 = ((uint32_t) inv_sbox[s3 >> 24] << 24) | ((uint32_t) inv_sbox[(s2 >> 16) & 0xFF] << 16) |
+         ((uint32_t) inv_sbox[(s1 >> 8) & 0xFF] << 8) | inv_sbox[s0 & 0xFF];
+
+    store_be(t0 ^ rk[0], &out[0]);
+    store_be(t1 ^ rk[1], &out[4]);
+    store_be(t2 ^ rk[2], &out[8]);
+    store_be(t3 ^ rk[3], &out[12]);
+
+    return block_cycles(cached);
+}
+
+/*
+ * Every AddRoundKey except the one using the cipher key restarts keysched
+ * from the cipher key and steps it to the round it needs, five cycles per
+ * step. Decrypt visits the rounds in reverse but needs the same steps.
+ */
+unsigned int aes_tlm::keysched_cycles() {
+    unsigned int cycles = 0;
+    for (unsigned int round = 1; round <= 10; round++) {
+        cycles += RTL_KEYSCHED * round;
+    }
+    return cycles;
+}
+
+/*
+ * Eleven AddRoundKeys, ten SubBytes and nine MixColumns run one after
+ * another, plus the key schedule unless the round keys come from the
+ * round key RAM.
+ */
+unsigned int aes_tlm::block_cycles(bool cached) {
+    unsigned int cycles = 11 * RTL_ADDROUNDKEY + 10 * RTL_SUBBYTES + 9 * RTL_MIXCOLUMNS + RTL_READY;
+    return cached ? cycles : cycles + keysched_cycles();
+}
@@ -0,0 +1,56 @@
+/**
+ * MURAC Test Application - AES 128 bit cryptography
+ * Transaction-level model of the aes core
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#ifndef AES_TLM_H
+#define AES_TLM_H
+
+#include <stdint.h>
+
+/*
+ * Functional AES-128 with table-driven S-boxes and the state held in four
+ * native 32-bit columns. Each call returns the latency of the RTL aes
+ * core for the same block in clock cycles, measured from the edge that
+ * samples load_i to the edge that raises ready_o.
+ */
+class aes_tlm {
+
+public:
+    aes_tlm();
+
+    /*
+     * cached is set when the core takes its round keys from the round key
+     * RAM rather than running keysched
+     */
+    unsigned int encrypt(const unsigned char key[16], const unsigned char in[16], unsigned char out[16], bool cached = false);
+    unsigned int decrypt(const unsigned char key[16], const unsigned char in[16], unsigned char out[16], bool cached = false);
+
+    /* Round keys 0-10 for key, as big-endian column words */
+    const uint32_t *schedule(const unsigned char key[16]);
+
+    /* Latency of one block in the RTL core, the same for either direction */
+    static unsigned int block_cycles(bool cached);
+
+    /* Cycles keysched spends deriving the round keys of one block */
+    static unsigned int keysched_cycles();
+
+private:
+    unsigned char sbox[256];
+    unsigned char inv_sbox[256];
+    uint32_t      te[4][256];
+    uint32_t      td[4][256];
+
+    /* Expanded encryption and equivalent inverse cipher keys for the last key seen */
+    unsigned char key_bytes[16];
+    uint32_t      round_keys[44];
+    uint32_t      inv_round_keys[44];
+    bool          key_valid;
+
+    void build_tables();
+    void expand_key(const unsigned char key[16]);
+};
+
+#endif // AES_TLM_H
@@ -0,0 +1,83 @@
+/**
+ * MURAC Test Application - AES 128 bit cryptography
+ * Native 128-bit datapath value
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#ifndef AES_UINT128_H
+#define AES_UINT128_H
+
+#include "systemc.h"
+
+/*
+ * Fixed-width 128-bit value held in two native 64-bit halves. Replaces
+ * sc_biguint<128> on the AES datapath: byte and word accessors take the
+ * place of range() slices and no operation allocates.
+ *
+ * Byte 0 is bits 127:120 and word 0 is bits 127:96, matching the slices
+ * used by the RTL.
+ */
+class aes_uint128 {
+
+public:
+    sc_dt::uint64 hi, lo;
+
+    aes_uint128() : hi(0), lo(0) {}
+    aes_uint128(sc_dt::uint64 v) : hi(0), lo(v) {}
+    aes_uint128(sc_dt::uint64 h, sc_dt::uint64 l) : hi(h), lo(l) {}
+
+    unsigned int byte(int i) const {
+        return (unsigned int) ((i < 8 ? hi >> (56 - 8*i) : lo >> (120 - 8*i)) & 0xFF);
+    }
+
+    void set_byte(int i, unsigned int v) {
+        if (i < 8) {
+            int shift = 56 - 8*i;
+            hi = (hi & ~((sc_dt::uint64) 0xFF << shift)) | ((sc_dt::uint64) (v & 0xFF) << shift);
+        } else {
+            int shift = 120 - 8*i;
+            lo = (lo & ~((sc_dt::uint64) 0xFF << shift)) | ((sc_dt::uint64) (v & 0xFF) << shift);
+        }
+    }
+
+    unsigned int word(int i) const {
+        return (unsigned int) ((i < 2 ? hi >> (32 - 32*i) : lo >> (96 - 32*i)) & 0xFFFFFFFF);
+    }
+
+    void set_word(int i, unsigned int v) {
+        if (i < 2) {
+            int shift = 32 - 32*i;
+            hi = (hi & ~((sc_dt::uint64) 0xFFFFFFFF << shift)) | ((sc_dt::uint64) v << shift);
+        } else {
+            int shift = 96 - 32*i;
+            lo = (lo & ~((sc_dt::uint64) 0xFFFFFFFF << shift)) | ((sc_dt::uint64) v << shift);
+        }
+    }
+
+    aes_uint128 operator^(const aes_uint128 &o) const {
+        return aes_uint128(hi ^ o.hi, lo ^ o.lo);
+    }
+
+    bool operator==(const aes_uint128 &o) const {
+        return hi == o.hi && lo == o.lo;
+    }
+
+    bool operator!=(const aes_uint128 &o) const {
+        return !(*this == o);
+    }
+};
+
+/* Needed by sc_signal<aes_uint128> */
+inline ostream &operator<<(ostream &os, const aes_uint128 &v) {
+    char buf[36];
+    sprintf(buf, "0x%016llx%016llx", (unsigned long long) v.hi, (unsigned long long) v.lo);
+    return os << buf;
+}
+
+inline void sc_trace(sc_trace_file *tf, const aes_uint128 &v, const std::string &name) {
+    sc_trace(tf, v.hi, name + "_hi");
+    sc_trace(tf, v.lo, name + "_lo");
+}
+
+#endif // AES_UINT128_H
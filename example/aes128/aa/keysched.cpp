@@ -97,11 +97,8 @@ void keysched::rcon()
 
 void keysched::generate_key()
 {
-	sc_biguint<128> K_var, W_var;
+	aes_uint128 K_var, W_var;
 	sc_uint<32> col_t;
-	sc_uint<24> zero;
-
-	zero = 0;
 
 	col_t = col.read();
 	W_var = 0;
@@ -127,27 +124,27 @@ void keysched::generate_key()
 			{
 				col_t = 0;
 				sbox_access_o.write(1);
-				sbox_data_o.write((sc_uint < 8 >)K_var.range(31, 24));
+				sbox_data_o.write(K_var.byte(12));
 				next_state.write(1);
 			}
 			break;
 		case 1:
 			sbox_access_o.write(1);
-			sbox_data_o.write((sc_uint < 8 >)K_var.range(23, 16));
+			sbox_data_o.write(K_var.byte(13));
 			col_t.range(7, 0) = sbox_data_i.read();
 			next_col.write(col_t);
 			next_state.write(2);
 			break;
 		case 2:
 			sbox_access_o.write(1);
-			sbox_data_o.write((sc_uint < 8 >)K_var.range(15, 8));
+			sbox_data_o.write(K_var.byte(14));
 			col_t.range(31, 24) = sbox_data_i.read();
 			next_col.write(col_t);
 			next_state.write(3);
 			break;
 		case 3:
 			sbox_access_o.write(1);
-			sbox_data_o.write((sc_uint < 8 >)K_var.range(7, 0));
+			sbox_data_o.write(K_var.byte(15));
 			col_t.range(23, 16) = sbox_data_i.read();
 			next_col.write(col_t);
 			next_state.write(4);
@@ -156,10 +153,10 @@ void keysched::generate_key()
 			sbox_access_o.write(1);
 			col_t.range(15, 8) = sbox_data_i.read();
 			next_col.write(col_t);
-			W_var.range(127, 96) = col_t ^ K_var.range(127, 96) ^ (rcon_o.read(), zero);
-			W_var.range(95, 64) = W_var.range(127, 96) ^ K_var.range(95, 64);
-			W_var.range(63, 32) = W_var.range(95, 64) ^ K_var.range(63, 32);
-			W_var.range(31, 0) = W_var.range(63, 32) ^ K_var.range(31, 0);
+			W_var.set_word(0, (unsigned int) col_t ^ K_var.word(0) ^ ((unsigned int) rcon_o.read() << 24));
+			W_var.set_word(1, W_var.word(0) ^ K_var.word(1));
+			W_var.set_word(2, W_var.word(1) ^ K_var.word(2));
+			W_var.set_word(3, W_var.word(2) ^ K_var.word(3));
 			next_ready_o.write(1);
 			next_key_reg.write(W_var);
 			next_state.write(0);
@@ -51,6 +51,7 @@
 //
 
 #include "systemc.h"
+#include "aes_uint128.h"
 
 SC_MODULE(keysched)
 {
@@ -60,8 +61,8 @@ SC_MODULE(keysched)
 
 	sc_in<bool> start_i;
 	sc_in<sc_uint<4> > round_i;
-	sc_in<sc_biguint<128> > last_key_i;
-	sc_out<sc_biguint<128> > new_key_o;
+	sc_in<aes_uint128> last_key_i;
+	sc_out<aes_uint128> new_key_o;
 	sc_out<bool> ready_o;
 
 	//To Sbox
@@ -79,7 +80,7 @@ SC_MODULE(keysched)
 	sc_signal<sc_uint<3> > next_state, state;
 	sc_signal<sc_uint<8> > rcon_o;
 	sc_signal<sc_uint<32> > next_col, col;
-	sc_signal<sc_biguint<128> > key_reg, next_key_reg;
+	sc_signal<aes_uint128> key_reg, next_key_reg;
 	sc_signal<bool> next_ready_o;
 
 	SC_CTOR(keysched)
@@ -59,9 +59,9 @@ void mixcolum::mux()
 
 void mixcolum::mixcol()
 {
-	sc_biguint<128> data_i_var;
+	aes_uint128 data_i_var;
 	sc_uint<32> aux;
-	sc_biguint<128> data_reg_var;
+	aes_uint128 data_reg_var;
 
 	data_i_var = data_i.read();
 	data_reg_var = data_reg.read();
@@ -79,31 +79,31 @@ void mixcolum::mixcol()
 		case 0:
 			if (start_i.read())
 			{
-				aux = data_i_var.range(127, 96);
+				aux = data_i_var.word(0);
 				mix_word.write(aux);
-				data_reg_var.range(127, 96) = outmux.read();
+				data_reg_var.set_word(0, outmux.read());
 				next_data_reg.write(data_reg_var);
 				next_state.write(1);
 			}
 			break;
 		case 1:
-			aux = data_i_var.range(95, 64);
+			aux = data_i_var.word(1);
 			mix_word.write(aux);
-			data_reg_var.range(95, 64) = outmux.read();
+			data_reg_var.set_word(1, outmux.read());
 			next_data_reg.write(data_reg_var);
 			next_state.write(2);
 			break;
 		case 2:
-			aux = data_i_var.range(63, 32);
+			aux = data_i_var.word(2);
 			mix_word.write(aux);
-			data_reg_var.range(63, 32) = outmux.read();
+			data_reg_var.set_word(2, outmux.read());
 			next_data_reg.write(data_reg_var);
 			next_state.write(3);
 			break;
 		case 3:
-			aux = data_i_var.range(31, 0);
+			aux = data_i_var.word(3);
 			mix_word.write(aux);
-			data_reg_var.range(31, 0) = outmux.read();
+			data_reg_var.set_word(3, outmux.read());
 			next_data_o.write(data_reg_var);
 			next_ready_o.write(1);
 			next_state.write(0);
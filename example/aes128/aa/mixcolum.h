@@ -53,6 +53,7 @@
 
 
 #include "systemc.h"
+#include "aes_uint128.h"
 #include "word_mixcolum.h"
 
 SC_MODULE(mixcolum)
@@ -63,12 +64,12 @@ SC_MODULE(mixcolum)
 
 	sc_in<bool> decrypt_i;
 	sc_in<bool> start_i;
-	sc_in<sc_biguint<128> > data_i;
+	sc_in<aes_uint128> data_i;
 
 	sc_out<bool> ready_o;
-	sc_out<sc_biguint<128> > data_o;
+	sc_out<aes_uint128> data_o;
 
-	sc_signal<sc_biguint<128> > data_reg, next_data_reg, data_o_reg, next_data_o;
+	sc_signal<aes_uint128> data_reg, next_data_reg, data_o_reg, next_data_o;
 	sc_signal<bool> next_ready_o;
 
 	void mixcol();
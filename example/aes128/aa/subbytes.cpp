@@ -59,104 +59,38 @@
 void subbytes::sub()
 {
 
-	sc_biguint<128> data_i_var, data_reg_128;
+	aes_uint128 data_i_var, data_reg_128;
 	sc_uint<8> data_array[16], data_reg_var[16];
 
+	static const int shift_rows[16] = {0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11};
+	static const int invert_shift_rows[16] = {0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3};
+
 #define assign_array_to_128() \
 {  \
-	data_reg_128.range(127,120)=data_reg_var[0]; \
-	data_reg_128.range(119,112)=data_reg_var[1]; \
-	data_reg_128.range(111,104)=data_reg_var[2]; \
-	data_reg_128.range(103,96)=data_reg_var[3]; \
-	data_reg_128.range(95,88)=data_reg_var[4]; \
-	data_reg_128.range(87,80)=data_reg_var[5]; \
-	data_reg_128.range(79,72)=data_reg_var[6]; \
-	data_reg_128.range(71,64)=data_reg_var[7]; \
-	data_reg_128.range(63,56)=data_reg_var[8]; \
-	data_reg_128.range(55,48)=data_reg_var[9]; \
-	data_reg_128.range(47,40)=data_reg_var[10]; \
-	data_reg_128.range(39,32)=data_reg_var[11]; \
-	data_reg_128.range(31,24)=data_reg_var[12]; \
-	data_reg_128.range(23,16)=data_reg_var[13]; \
-	data_reg_128.range(15,8)=data_reg_var[14]; \
-	data_reg_128.range(7,0)=data_reg_var[15]; \
+	for (int i = 0; i < 16; i++) \
+		data_reg_128.set_byte(i, data_reg_var[i]); \
 }
 
 #define shift_array_to_128() \
 {  \
-	data_reg_128.range(127,120)=data_reg_var[0]; \
-	data_reg_128.range(119,112)=data_reg_var[5]; \
-	data_reg_128.range(111,104)=data_reg_var[10]; \
-	data_reg_128.range(103,96)=data_reg_var[15]; \
-	data_reg_128.range(95,88)=data_reg_var[4]; \
-	data_reg_128.range(87,80)=data_reg_var[9]; \
-	data_reg_128.range(79,72)=data_reg_var[14]; \
-	data_reg_128.range(71,64)=data_reg_var[3]; \
-	data_reg_128.range(63,56)=data_reg_var[8]; \
-	data_reg_128.range(55,48)=data_reg_var[13]; \
-	data_reg_128.range(47,40)=data_reg_var[2]; \
-	data_reg_128.range(39,32)=data_reg_var[7]; \
-	data_reg_128.range(31,24)=data_reg_var[12]; \
-	data_reg_128.range(23,16)=data_reg_var[1]; \
-	data_reg_128.range(15,8)=data_reg_var[6]; \
-	data_reg_128.range(7,0)=data_reg_var[11]; \
+	for (int i = 0; i < 16; i++) \
+		data_reg_128.set_byte(i, data_reg_var[shift_rows[i]]); \
 }
 
 #define invert_shift_array_to_128() \
 {  \
-	data_reg_128.range(127,120)=data_reg_var[0]; \
-	data_reg_128.range(119,112)=data_reg_var[13]; \
-	data_reg_128.range(111,104)=data_reg_var[10]; \
-	data_reg_128.range(103,96)=data_reg_var[7]; \
-	data_reg_128.range(95,88)=data_reg_var[4]; \
-	data_reg_128.range(87,80)=data_reg_var[1]; \
-	data_reg_128.range(79,72)=data_reg_var[14]; \
-	data_reg_128.range(71,64)=data_reg_var[11]; \
-	data_reg_128.range(63,56)=data_reg_var[8]; \
-	data_reg_128.range(55,48)=data_reg_var[5]; \
-	data_reg_128.range(47,40)=data_reg_var[2]; \
-	data_reg_128.range(39,32)=data_reg_var[15]; \
-	data_reg_128.range(31,24)=data_reg_var[12]; \
-	data_reg_128.range(23,16)=data_reg_var[9]; \
-	data_reg_128.range(15,8)=data_reg_var[6]; \
-	data_reg_128.range(7,0)=data_reg_var[3]; \
+	for (int i = 0; i < 16; i++) \
+		data_reg_128.set_byte(i, data_reg_var[invert_shift_rows[i]]); \
 }
 
 	data_i_var = data_i.read();
+	aes_uint128 data_reg_read = data_reg.read();
 
-	data_array[0] = data_i_var.range(127, 120);
-	data_array[1] = data_i_var.range(119, 112);
-	data_array[2] = data_i_var.range(111, 104);
-	data_array[3] = data_i_var.range(103, 96);
-	data_array[4] = data_i_var.range(95, 88);
-	data_array[5] = data_i_var.range(87, 80);
-	data_array[6] = data_i_var.range(79, 72);
-	data_array[7] = data_i_var.range(71, 64);
-	data_array[8] = data_i_var.range(63, 56);
-	data_array[9] = data_i_var.range(55, 48);
-	data_array[10] = data_i_var.range(47, 40);
-	data_array[11] = data_i_var.range(39, 32);
-	data_array[12] = data_i_var.range(31, 24);
-	data_array[13] = data_i_var.range(23, 16);
-	data_array[14] = data_i_var.range(15, 8);
-	data_array[15] = data_i_var.range(7, 0);
-
-	data_reg_var[0] = data_reg.read().range(127, 120);
-	data_reg_var[1] = data_reg.read().range(119, 112);
-	data_reg_var[2] = data_reg.read().range(111, 104);
-	data_reg_var[3] = data_reg.read().range(103, 96);
-	data_reg_var[4] = data_reg.read().range(95, 88);
-	data_reg_var[5] = data_reg.read().range(87, 80);
-	data_reg_var[6] = data_reg.read().range(79, 72);
-	data_reg_var[7] = data_reg.read().range(71, 64);
-	data_reg_var[8] = data_reg.read().range(63, 56);
-	data_reg_var[9] = data_reg.read().range(55, 48);
-	data_reg_var[10] = data_reg.read().range(47, 40);
-	data_reg_var[11] = data_reg.read().range(39, 32);
-	data_reg_var[12] = data_reg.read().range(31, 24);
-	data_reg_var[13] = data_reg.read().range(23, 16);
-	data_reg_var[14] = data_reg.read().range(15, 8);
-	data_reg_var[15] = data_reg.read().range(7, 0);
+	for (int i = 0; i < 16; i++)
+	{
+		data_array[i] = data_i_var.byte(i);
+		data_reg_var[i] = data_reg_read.byte(i);
+	}
 
 
 	sbox_decrypt_o.write(decrypt_i.read());
@@ -55,6 +55,7 @@
 
 
 #include "systemc.h"
+#include "aes_uint128.h"
 
 SC_MODULE(subbytes)
 {
@@ -64,10 +65,10 @@ SC_MODULE(subbytes)
 
 	sc_in<bool> start_i;
 	sc_in<bool> decrypt_i;
-	sc_in<sc_biguint <128> > data_i;
+	sc_in<aes_uint128> data_i;
 
 	sc_out<bool> ready_o;
-	sc_out<sc_biguint<128> > data_o;
+	sc_out<aes_uint128> data_o;
 
 	//To sbox
 	sc_out<sc_uint<8> > sbox_data_o;
@@ -78,7 +79,7 @@ SC_MODULE(subbytes)
 	void registers();
 
 	sc_signal<sc_uint<5> > state, next_state;
-	sc_signal<sc_biguint<128> > data_reg, next_data_reg;
+	sc_signal<aes_uint128> data_reg, next_data_reg;
 	sc_signal<bool> next_ready_o;
 
 	SC_CTOR(subbytes)
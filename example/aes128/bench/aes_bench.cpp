@@ -0,0 +1,40 @@
+/**
+ * MURAC Test Application - AES 128 bit cryptography
+ * Micro-benchmark of the RTL aes core through aes_invoker
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <stdio.h>
+#include <stdlib.h>
+#include <systemc.h>
+#include "../../../framework/murac.h"
+
+extern "C" int murac_init(BusInterface* bus);
+extern double run_aes_invoker_benchmark(int count);
+
+SC_MODULE(aes_bench) {
+
+    int count;
+
+    void run() {
+        double seconds = run_aes_invoker_benchmark(count);
+        printf("aes_invoker: %d encrypts, %.6f s wall per encrypt, %.1f encrypts/s\n",
+               count, seconds, seconds > 0 ? 1.0 / seconds : 0.0);
+        sc_stop();
+    }
+
+    SC_HAS_PROCESS(aes_bench);
+    aes_bench(sc_module_name name, int n) : sc_module(name), count(n) {
+        SC_THREAD(run);
+    }
+};
+
+int sc_main(int argc, char *argv[]) {
+    int count = argc > 1 ? atoi(argv[1]) : 100;
+
+    murac_init(0);
+    aes_bench bench("bench", count);
+    sc_start();
+    return 0;
+}
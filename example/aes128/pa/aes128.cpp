@@ -49,6 +49,9 @@ int main(void) {
     
     printf("[PA] Encryption output: ");
     printdata(encrypt_output);
+    printf("[PA] Decryption output: ");
+    printdata(decrypt_output);
+    printf("[PA] Round trip %s\n", memcmp(decrypt_output, input, 16) == 0 ? "matches" : "differs");
     printf("[PA] Example finished...\n");
 
     free(key);
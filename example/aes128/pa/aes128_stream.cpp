@@ -0,0 +1,93 @@
+/**
+ * MURAC Test Application - AES 128 bit cryptography, streaming
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../aa/embed/aes128_stream.h"
+#include "../../../framework/murac.h"
+
+/* Streaming modes, shared with aa/aes_lib.cpp */
+#define AES_MODE_ECB     0
+#define AES_MODE_CTR     1
+#define AES_MODE_CBC     2
+#define AES_MODE_DECRYPT 0x80
+
+#define STREAM_BYTES 4096
+
+static const char *mode_names[] = { "ECB", "CTR", "CBC" };
+
+void printdata(const unsigned char *data) {
+    for (int i = 0; i < 16; i++) {
+        printf(" 0x%x", data[i]);
+    }
+    printf("\n");
+}
+
+void aes_stream(unsigned int *vars) {
+    MURAC_SET_PTR(vars)
+
+    EXECUTE_AES128_STREAM
+}
+
+int main(void) {
+
+    printf("[PA] MURAC AES-128 streaming example...\n");
+
+    unsigned char *key    = (unsigned char *) malloc(16);
+    unsigned char *iv     = (unsigned char *) malloc(16);
+    unsigned char *input  = (unsigned char *) malloc(STREAM_BYTES);
+    unsigned char *output = (unsigned char *) malloc(STREAM_BYTES);
+    unsigned char *check  = (unsigned char *) malloc(STREAM_BYTES);
+
+    memcpy(key, "mysimpletestkey!", 16);
+    memcpy(iv, "initialisationve", 16);
+    for (int i = 0; i < STREAM_BYTES; i++) {
+        input[i] = i & 0xFF;
+    }
+
+    unsigned int *vars = (unsigned int *) malloc(6*sizeof(unsigned int));
+    vars[0] = (unsigned int) key;
+    vars[1] = (unsigned int) input;
+    vars[2] = (unsigned int) output;
+    vars[3] = STREAM_BYTES;
+    vars[5] = (unsigned int) iv;
+
+    for (int mode = AES_MODE_ECB; mode <= AES_MODE_CBC; mode++) {
+        memset(output, 0, STREAM_BYTES);
+        vars[4] = mode;
+
+        aes_stream(vars);
+
+        printf("[PA] %s, %d bytes, first block:", mode_names[mode], STREAM_BYTES);
+        printdata(output);
+        printf("[PA] %s, last block:", mode_names[mode]);
+        printdata(output + STREAM_BYTES - 16);
+
+        /* Decrypt again with the same key; CTR decrypts by encrypting */
+        vars[1] = (unsigned int) output;
+        vars[2] = (unsigned int) check;
+        vars[4] = mode == AES_MODE_CTR ? mode : mode | AES_MODE_DECRYPT;
+
+        aes_stream(vars);
+
+        printf("[PA] %s round trip %s\n", mode_names[mode],
+               memcmp(check, input, STREAM_BYTES) == 0 ? "matches" : "differs");
+        vars[1] = (unsigned int) input;
+        vars[2] = (unsigned int) output;
+    }
+    printf("[PA] Example finished...\n");
+
+    free(key);
+    free(iv);
+    free(input);
+    free(output);
+    free(check);
+    free(vars);
+
+    return 0;
+}
@@ -0,0 +1,223 @@
+/**
+ * MURAC Test Application - Context Switch Benchmark
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ * PA-only benchmark of MMU translation table walks and TLB maintenance.
+ * Builds a translation table per process, all sharing an identity map of
+ * the platform memory, each with a private window of small pages. Each
+ * round switches TTBR0 and ASID to every process in turn and touches every
+ * page of its window. The same rounds are run with no TLB maintenance on a
+ * switch, with the ASID invalidated (as when an ASID is reused) and with
+ * the whole TLB invalidated, so most accesses miss the TLB and walk the
+ * tables.
+ *
+ * A last set of rounds models a scheduler that also runs a short-lived
+ * task in every time slice. The task reuses one ASID, so the ASID is
+ * invalidated each time while the TLB holds the windows of every process.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define PROCESSES           8
+#define ROUNDS              20
+
+/* Private window of each process, mapped through coarse tables */
+#define WINDOW_BASE         0x40000000
+#define WINDOW_SECTIONS     4
+#define PAGES_PER_SECTION   256
+#define WINDOW_PAGES        (WINDOW_SECTIONS * PAGES_PER_SECTION)
+#define WINDOW_VA(n)        (WINDOW_BASE + ((n) * WINDOW_SECTIONS << 20))
+
+/* The short-lived task has the last table and touches a few pages */
+#define TASK                PROCESSES
+#define TASK_PAGES          8
+
+/* The window maps these physical pages of the process repeatedly */
+#define DATA_PAGES          16
+#define PAGE_SIZE           4096
+
+#define L1_ENTRIES          4096
+#define L1_SIZE             (L1_ENTRIES * 4)
+#define L2_SIZE             (PAGES_PER_SECTION * 4)
+
+/* Short-descriptor formats, full access in domain 0 */
+#define SECTION_DESC(pa)    (((pa) & 0xfff00000) | (3 << 10) | 2)
+#define COARSE_DESC(pa)     (((pa) & 0xfffffc00) | 1)
+#define SMALL_PAGE_DESC(pa) (((pa) & 0xfffff000) | (1 << 11) | (3 << 4) | 2)
+
+/* Identity mapped sections: shared memory, MURAC memory and PA local memory */
+static const struct { unsigned int base, sections; } identity[] = {
+    { 0x00000000, 16 },
+    { 0xCF000000, 16 },
+    { 0xFFF00000,  1 },
+};
+
+#define IDENTITY_REGIONS (sizeof(identity) / sizeof(identity[0]))
+
+enum { NO_FLUSH, FLUSH_ASID, FLUSH_ALL, SPAWN_TASK, MODES };
+
+static const char *mode_name[MODES] = {
+    "switch only", "switch + TLBIASID", "switch + TLBIALL", "switch + task"
+};
+
+struct process {
+    unsigned int *l1;
+    unsigned int *l2;
+    unsigned char *data;
+};
+
+static struct process processes[PROCESSES + 1];
+
+/* CP15 access, in ARM encodings every core of the family accepts */
+static inline void write_sctlr(unsigned int v)       { asm volatile("mcr p15, 0, %0, c1, c0, 0" : : "r"(v) : "memory"); }
+static inline unsigned int read_sctlr(void)          { unsigned int v; asm volatile("mrc p15, 0, %0, c1, c0, 0" : "=r"(v)); return v; }
+static inline void write_ttbr0(unsigned int v)       { asm volatile("mcr p15, 0, %0, c2, c0, 0" : : "r"(v) : "memory"); }
+static inline void write_ttbcr(unsigned int v)       { asm volatile("mcr p15, 0, %0, c2, c0, 2" : : "r"(v) : "memory"); }
+static inline void write_dacr(unsigned int v)        { asm volatile("mcr p15, 0, %0, c3, c0, 0" : : "r"(v) : "memory"); }
+static inline void write_contextidr(unsigned int v)  { asm volatile("mcr p15, 0, %0, c13, c0, 1" : : "r"(v) : "memory"); }
+static inline void tlbiall(void)                     { asm volatile("mcr p15, 0, %0, c8, c7, 0" : : "r"(0) : "memory"); }
+static inline void tlbiasid(unsigned int asid)       { asm volatile("mcr p15, 0, %0, c8, c7, 2" : : "r"(asid) : "memory"); }
+static inline void isb(void)                         { asm volatile("mcr p15, 0, %0, c7, c5, 4" : : "r"(0) : "memory"); }
+
+/* Round p up to a multiple of align, a power of 2 */
+static unsigned char *align_up(unsigned char *p, unsigned int align) {
+    return (unsigned char *) (((unsigned int) p + align - 1) & ~(align - 1));
+}
+
+/* Build the tables of every process and the task in pool, returns 0 if it is too small */
+static int build_tables(unsigned char *pool, unsigned int size) {
+    unsigned char *end = pool + size;
+    unsigned char *p = pool;
+
+    for (unsigned int n = 0; n <= TASK; n++) {
+        struct process *proc = &processes[n];
+
+        p = align_up(p, L1_SIZE);
+        proc->l1 = (unsigned int *) p;
+        p += L1_SIZE;
+        proc->l2 = (unsigned int *) p;
+        p += WINDOW_SECTIONS * L2_SIZE;
+        p = align_up(p, PAGE_SIZE);
+        proc->data = p;
+        p += DATA_PAGES * PAGE_SIZE;
+        if (p > end) {
+            return 0;
+        }
+
+        memset(proc->l1, 0, L1_SIZE);
+        for (unsigned int r = 0; r < IDENTITY_REGIONS; r++) {
+            for (unsigned int s = 0; s < identity[r].sections; s++) {
+                unsigned int pa = identity[r].base + (s << 20);
+                proc->l1[pa >> 20] = SECTION_DESC(pa);
+            }
+        }
+
+        for (unsigned int s = 0; s < WINDOW_SECTIONS; s++) {
+            unsigned int *l2 = &proc->l2[s * PAGES_PER_SECTION];
+            proc->l1[(WINDOW_VA(n) >> 20) + s] = COARSE_DESC((unsigned int) l2);
+            for (unsigned int i = 0; i < PAGES_PER_SECTION; i++) {
+                unsigned int page = (s * PAGES_PER_SECTION + i) % DATA_PAGES;
+                l2[i] = SMALL_PAGE_DESC((unsigned int) proc->data + page * PAGE_SIZE);
+            }
+        }
+
+        /* Each page of the process starts with its ASID */
+        for (unsigned int i = 0; i < DATA_PAGES; i++) {
+            *(unsigned int *) (proc->data + i * PAGE_SIZE) = n + 1;
+        }
+    }
+    return 1;
+}
+
+static void switch_to(unsigned int n, int mode) {
+    unsigned int asid = n + 1;
+    write_contextidr(asid);
+    write_ttbr0((unsigned int) processes[n].l1);
+    if (mode == FLUSH_ASID) {
+        tlbiasid(asid);
+    } else if (mode == FLUSH_ALL) {
+        tlbiall();
+    }
+    isb();
+}
+
+/* Read the first word of pages of the window of process n, returns the sum */
+static unsigned int touch_window(unsigned int n, unsigned int pages) {
+    unsigned int sum = 0;
+    for (unsigned int i = 0; i < pages; i++) {
+        sum += *(volatile unsigned int *) (WINDOW_VA(n) + i * PAGE_SIZE);
+    }
+    return sum;
+}
+
+/* Run the task in a recycled ASID, then return to process n */
+static unsigned int spawn_task(unsigned int n) {
+    switch_to(TASK, FLUSH_ASID);
+    unsigned int errors = touch_window(TASK, TASK_PAGES) != TASK_PAGES * (TASK + 1);
+    switch_to(n, NO_FLUSH);
+    return errors;
+}
+
+/* Run ROUNDS switches through every process, returns the number of wrong windows */
+static unsigned int run_rounds(int mode) {
+    unsigned int errors = 0;
+    for (unsigned int r = 0; r < ROUNDS; r++) {
+        for (unsigned int n = 0; n < PROCESSES; n++) {
+            switch_to(n, mode == SPAWN_TASK ? NO_FLUSH : mode);
+            if (touch_window(n, WINDOW_PAGES) != WINDOW_PAGES * (n + 1)) {
+                errors++;
+            }
+            if (mode == SPAWN_TASK) {
+                errors += spawn_task(n);
+            }
+        }
+    }
+    return errors;
+}
+
+int main(void) {
+
+    printf("[PA] Context switch benchmark: %d processes, %d pages each, %d rounds\n",
+           PROCESSES, WINDOW_PAGES, ROUNDS);
+
+    /* Room for the tables and data of every process, each aligned to a table */
+    unsigned int pool_size = (PROCESSES + 1) * (2 * L1_SIZE + WINDOW_SECTIONS * L2_SIZE + DATA_PAGES * PAGE_SIZE) + L1_SIZE;
+    unsigned char *pool = (unsigned char *) malloc(pool_size);
+    if (!pool || !build_tables(pool, pool_size)) {
+        printf("[PA] Cannot allocate %u bytes of translation tables\n", pool_size);
+        free(pool);
+        return 1;
+    }
+
+    /* Enable the MMU with the first process, the identity map keeps the PA running */
+    write_ttbcr(0);
+    write_dacr(0x55555555);
+    switch_to(0, FLUSH_ALL);
+    write_sctlr(read_sctlr() | 1);
+    isb();
+
+    clock_t ticks[MODES];
+    unsigned int errors[MODES];
+    for (int mode = 0; mode < MODES; mode++) {
+        clock_t start = clock();
+        errors[mode] = run_rounds(mode);
+        ticks[mode] = clock() - start;
+    }
+
+    write_sctlr(read_sctlr() & ~1);
+    isb();
+
+    unsigned int touches = ROUNDS * PROCESSES * WINDOW_PAGES;
+    for (int mode = 0; mode < MODES; mode++) {
+        printf("[PA] %-18s: %u page touches in %ld clock ticks, %u wrong windows\n",
+               mode_name[mode], touches, (long) ticks[mode], errors[mode]);
+    }
+    printf("[PA] %ld clock ticks per second\n", (long) CLOCKS_PER_SEC);
+    printf("[PA] Example finished...\n");
+
+    free(pool);
+    return 0;
+}
@@ -0,0 +1,31 @@
+/**
+ * MURAC Test Application - Matrix Multiplication
+ * Kernel descriptor, shared by the PA and AA sides
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#ifndef MATMUL_DESC_H
+#define MATMUL_DESC_H
+
+/* Element types. matrix_multiply takes int32 and float, systolic_matmul the integer types */
+#define MATMUL_INT32 0
+#define MATMUL_FLOAT 1
+#define MATMUL_INT8  2
+#define MATMUL_INT16 3
+
+/*
+ * C = A * B for an M x K matrix A and a K x N matrix B. All three are
+ * row-major and densely packed; a, b and c are PA addresses.
+ */
+struct matmul_desc {
+    unsigned int a;
+    unsigned int b;
+    unsigned int c;
+    unsigned int m;
+    unsigned int k;
+    unsigned int n;
+    unsigned int type;
+};
+
+#endif // MATMUL_DESC_H
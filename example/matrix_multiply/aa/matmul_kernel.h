@@ -0,0 +1,141 @@
+/**
+ * MURAC Test Application - Matrix Multiplication
+ * Host kernel and latency model, shared by the SystemC AA library and the
+ * muracFPGA PSE (peripheral/pse/muracAA/muracKernels.c), whose multiply
+ * runs natively through library/muracFPGANative.c
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#ifndef MATMUL_KERNEL_H
+#define MATMUL_KERNEL_H
+
+#include <string.h>
+#include "matmul_desc.h"
+
+/* Host cache blocking of the inner kernel */
+#define MATMUL_BLOCK_M 64
+#define MATMUL_BLOCK_N 256
+#define MATMUL_BLOCK_K 256
+
+/* Default accelerator: a 16x16 MAC array fed by a 64 byte per cycle bus */
+#define MATMUL_MAC_ROWS  16
+#define MATMUL_MAC_COLS  16
+#define MATMUL_BUS_BYTES 64
+
+static inline unsigned long long matmul_div_up(unsigned long long a, unsigned long long b) {
+    return (a + b - 1) / b;
+}
+
+/*
+ * Cycles for one M x K x N multiply on an output-stationary array of
+ * mac_rows x mac_cols PEs, which computes one tile of C at a time. Each
+ * tile needs K cycles plus the fill and drain of the array skew. A row
+ * panel of A is loaded once per row of tiles and kept in the array; each
+ * tile loads its column panel of B and stores its results. Transfers are
+ * double-buffered against compute, so only the first load is exposed.
+ */
+static inline unsigned long long matmul_model_cycles(const struct matmul_desc *d, unsigned int mac_rows,
+                                                     unsigned int mac_cols, unsigned int bus_bytes) {
+    unsigned long long tile_rows = matmul_div_up(d->m, mac_rows);
+    unsigned long long tile_cols = matmul_div_up(d->n, mac_cols);
+    unsigned long long compute   = d->k + mac_rows + mac_cols - 2;
+    unsigned long long a_load    = matmul_div_up((unsigned long long) mac_rows * d->k * 4, bus_bytes);
+    unsigned long long b_load    = matmul_div_up((unsigned long long) mac_cols * d->k * 4, bus_bytes);
+    unsigned long long store     = matmul_div_up((unsigned long long) mac_rows * mac_cols * 4, bus_bytes);
+    unsigned long long transfer  = b_load + store + matmul_div_up(a_load, tile_cols);
+    unsigned long long step      = compute > transfer ? compute : transfer;
+    return a_load + b_load + tile_rows * tile_cols * step;
+}
+
+/* Four-lane host vectors, through the GCC vector extension */
+typedef int   matmul_v4i __attribute__((vector_size(16)));
+typedef float matmul_v4f __attribute__((vector_size(16)));
+
+/*
+ * Defines matmul_kernel_<SUFFIX> and matmul_gemm_<SUFFIX> for element type T
+ * and four-lane vector type V.
+ *
+ * matmul_kernel: C[rows x cols] += A[rows x depth] * B[depth x cols]. Four
+ * rows by eight columns of C are kept in vector registers across the depth
+ * loop. Every element of C accumulates its products in depth order,
+ * whatever path it takes, so float results do not depend on the blocking.
+ *
+ * matmul_gemm: C = A * B, cache-blocked over all three dimensions.
+ */
+#define MATMUL_DEFINE_GEMM(SUFFIX, T, V)                                                                    \
+static inline void matmul_kernel_##SUFFIX(unsigned int rows, unsigned int cols, unsigned int depth,        \
+                                          const T *a, unsigned int lda, const T *b, unsigned int ldb,      \
+                                          T *c, unsigned int ldc) {                                        \
+    const unsigned int W = sizeof(V) / sizeof(T);                                                          \
+    unsigned int i, j, p, r;                                                                               \
+                                                                                                           \
+    for (i = 0; i + 4 <= rows; i += 4) {                                                                   \
+        for (j = 0; j + 2 * W <= cols; j += 2 * W) {                                                       \
+            V acc[4][2];                                                                                   \
+            for (r = 0; r < 4; r++) {                                                                      \
+                memcpy(&acc[r][0], &c[(i + r) * ldc + j], sizeof(V));                                      \
+                memcpy(&acc[r][1], &c[(i + r) * ldc + j + W], sizeof(V));                                  \
+            }                                                                                              \
+            for (p = 0; p < depth; p++) {                                                                  \
+                V b0, b1;                                                                                  \
+                memcpy(&b0, &b[p * ldb + j], sizeof(V));                                                   \
+                memcpy(&b1, &b[p * ldb + j + W], sizeof(V));                                               \
+                for (r = 0; r < 4; r++) {                                                                  \
+                    T x = a[(i + r) * lda + p];                                                            \
+                    V ar = { x, x, x, x };                                                                 \
+                    acc[r][0] += ar * b0;                                                                  \
+                    acc[r][1] += ar * b1;                                                                  \
+                }                                                                                          \
+            }                                                                                              \
+            for (r = 0; r < 4; r++) {                                                                      \
+                memcpy(&c[(i + r) * ldc + j], &acc[r][0], sizeof(V));                                      \
+                memcpy(&c[(i + r) * ldc + j + W], &acc[r][1], sizeof(V));                                  \
+            }                                                                                              \
+        }                                                                                                  \
+        for (; j < cols; j++) {                                                                            \
+            for (r = 0; r < 4; r++) {                                                                      \
+                T sum = c[(i + r) * ldc + j];                                                              \
+                for (p = 0; p < depth; p++) {                                                              \
+                    sum += a[(i + r) * lda + p] * b[p * ldb + j];                                          \
+                }                                                                                          \
+                c[(i + r) * ldc + j] = sum;                                                                \
+            }                                                                                              \
+        }                                                                                                  \
+    }                                                                                                      \
+    for (; i < rows; i++) {                                                                                \
+        for (j = 0; j < cols; j++) {                                                                       \
+            T sum = c[i * ldc + j];                                                                        \
+            for (p = 0; p < depth; p++) {                                                                  \
+                sum += a[i * lda + p] * b[p * ldb + j];                                                    \
+            }                                                                                              \
+            c[i * ldc + j] = sum;                                                                          \
+        }                                                                                                  \
+    }                                                                                                      \
+}                                                                                                          \
+                                                                                                           \
+static inline void matmul_gemm_##SUFFIX(unsigned int m, unsigned int n, unsigned int k,                    \
+                                        const T *a, unsigned int lda, const T *b, unsigned int ldb,        \
+                                        T *c, unsigned int ldc) {                                          \
+    unsigned int i, i0, j0, p0;                                                                            \
+                                                                                                           \
+    for (i = 0; i < m; i++) {                                                                              \
+        memset(&c[i * ldc], 0, n * sizeof(T));                                                             \
+    }                                                                                                      \
+    for (p0 = 0; p0 < k; p0 += MATMUL_BLOCK_K) {                                                           \
+        unsigned int depth = k - p0 < MATMUL_BLOCK_K ? k - p0 : MATMUL_BLOCK_K;                            \
+        for (i0 = 0; i0 < m; i0 += MATMUL_BLOCK_M) {                                                       \
+            unsigned int rows = m - i0 < MATMUL_BLOCK_M ? m - i0 : MATMUL_BLOCK_M;                         \
+            for (j0 = 0; j0 < n; j0 += MATMUL_BLOCK_N) {                                                   \
+                unsigned int cols = n - j0 < MATMUL_BLOCK_N ? n - j0 : MATMUL_BLOCK_N;                     \
+                matmul_kernel_##SUFFIX(rows, cols, depth, &a[i0 * lda + p0], lda, &b[p0 * ldb + j0], ldb,  \
+                                       &c[i0 * ldc + j0], ldc);                                            \
+            }                                                                                              \
+        }                                                                                                  \
+    }                                                                                                      \
+}
+
+MATMUL_DEFINE_GEMM(int32, int, matmul_v4i)
+MATMUL_DEFINE_GEMM(float, float, matmul_v4f)
+
+#endif // MATMUL_KERNEL_H
@@ -0,0 +1,234 @@
+/**
+ * MURAC Test Application - Matrix Multiplication
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <systemc.h>
+#include "../../../framework/murac.h"
+#include "matmul_kernel.h"
+
+using std::cout;
+using std::endl;
+
+/* Rows of A and columns of B moved over the bus per tile */
+#define PANEL_ROWS 64
+#define PANEL_COLS 256
+
+static BusInterface *bus = 0;
+
+/*
+ * Accelerator latency model (matmul_model_cycles): an output-stationary
+ * MAC array of mac_rows x mac_cols PEs fed by a bus moving bus_bytes per
+ * cycle. Set from the MATMUL_MAC_ARRAY (RxC, default 16x16) and
+ * MATMUL_BUS_BYTES (default 64) environment variables.
+ */
+static unsigned int mac_rows = MATMUL_MAC_ROWS;
+static unsigned int mac_cols = MATMUL_MAC_COLS;
+static unsigned int bus_bytes = MATMUL_BUS_BYTES;
+static sc_time clock_period;
+
+MURAC_AA_INIT(matrix_multiply_init) {
+    ::bus = bus;
+    clock_period = sc_time(1, SC_MS);
+
+    const char *array = getenv("MATMUL_MAC_ARRAY");
+    if (array && (sscanf(array, "%ux%u", &mac_rows, &mac_cols) != 2 || !mac_rows || !mac_cols)) {
+        printf("Invalid MATMUL_MAC_ARRAY '%s', using 16x16\n", array);
+        mac_rows = MATMUL_MAC_ROWS;
+        mac_cols = MATMUL_MAC_COLS;
+    }
+    const char *width = getenv("MATMUL_BUS_BYTES");
+    if (width && atoi(width) > 0) {
+        bus_bytes = atoi(width);
+    }
+    printf("[AA] Matrix multiply: %ux%u MAC array, %u bus bytes/cycle\n", mac_rows, mac_cols, bus_bytes);
+    return 0;
+}
+
+/*
+ * One tile of C on the output-stationary MAC array: PE (r, c) holds the
+ * accumulator of c[r][c]. Rows of A enter from the left and columns of B
+ * from the top, skewed by one cycle per row and column, so PE (r, c)
+ * multiplies a[r][p] by b[p][c] in cycle p + r + c. This is independent
+ * of the host gemm of the fast model, so check mode compares two
+ * implementations. Each accumulator adds its products in depth order, as
+ * the host gemm does, so float results are identical.
+ */
+template<class T>
+static void array_tile(unsigned int rows, unsigned int cols, unsigned int depth,
+                       const T *a, unsigned int lda, const T *b, unsigned int ldb, T *c, unsigned int ldc) {
+    std::vector<T> acc((size_t) rows * cols, T(0));
+    unsigned int steps = depth + rows + cols - 2;
+
+    for (unsigned int t = 0; t < steps; t++) {
+        for (unsigned int r = 0; r < rows && r <= t; r++) {
+            for (unsigned int col = 0; col < cols && r + col <= t; col++) {
+                unsigned int p = t - r - col;
+                if (p < depth) {
+                    acc[r * cols + col] += a[r * lda + p] * b[p * ldb + col];
+                }
+            }
+        }
+    }
+
+    for (unsigned int r = 0; r < rows; r++) {
+        memcpy(&c[r * ldc], &acc[r * cols], cols * sizeof(T));
+    }
+}
+
+/* C = A * B for a panel, one array tile at a time */
+template<class T>
+static void array_multiply(unsigned int m, unsigned int n, unsigned int k,
+                           const T *a, unsigned int lda, const T *b, unsigned int ldb, T *c, unsigned int ldc) {
+    for (unsigned int i0 = 0; i0 < m; i0 += mac_rows) {
+        unsigned int rows = m - i0 < mac_rows ? m - i0 : mac_rows;
+        for (unsigned int j0 = 0; j0 < n; j0 += mac_cols) {
+            unsigned int cols = n - j0 < mac_cols ? n - j0 : mac_cols;
+            array_tile(rows, cols, k, &a[i0 * lda], lda, &b[j0], ldb, &c[i0 * ldc + j0], ldc);
+        }
+    }
+}
+
+/* The PA passes the address of its matmul_desc */
+static int read_descriptor(unsigned long int stack, matmul_desc *d) {
+    if (bus->read(stack, (unsigned char*) d, sizeof(*d))) {
+        printf("Error reading descriptor from bus: 0x%lx\n", stack);
+        return -1;
+    }
+    if (d->type != MATMUL_INT32 && d->type != MATMUL_FLOAT) {
+        printf("Unsupported matrix element type %u\n", d->type);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Stream row panels of A and column panels of B over the bus, multiply
+ * them on the modelled MAC array and write back the matching tile of C
+ */
+template<class T>
+static int multiply_tiles(const matmul_desc &d) {
+    std::vector<T> a_panel((size_t) PANEL_ROWS * d.k);
+    std::vector<T> b_panel((size_t) d.k * PANEL_COLS);
+    std::vector<T> c_panel((size_t) PANEL_ROWS * PANEL_COLS);
+
+    for (unsigned int i0 = 0; i0 < d.m; i0 += PANEL_ROWS) {
+        unsigned int rows = d.m - i0 < PANEL_ROWS ? d.m - i0 : PANEL_ROWS;
+        unsigned long int a_addr = d.a + (unsigned long int) i0 * d.k * sizeof(T);
+        if (bus->read(a_addr, (unsigned char*) &a_panel[0], rows * d.k * sizeof(T))) {
+            printf("Error reading from bus 0x%lx\n", a_addr);
+            return -1;
+        }
+
+        for (unsigned int j0 = 0; j0 < d.n; j0 += PANEL_COLS) {
+            unsigned int cols = d.n - j0 < PANEL_COLS ? d.n - j0 : PANEL_COLS;
+            for (unsigned int p = 0; p < d.k; p++) {
+                unsigned long int b_addr = d.b + ((unsigned long int) p * d.n + j0) * sizeof(T);
+                if (bus->read(b_addr, (unsigned char*) &b_panel[p * cols], cols * sizeof(T))) {
+                    printf("Error reading from bus 0x%lx\n", b_addr);
+                    return -1;
+                }
+            }
+
+            array_multiply(rows, cols, d.k, &a_panel[0], d.k, &b_panel[0], cols, &c_panel[0], cols);
+
+            for (unsigned int i = 0; i < rows; i++) {
+                unsigned long int c_addr = d.c + ((unsigned long int) (i0 + i) * d.n + j0) * sizeof(T);
+                if (bus->write(c_addr, (unsigned char*) &c_panel[i * cols], cols * sizeof(T))) {
+                    printf("Error writing to bus 0x%lx\n", c_addr);
+                    return -1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/* Report the modelled cycles and the host wall time of one multiply */
+static unsigned long long report(const matmul_desc &d, const struct timeval &start) {
+    struct timeval end;
+    gettimeofday(&end, NULL);
+    double wall_s = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6;
+    double macs = (double) d.m * d.k * d.n;
+    unsigned long long cycles = matmul_model_cycles(&d, mac_rows, mac_cols, bus_bytes);
+
+    printf("[AA] %ux%ux%u %s: %llu cycles, %.1f%% MAC utilisation, %.3f s wall, %.3e MAC/s wall\n",
+           d.m, d.k, d.n, d.type == MATMUL_FLOAT ? "float" : "int32", cycles,
+           cycles ? 100.0 * macs / ((double) cycles * mac_rows * mac_cols) : 0.0,
+           wall_s, wall_s > 0 ? macs / wall_s : 0.0);
+    return cycles;
+}
+
+int run_matrix_multiply_simulation(unsigned long int stack) {
+
+    matmul_desc d;
+    if (read_descriptor(stack, &d) < 0) {
+        return -1;
+    }
+
+    struct timeval start;
+    gettimeofday(&start, NULL);
+
+    int r = d.type == MATMUL_FLOAT ? multiply_tiles<float>(d) : multiply_tiles<int>(d);
+    if (r < 0) {
+        return -1;
+    }
+
+    unsigned long long cycles = report(d, start);
+    wait(clock_period * (double) cycles);
+    return 1;
+}
+
+/**
+ * Host-native functional model, operating directly on mapped PA memory
+ */
+int run_matrix_multiply_fast(unsigned long int stack, unsigned long long *cycles) {
+
+    matmul_desc d;
+    if (read_descriptor(stack, &d) < 0) {
+        return -1;
+    }
+
+    struct timeval start;
+    gettimeofday(&start, NULL);
+
+    size_t esize = d.type == MATMUL_FLOAT ? sizeof(float) : sizeof(int);
+    unsigned char *a = bus->map(d.a, d.m * d.k * esize);
+    unsigned char *b = bus->map(d.b, d.k * d.n * esize);
+    unsigned char *c = bus->map(d.c, d.m * d.n * esize);
+    if (!a || !b || !c) {
+        printf("Error mapping matrices 0x%x 0x%x 0x%x\n", d.a, d.b, d.c);
+        return -1;
+    }
+
+    if (d.type == MATMUL_FLOAT) {
+        matmul_gemm_float(d.m, d.n, d.k, (const float *) a, d.k, (const float *) b, d.n, (float *) c, d.n);
+    } else {
+        matmul_gemm_int32(d.m, d.n, d.k, (const int *) a, d.k, (const int *) b, d.n, (int *) c, d.n);
+    }
+
+    *cycles = report(d, start);
+    return 1;
+}
+
+/**
+ * PA memory written by the kernel, the result matrix C
+ */
+int run_matrix_multiply_writes(unsigned long int stack, murac_range *ranges, int max) {
+
+    matmul_desc d;
+    if (read_descriptor(stack, &d) < 0 || max < 1) {
+        return -1;
+    }
+
+    size_t esize = d.type == MATMUL_FLOAT ? sizeof(float) : sizeof(int);
+    ranges[0].base = d.c;
+    ranges[0].size = (unsigned long int) d.m * d.n * esize;
+    return 1;
+}
@@ -9,30 +9,41 @@
 #include <string.h>
 
 #include "../aa/embed/matrix_multiply.h"
+#include "../aa/matmul_desc.h"
 #include "../../../framework/murac.h"
 
 #define N 3
 
+/*
+ * The matrices are row-major, as struct matmul_desc requires. The
+ * original kernel indexed them column-major, which made the printed
+ * result m2 * m1; it is now m1 * m2.
+ */
+
 int main(void) {
 
     printf("[PA] Matrix multiplication example...\n");
     
-    int *m1 = (int *) malloc(N*N*sizeof(int));//0xCF0FF000;//
-    int *m2 = (int *) malloc(N*N*sizeof(int));//0xCF0FF024;//malloc(N*N*sizeof(int));
-    int *r  = (int *) malloc(N*N*sizeof(int));//0xCF0FF048;//malloc(N*N*sizeof(int));
+    int *m1 = (int *) malloc(N*N*sizeof(int));
+    int *m2 = (int *) malloc(N*N*sizeof(int));
+    int *r  = (int *) malloc(N*N*sizeof(int));
     memset(r, 0, N*N*sizeof(int));
 
-    unsigned int* stack = (unsigned int*) malloc(N*N*sizeof(int));//0xCF0FF100;//malloc(3*sizeof(unsigned int));
-    stack[0] = (unsigned int) m1;
-    stack[1] = (unsigned int) m2;
-    stack[2] = (unsigned int) r;
+    struct matmul_desc *desc = (struct matmul_desc *) malloc(sizeof(struct matmul_desc));
+    desc->a = (unsigned int) m1;
+    desc->b = (unsigned int) m2;
+    desc->c = (unsigned int) r;
+    desc->m = N;
+    desc->k = N;
+    desc->n = N;
+    desc->type = MATMUL_INT32;
 
     for (int i = 0; i < N*N; i++) {
         m1[i] = i + 1;
         m2[i] = N - i;
     }
 
-    MURAC_SET_PTR(stack)
+    MURAC_SET_PTR(desc)
 
     EXECUTE_MATRIX_MULTIPLY
 
@@ -48,6 +59,6 @@ int main(void) {
     free(m1);
     free(m2);
     free(r);
-    free(stack);
+    free(desc);
     return 0; 
 }
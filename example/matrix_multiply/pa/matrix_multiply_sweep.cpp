@@ -0,0 +1,135 @@
+/**
+ * MURAC Test Application - Matrix Multiplication size sweep
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ * Multiplies square matrices from 16x16 up to MAX_SIZE on the PA and
+ * through the AA, and compares the results. The PA times both with
+ * clock(); the AA prints its modelled cycles and MAC utilisation.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../aa/embed/matrix_multiply.h"
+#include "../aa/matmul_desc.h"
+#include "../../../framework/murac.h"
+
+#define MIN_SIZE 16
+#define MAX_SIZE 1024
+
+static unsigned int lcg_state = 1234;
+
+static unsigned int next_random(void) {
+    lcg_state = lcg_state * 1103515245 + 12345;
+    return lcg_state >> 16;
+}
+
+void matrix_multiply(struct matmul_desc *desc) {
+    MURAC_SET_PTR(desc)
+
+    EXECUTE_MATRIX_MULTIPLY
+}
+
+/*
+ * Row-major C = A * B on the PA, i-k-j order. Each row is compared with
+ * the AA result as it is produced, so 1024x1024 fits in shared memory.
+ */
+static int pa_multiply(const int *a, const int *b, const int *c, int *row, unsigned int n) {
+    int same = 1;
+    for (unsigned int i = 0; i < n; i++) {
+        memset(row, 0, n * sizeof(int));
+        for (unsigned int p = 0; p < n; p++) {
+            int x = a[i * n + p];
+            const int *brow = &b[p * n];
+            for (unsigned int j = 0; j < n; j++) {
+                row[j] += x * brow[j];
+            }
+        }
+        same &= memcmp(row, &c[i * n], n * sizeof(int)) == 0;
+    }
+    return same;
+}
+
+/* The whole float product, accumulated in the same order as the AA */
+static int check_float(const float *a, const float *b, const float *c, unsigned int n) {
+    for (unsigned int i = 0; i < n; i++) {
+        for (unsigned int j = 0; j < n; j++) {
+            float sum = 0;
+            for (unsigned int p = 0; p < n; p++) {
+                sum += a[i * n + p] * b[p * n + j];
+            }
+            if (sum != c[i * n + j]) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+int main(void) {
+
+    printf("[PA] Matrix multiplication sweep, %d to %d...\n", MIN_SIZE, MAX_SIZE);
+
+    struct matmul_desc *desc = (struct matmul_desc *) malloc(sizeof(struct matmul_desc));
+
+    for (unsigned int n = MIN_SIZE; n <= MAX_SIZE; n *= 2) {
+        int *a   = (int *) malloc(n * n * sizeof(int));
+        int *b   = (int *) malloc(n * n * sizeof(int));
+        int *c   = (int *) malloc(n * n * sizeof(int));
+        int *row = (int *) malloc(n * sizeof(int));
+        if (!a || !b || !c || !row) {
+            printf("[PA] %ux%u: not enough shared memory, stopping\n", n, n);
+            free(a);
+            free(b);
+            free(c);
+            free(row);
+            break;
+        }
+
+        for (unsigned int i = 0; i < n * n; i++) {
+            a[i] = (int) (next_random() & 0xff) - 128;
+            b[i] = (int) (next_random() & 0xff) - 128;
+        }
+
+        desc->a = (unsigned int) a;
+        desc->b = (unsigned int) b;
+        desc->c = (unsigned int) c;
+        desc->m = desc->k = desc->n = n;
+        desc->type = MATMUL_INT32;
+
+        clock_t start = clock();
+        matrix_multiply(desc);
+        clock_t aa_ticks = clock() - start;
+
+        start = clock();
+        int same = pa_multiply(a, b, c, row, n);
+        clock_t pa_ticks = clock() - start;
+
+        /* Same inputs as float, every element checked */
+        float *fa = (float *) a;
+        float *fb = (float *) b;
+        for (unsigned int i = 0; i < n * n; i++) {
+            fa[i] = (float) a[i] / 16;
+            fb[i] = (float) b[i] / 16;
+        }
+        desc->type = MATMUL_FLOAT;
+        matrix_multiply(desc);
+        int same_float = check_float(fa, fb, (float *) c, n);
+
+        printf("[PA] %4ux%-4u PA %8ld ticks, AA %8ld ticks, int32 %s, float %s\n", n, n,
+               (long) pa_ticks, (long) aa_ticks, same ? "match" : "DIFFER", same_float ? "match" : "DIFFER");
+
+        free(a);
+        free(b);
+        free(c);
+        free(row);
+    }
+
+    printf("[PA] %ld clock ticks per second\n", (long) CLOCKS_PER_SEC);
+    printf("[PA] Example finished...\n");
+    free(desc);
+
+    return 0;
+}
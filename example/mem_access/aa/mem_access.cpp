@@ -5,8 +5,7 @@
 using std::cout;
 using std::endl;
 
-MURAC_AA_EXECUTE(example) {
+MURAC_AA_EXECUTE(mem_access) {
     cout << "[AA] Starting memory access simulation" << endl;
-    run_mem_access_simulation(stack);
-    return 1;
+    return run_mem_access_simulation(stack);
 }
\ No newline at end of file
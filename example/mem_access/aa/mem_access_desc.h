@@ -0,0 +1,52 @@
+/**
+ * MURAC Memory Access Application
+ * Benchmark descriptor, shared by the PA and AA sides
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#ifndef MEM_ACCESS_DESC_H
+#define MEM_ACCESS_DESC_H
+
+/* Access patterns */
+#define MEM_SEQUENTIAL 0x1
+#define MEM_STRIDED    0x2
+#define MEM_RANDOM     0x4
+
+/* Directions */
+#define MEM_READ       0x1
+#define MEM_WRITE      0x2
+#define MEM_COPY       0x4
+
+/*
+ * Sweeps transfer sizes from min_size to max_size (powers of two) over
+ * every selected pattern and direction. Reads come from src, writes go
+ * to dst, both buffer_size bytes of PA memory. Each point moves about
+ * bytes_per_point bytes. Up to max_results points are written to the
+ * mem_access_result array at results.
+ */
+struct mem_access_desc {
+    unsigned int src;
+    unsigned int dst;
+    unsigned int buffer_size;
+    unsigned int min_size;
+    unsigned int max_size;
+    unsigned int patterns;
+    unsigned int directions;
+    unsigned int bytes_per_point;
+    unsigned int results;
+    unsigned int max_results;
+};
+
+/* One point of the sweep. A copy counts its bytes once. */
+struct mem_access_result {
+    unsigned int size;
+    unsigned int pattern;
+    unsigned int direction;
+    unsigned int transfers;
+    unsigned int bytes;
+    unsigned int cycles;    /* modelled AA bus cycles */
+    unsigned int host_us;   /* host wall time */
+};
+
+#endif // MEM_ACCESS_DESC_H
@@ -1,28 +1,173 @@
 
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
 #include "mem_access.hpp"
+#include "mem_access_desc.h"
 #include "../../../framework/murac.h"
 
 using std::cout;
 using std::endl;
 
+/* Transfers of a strided sweep are this many transfer slots apart */
+#define STRIDE_SLOTS 17
+
 class _mem_access {
 public:
-    _mem_access(): bus(0) {  }
-    sc_signal<bool>   clock;
-    sc_signal<bool>   reset;
-    sc_signal<bool>   enable;
-    //sc_signal<sc_uint<4> > counter_out;
-    //test_counter counter;
+    _mem_access(): bus(0), bus_bytes(4), latency(4), clock_period(1, SC_MS) {  }
     BusInterface *bus;
+
+    /*
+     * AA bus transactions carry no timing, so bandwidth is modelled: a
+     * transfer takes one cycle per bus_bytes, plus latency cycles unless
+     * it continues the previous transfer.
+     */
+    unsigned int bus_bytes;
+    unsigned int latency;
+    sc_time clock_period;
 };
 
 static _mem_access mem_access;
 
+static unsigned int env_value(const char *name, unsigned int value) {
+    const char *s = getenv(name);
+    return s && atoi(s) >= 0 ? atoi(s) : value;
+}
+
 MURAC_AA_INIT(mem_access_init) {
     mem_access.bus = bus;
+    mem_access.bus_bytes = env_value("MEM_ACCESS_BUS_BYTES", mem_access.bus_bytes);
+    mem_access.latency = env_value("MEM_ACCESS_LATENCY", mem_access.latency);
+    if (!mem_access.bus_bytes) {
+        mem_access.bus_bytes = 4;
+    }
+    return 0;
+}
+
+static const char *pattern_name(unsigned int pattern) {
+    return pattern == MEM_SEQUENTIAL ? "sequential" : pattern == MEM_STRIDED ? "strided" : "random";
+}
+
+static const char *direction_name(unsigned int direction) {
+    return direction == MEM_READ ? "read" : direction == MEM_WRITE ? "write" : "copy";
+}
+
+/* Bus cycles of one transfer, tracking where the last one ended */
+static unsigned long long transfer_cycles(unsigned long int addr, unsigned int size, unsigned long int &next) {
+    unsigned long long cycles = (size + mem_access.bus_bytes - 1) / mem_access.bus_bytes;
+    if (addr != next) {
+        cycles += mem_access.latency;
+    }
+    next = addr + size;
+    return cycles;
+}
+
+/* Run one point of the sweep, returns -1 on a bus error */
+static int measure(const mem_access_desc &d, unsigned int size, unsigned int pattern, unsigned int direction,
+                   std::vector<unsigned char> &buf, mem_access_result &r) {
+    BusInterface *bus = mem_access.bus;
+    unsigned int slots = d.buffer_size / size;
+    unsigned int transfers = d.bytes_per_point / size;
+    if (!transfers) {
+        transfers = 1;
+    }
+
+    unsigned long long cycles = 0;
+    unsigned long int next_read = ~0ul, next_write = ~0ul;
+    unsigned int random = 1;
+
+    struct timeval start, end;
+    gettimeofday(&start, NULL);
+
+    for (unsigned int i = 0; i < transfers; i++) {
+        unsigned int slot;
+        if (pattern == MEM_SEQUENTIAL) {
+            slot = i % slots;
+        } else if (pattern == MEM_STRIDED) {
+            slot = (unsigned int) (((unsigned long long) i * STRIDE_SLOTS) % slots);
+        } else {
+            random = random * 1103515245 + 12345;
+            slot = (random >> 8) % slots;
+        }
+        unsigned long int offset = (unsigned long int) slot * size;
+
+        if (direction != MEM_WRITE) {
+            if (bus->read(d.src + offset, &buf[0], size)) {
+                printf("[AA] Error reading from bus 0x%lx\n", d.src + offset);
+                return -1;
+            }
+            cycles += transfer_cycles(d.src + offset, size, next_read);
+        }
+        if (direction != MEM_READ) {
+            if (bus->write(d.dst + offset, &buf[0], size)) {
+                printf("[AA] Error writing to bus 0x%lx\n", d.dst + offset);
+                return -1;
+            }
+            cycles += transfer_cycles(d.dst + offset, size, next_write);
+        }
+    }
+
+    gettimeofday(&end, NULL);
+    double wall_s = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6;
+    double bytes = (double) transfers * size;
+    double sim_s = (mem_access.clock_period * (double) cycles).to_seconds();
+
+    printf("[AA] %-10s %-5s %8u B x %7u: %12llu cycles, %10.3e B/s simulated, %10.3e B/s host\n",
+           pattern_name(pattern), direction_name(direction), size, transfers, cycles,
+           sim_s > 0 ? bytes / sim_s : 0.0, wall_s > 0 ? bytes / wall_s : 0.0);
+
+    r.size = size;
+    r.pattern = pattern;
+    r.direction = direction;
+    r.transfers = transfers;
+    r.bytes = transfers * size;
+    r.cycles = cycles;
+    r.host_us = (unsigned int) (wall_s * 1e6);
+
+    wait(mem_access.clock_period * (double) cycles);
+    return 0;
 }
 
 int run_mem_access_simulation(unsigned long int stack) {
     cout << "[AA] Executing memory access simulation" << endl;
+
+    mem_access_desc d;
+    if (mem_access.bus->read(stack, (unsigned char *) &d, sizeof(d))) {
+        printf("[AA] Error reading descriptor from bus: 0x%lx\n", stack);
+        return -1;
+    }
+    if (!d.min_size || d.min_size > d.max_size || d.max_size > d.buffer_size) {
+        printf("[AA] Invalid transfer sizes %u to %u for %u byte buffers\n", d.min_size, d.max_size, d.buffer_size);
+        return -1;
+    }
+
+    printf("[AA] Bus model: %u bytes/cycle, %u cycle latency, %u to %u byte transfers\n",
+           mem_access.bus_bytes, mem_access.latency, d.min_size, d.max_size);
+
+    std::vector<unsigned char> buf(d.max_size);
+    unsigned int count = 0;
+
+    for (unsigned int direction = MEM_READ; direction <= MEM_COPY; direction <<= 1) {
+        for (unsigned int pattern = MEM_SEQUENTIAL; pattern <= MEM_RANDOM; pattern <<= 1) {
+            if (!(d.directions & direction) || !(d.patterns & pattern)) {
+                continue;
+            }
+            for (unsigned int size = d.min_size; size && size <= d.max_size; size <<= 1) {
+                mem_access_result r;
+                if (measure(d, size, pattern, direction, buf, r) < 0) {
+                    return -1;
+                }
+                if (d.results && count < d.max_results) {
+                    unsigned long int addr = d.results + count * sizeof(r);
+                    if (mem_access.bus->write(addr, (unsigned char *) &r, sizeof(r))) {
+                        printf("[AA] Error writing to bus 0x%lx\n", addr);
+                        return -1;
+                    }
+                }
+                count++;
+            }
+        }
+    }
     return 1;
-}
\ No newline at end of file
+}
@@ -2,18 +2,85 @@
  * MURAC Memory Access Application
  * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
  *
+ * Bus bandwidth benchmark. Allocates source and destination buffers in
+ * shared memory and has the AA sweep transfer sizes, access patterns and
+ * directions over them, then prints the results as a table.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "../aa/embed/mem_access.h"
+#include "../aa/mem_access_desc.h"
 #include "../../../framework/murac.h"
 
+#define BUFFER_SIZE     (4 * 1024 * 1024)
+#define MIN_SIZE        4
+#define MAX_SIZE        (1024 * 1024)
+#define BYTES_PER_POINT (1024 * 1024)
+
+/* 19 sizes, 3 patterns, 3 directions */
+#define MAX_RESULTS     (19 * 3 * 3)
+
+void mem_access(struct mem_access_desc *desc) {
+    MURAC_SET_PTR(desc)
+
+    EXECUTE_MEM_ACCESS
+}
+
+static const char *pattern_name(unsigned int pattern) {
+    return pattern == MEM_SEQUENTIAL ? "sequential" : pattern == MEM_STRIDED ? "strided" : "random";
+}
+
+static const char *direction_name(unsigned int direction) {
+    return direction == MEM_READ ? "read" : direction == MEM_WRITE ? "write" : "copy";
+}
+
 int main(void) {
 
     printf("[PA] Starting application\n");
 
-    EXECUTE_MEM_ACCESS
+    unsigned char *src = (unsigned char *) malloc(BUFFER_SIZE);
+    unsigned char *dst = (unsigned char *) malloc(BUFFER_SIZE);
+    struct mem_access_result *results = (struct mem_access_result *) malloc(MAX_RESULTS * sizeof(struct mem_access_result));
+    struct mem_access_desc *desc = (struct mem_access_desc *) malloc(sizeof(struct mem_access_desc));
+    if (!src || !dst || !results || !desc) {
+        printf("[PA] Not enough shared memory for %d byte buffers\n", BUFFER_SIZE);
+        return 1;
+    }
+
+    for (unsigned int i = 0; i < BUFFER_SIZE; i++) {
+        src[i] = i;
+    }
+    memset(results, 0, MAX_RESULTS * sizeof(struct mem_access_result));
+
+    desc->src = (unsigned int) src;
+    desc->dst = (unsigned int) dst;
+    desc->buffer_size = BUFFER_SIZE;
+    desc->min_size = MIN_SIZE;
+    desc->max_size = MAX_SIZE;
+    desc->patterns = MEM_SEQUENTIAL | MEM_STRIDED | MEM_RANDOM;
+    desc->directions = MEM_READ | MEM_WRITE | MEM_COPY;
+    desc->bytes_per_point = BYTES_PER_POINT;
+    desc->results = (unsigned int) results;
+    desc->max_results = MAX_RESULTS;
+
+    mem_access(desc);
+
+    /* Simulated bandwidth in bytes per AA cycle, host bandwidth in MB per wall second */
+    printf("[PA] pattern    dir   size(B) transfers  B/cycle  host MB/s\n");
+    for (unsigned int i = 0; i < MAX_RESULTS && results[i].size; i++) {
+        const struct mem_access_result *r = &results[i];
+        unsigned int per_cycle = r->cycles ? (unsigned int) ((unsigned long long) r->bytes * 100 / r->cycles) : 0;
+        unsigned int host = r->host_us ? r->bytes / r->host_us : 0;
+        printf("[PA] %-10s %-5s %7u %9u %5u.%02u %10u\n", pattern_name(r->pattern), direction_name(r->direction),
+               r->size, r->transfers, per_cycle / 100, per_cycle % 100, host);
+    }
+
+    free(src);
+    free(dst);
+    free(results);
+    free(desc);
 
     printf("[PA] Terminating application\n");
     return 0; 
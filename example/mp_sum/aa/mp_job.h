@@ -0,0 +1,31 @@
+/**
+ * MURAC Test Application - Multi-core Sum
+ * Job descriptor, shared by the PA and AA sides
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#ifndef MP_JOB_H
+#define MP_JOB_H
+
+/* Cores of the largest Cortex-A9MPxN cluster */
+#define MP_MAX_CORES   4
+
+/* Words summed per job */
+#define MP_JOB_WORDS   64
+
+/*
+ * One job per PA core. The core fills data and passes the address of its
+ * job; the AA writes sum and the simulated time (us) it started and
+ * finished the job, so the PA can show how requests were serviced.
+ */
+struct mp_job {
+    unsigned int cpu;
+    unsigned int count;
+    unsigned int sum;
+    unsigned int start_us;
+    unsigned int end_us;
+    unsigned int data[MP_JOB_WORDS];
+};
+
+#endif // MP_JOB_H
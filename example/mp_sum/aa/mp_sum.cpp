@@ -0,0 +1,15 @@
+/**
+ * MURAC Test Application - Multi-core Sum
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include "mp_sum.hpp"
+#include "../../../framework/murac.h"
+
+using std::cout;
+using std::endl;
+
+MURAC_AA_EXECUTE(mp_sum) {
+    return run_mp_sum_simulation(stack);
+}
@@ -0,0 +1,4 @@
+#include <iostream>
+#include <systemc.h>
+
+int run_mp_sum_simulation(unsigned long int stack);
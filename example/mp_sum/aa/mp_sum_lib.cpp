@@ -0,0 +1,64 @@
+/**
+ * MURAC Test Application - Multi-core Sum
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <iostream>
+#include <stddef.h>
+#include <systemc.h>
+#include "../../../framework/murac.h"
+#include "mp_job.h"
+
+using std::cout;
+using std::endl;
+
+static BusInterface *bus = 0;
+
+/* The accumulator adds one word per cycle */
+static sc_time clock_period;
+
+MURAC_AA_INIT(mp_sum_init) {
+    ::bus = bus;
+    clock_period = sc_time(1, SC_US);
+    return 0;
+}
+
+/**
+ * Sum the words of the job whose address the PA passes. Jobs from
+ * different cores are serviced one at a time on the shared fabric.
+ */
+int run_mp_sum_simulation(unsigned long int stack) {
+
+    mp_job job;
+    if (bus->read(stack, (unsigned char*) &job, offsetof(mp_job, data))) {
+        printf("Error reading job from bus: 0x%lx\n", stack);
+        return -1;
+    }
+    if (job.count > MP_JOB_WORDS) {
+        printf("Invalid job word count %u\n", job.count);
+        return -1;
+    }
+    if (bus->read(stack + offsetof(mp_job, data), (unsigned char*) job.data, job.count * sizeof(unsigned int))) {
+        printf("Error reading job data from bus: 0x%lx\n", stack);
+        return -1;
+    }
+
+    job.start_us = (unsigned int) (sc_time_stamp().to_seconds() * 1e6);
+    cout << "@" << sc_time_stamp() << " [AA] Summing " << job.count << " words for core " << job.cpu << endl;
+
+    job.sum = 0;
+    for (unsigned int i = 0; i < job.count; i++) {
+        job.sum += job.data[i];
+    }
+    wait(clock_period * (double) job.count);
+    job.end_us = (unsigned int) (sc_time_stamp().to_seconds() * 1e6);
+
+    if (bus->write(stack + offsetof(mp_job, sum), (unsigned char*) &job.sum,
+                   offsetof(mp_job, data) - offsetof(mp_job, sum))) {
+        printf("Error writing job result to bus: 0x%lx\n", stack);
+        return -1;
+    }
+
+    return 1;
+}
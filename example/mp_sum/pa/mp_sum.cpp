@@ -0,0 +1,115 @@
+/**
+ * MURAC Test Application - Multi-core Sum
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ * Every core of an MPCore PA branches to the shared AA at the same time.
+ * Each core fills its own job, selected by MPIDR affinity level 0, and
+ * branches through its own BAA mailbox. The AA sums the jobs one at a
+ * time and records when it serviced each, and core 0 prints the results
+ * once every core has finished.
+ *
+ * Run with murac_sim_mp, e.g. murac_sim_mp -cores 4.
+ */
+
+#include <stdio.h>
+#include "../aa/embed/mp_sum.h"
+#include "../aa/mp_job.h"
+#include "../../../framework/murac.h"
+
+/* Secondary core stacks, 4 KB each */
+#define MP_STACK_SHIFT      12
+#define MP_STACK_WORDS      ((1 << MP_STACK_SHIFT) / 4)
+#define MP_STR(x)           #x
+#define MP_XSTR(x)          MP_STR(x)
+
+/* SCU registers, at the address in CBAR */
+#define SCU_CONFIGURATION   0x0004
+#define SCU_CPU_NUMBER_MASK 0x3
+
+/* CP15 access, in ARM encodings every core of the family accepts */
+static inline unsigned int read_cbar(void)           { unsigned int v; asm volatile("mrc p15, 4, %0, c15, c0, 0" : "=r"(v)); return v; }
+
+extern "C" {
+    volatile unsigned int mp_release;
+    unsigned int mp_stacks[MP_MAX_CORES - 1][MP_STACK_WORDS] __attribute__((aligned(8)));
+    void mp_secondary(unsigned int cpu);
+}
+
+static mp_job jobs[MP_MAX_CORES];
+static volatile unsigned int done[MP_MAX_CORES];
+
+/*
+ * ELF entry. Core 0 runs the C runtime startup; the other cores wait
+ * for main to release them, as the startup clears the bss they use, and
+ * then run mp_secondary on their own stack. WFI is emitted as a word as
+ * the cross compiler targets ARM7.
+ */
+asm(
+    "    .text\n"
+    "    .global mp_entry\n"
+    "mp_entry:\n"
+    "    mrc   p15, 0, r4, c0, c0, 5\n"
+    "    ands  r4, r4, #0xff\n"
+    "    beq   _start\n"
+    "    ldr   r1, =mp_release\n"
+    "1:  ldr   r0, [r1]\n"
+    "    cmp   r0, #0\n"
+    "    beq   1b\n"
+    "    ldr   sp, =mp_stacks\n"
+    "    add   sp, sp, r4, lsl #" MP_XSTR(MP_STACK_SHIFT) "\n"
+    "    mov   r0, r4\n"
+    "    bl    mp_secondary\n"
+    "2:  .word 0xE320F003\n"
+    "    b     2b\n"
+    "    .ltorg\n"
+);
+
+/* Fill the job of this core and branch to the AA */
+static void run_job(unsigned int cpu) {
+    mp_job *job = &jobs[cpu];
+
+    job->cpu = cpu;
+    job->count = MP_JOB_WORDS;
+    for (unsigned int i = 0; i < MP_JOB_WORDS; i++) {
+        job->data[i] = cpu * 1000 + i;
+    }
+
+    MURAC_SET_PTR(job)
+
+    EXECUTE_MP_SUM
+
+    done[cpu] = 1;
+}
+
+extern "C" void mp_secondary(unsigned int cpu) {
+    run_job(cpu);
+}
+
+int main(void) {
+
+    volatile unsigned int *scu = (volatile unsigned int *) read_cbar();
+    unsigned int cores = (scu[SCU_CONFIGURATION / 4] & SCU_CPU_NUMBER_MASK) + 1;
+
+    printf("[PA] Starting Multi-core Sum example on %u cores...\n", cores);
+    printf("[PA] Branching to another architecture from every core...\n");
+
+    mp_release = 1;
+    run_job(0);
+
+    for (unsigned int c = 0; c < cores; c++) {
+        while (!done[c]) {
+        }
+    }
+
+    int failed = 0;
+    for (unsigned int c = 0; c < cores; c++) {
+        unsigned int expected = MP_JOB_WORDS * c * 1000 + MP_JOB_WORDS * (MP_JOB_WORDS - 1) / 2;
+        printf("[PA] Core %u: sum %u (expected %u), AA from %u to %u us %s\n", c, jobs[c].sum, expected,
+               jobs[c].start_us, jobs[c].end_us, jobs[c].sum == expected ? "OK" : "FAILED");
+        failed |= jobs[c].sum != expected;
+    }
+
+    printf("[PA] Exiting from application...\n");
+
+    return failed;
+}
@@ -0,0 +1,222 @@
+/**
+ * MURAC Test Application - NEON Differential Test
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ * Runs the NEON integer data-processing instructions that the PA model can
+ * implement on whole registers over random and boundary operands, in Q and
+ * D form and with the destination overlapping either source, and prints a
+ * signature of the results and the QC flag of each. The signatures must be
+ * the same with the wideSIMD model parameter set and cleared, which
+ * compares the whole-register implementation with the per-element one.
+ *
+ * A short kernel of Q-register operations is also timed.
+ *
+ * The cross compiler targets ARM7, so NEON instructions are emitted as
+ * words, with their operands fixed in d0-d5 (q0-q2).
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#define ROUNDS          256
+#define FORMS           4
+#define KERNEL_LOOPS    100000
+
+/* Encoding of a 3 register NEON data-processing instruction, on D registers d, n and m */
+#define NEON3(U, SZ, A, B, Q, d, n, m) \
+    (0xF2000000 | ((U) << 24) | ((SZ) << 20) | ((n) << 16) | ((d) << 12) | ((A) << 8) | ((Q) << 6) | ((B) << 4) | (m))
+
+/* Other instructions, fixed on r0/r1 and d0-d5 */
+#define VLDMIA_R0_D0_D5     0xEC900B0C
+#define VSTMIA_R0_D0_D5     0xEC800B0C
+#define VMRS_R1_FPSCR       0xEEF11A10
+#define VMSR_FPSCR_R1       0xEEE11A10
+#define VMSR_FPEXC_R1       0xEEE81A10
+
+#define FPSCR_QC            (1 << 27)
+#define FPEXC_EN            (1 << 30)
+#define CPACR_CP10_CP11     (0xF << 20)
+
+#define STR(x)  #x
+#define XSTR(x) STR(x)
+
+/*
+ * Define a function that loads d0-d5 from regs, clears FPSCR, runs the
+ * instruction, stores d0-d5 back and returns FPSCR
+ */
+#define NEON_FN(NAME, ENC)                                              \
+    static unsigned int NAME(unsigned int *regs) {                      \
+        register unsigned int *r0 asm("r0") = regs;                     \
+        register unsigned int  r1 asm("r1") = 0;                        \
+        asm volatile(                                                   \
+            ".word " XSTR(VMSR_FPSCR_R1) "\n\t"                         \
+            ".word " XSTR(VLDMIA_R0_D0_D5) "\n\t"                       \
+            ".word %c2\n\t"                                             \
+            ".word " XSTR(VSTMIA_R0_D0_D5) "\n\t"                       \
+            ".word " XSTR(VMRS_R1_FPSCR) "\n\t"                         \
+            : "+r"(r1) : "r"(r0), "i"(ENC) : "memory");                 \
+        return r1;                                                      \
+    }
+
+/* Q form, D form, and Q form with the destination also the first or second source */
+#define NEON_TEST_FNS(NAME, U, SZ, A, B)                                \
+    NEON_FN(NAME##_q, NEON3(U, SZ, A, B, 1, 0, 2, 4))                   \
+    NEON_FN(NAME##_d, NEON3(U, SZ, A, B, 0, 0, 2, 4))                   \
+    NEON_FN(NAME##_n, NEON3(U, SZ, A, B, 1, 2, 2, 4))                   \
+    NEON_FN(NAME##_m, NEON3(U, SZ, A, B, 1, 4, 2, 4))
+
+#define NEON_TEST_ENTRY(NAME, U, SZ, A, B)                              \
+    { #NAME, { NAME##_q, NAME##_d, NAME##_n, NAME##_m } },
+
+/* Byte, halfword and word (and doubleword) versions of an instruction */
+#define BHW(X, NAME, U, A, B) \
+    X(NAME##8, U, 0, A, B) X(NAME##16, U, 1, A, B) X(NAME##32, U, 2, A, B)
+#define BHWD(X, NAME, U, A, B) \
+    BHW(X, NAME, U, A, B) X(NAME##64, U, 3, A, B)
+
+#define NEON_TESTS(X)                                                   \
+    BHW (X, vhadd_s,  0, 0x0, 0) BHW (X, vhadd_u,  1, 0x0, 0)           \
+    BHWD(X, vqadd_s,  0, 0x0, 1) BHWD(X, vqadd_u,  1, 0x0, 1)           \
+    BHW (X, vrhadd_s, 0, 0x1, 0) BHW (X, vrhadd_u, 1, 0x1, 0)           \
+    X(vand, 0, 0, 0x1, 1) X(vbic, 0, 1, 0x1, 1)                         \
+    X(vorr, 0, 2, 0x1, 1) X(vorn, 0, 3, 0x1, 1) X(veor, 1, 0, 0x1, 1)   \
+    BHW (X, vhsub_s,  0, 0x2, 0) BHW (X, vhsub_u,  1, 0x2, 0)           \
+    BHWD(X, vqsub_s,  0, 0x2, 1) BHWD(X, vqsub_u,  1, 0x2, 1)           \
+    BHW (X, vcgt_s,   0, 0x3, 0) BHW (X, vcgt_u,   1, 0x3, 0)           \
+    BHW (X, vcge_s,   0, 0x3, 1) BHW (X, vcge_u,   1, 0x3, 1)           \
+    BHW (X, vmax_s,   0, 0x6, 0) BHW (X, vmax_u,   1, 0x6, 0)           \
+    BHW (X, vmin_s,   0, 0x6, 1) BHW (X, vmin_u,   1, 0x6, 1)           \
+    BHWD(X, vadd_i,   0, 0x8, 0) BHWD(X, vsub_i,   1, 0x8, 0)           \
+    BHW (X, vtst_i,   0, 0x8, 1) BHW (X, vceq_i,   1, 0x8, 1)           \
+    BHW (X, vmla_i,   0, 0x9, 0) BHW (X, vmls_i,   1, 0x9, 0)           \
+    BHW (X, vmul_i,   0, 0x9, 1)
+
+NEON_TESTS(NEON_TEST_FNS)
+
+struct neon_test {
+    const char *name;
+    unsigned int (*fn[FORMS])(unsigned int *regs);
+};
+
+static const struct neon_test tests[] = {
+    NEON_TESTS(NEON_TEST_ENTRY)
+};
+
+#define TESTS (sizeof(tests) / sizeof(tests[0]))
+
+static const char *form_name[FORMS] = { "q", "d", "q vd=vn", "q vd=vm" };
+
+/* Kernel of Q-register operations: vadd.i16, vqadd.s16, vmax.s16, vand, veor, vmla.i16 */
+static void kernel(unsigned int *regs, unsigned int loops) {
+    register unsigned int *r0 asm("r0") = regs;
+    register unsigned int  r2 asm("r2") = loops;
+    asm volatile(
+        ".word " XSTR(VLDMIA_R0_D0_D5) "\n"
+        "1:\n\t"
+        ".word %c2\n\t"
+        ".word %c3\n\t"
+        ".word %c4\n\t"
+        ".word %c5\n\t"
+        ".word %c6\n\t"
+        ".word %c7\n\t"
+        "subs %0, %0, #1\n\t"
+        "bne 1b\n\t"
+        ".word " XSTR(VSTMIA_R0_D0_D5) "\n\t"
+        : "+r"(r2)
+        : "r"(r0),
+          "i"(NEON3(0, 1, 0x8, 0, 1, 0, 2, 4)),
+          "i"(NEON3(0, 1, 0x0, 1, 1, 2, 0, 4)),
+          "i"(NEON3(0, 1, 0x6, 0, 1, 4, 2, 0)),
+          "i"(NEON3(0, 0, 0x1, 1, 1, 0, 4, 2)),
+          "i"(NEON3(1, 0, 0x1, 1, 1, 2, 2, 0)),
+          "i"(NEON3(0, 1, 0x9, 0, 1, 4, 0, 2))
+        : "memory", "cc");
+}
+
+static unsigned int lcg_state = 13579;
+
+static unsigned int next_random(void) {
+    lcg_state = lcg_state * 1103515245 + 12345;
+    return lcg_state >> 8;
+}
+
+/* Random bytes, with boundary values often enough to saturate */
+static unsigned char operand_byte(void) {
+    static const unsigned char boundary[] = { 0x00, 0x01, 0x7f, 0x80, 0x81, 0xfe, 0xff };
+    unsigned int r = next_random();
+    return (r & 3) ? (unsigned char) (r >> 4) : boundary[(r >> 4) % sizeof(boundary)];
+}
+
+static unsigned int mix(unsigned int sig, unsigned int value) {
+    return (sig ^ value) * 16777619 + (sig >> 15);
+}
+
+static void enable_neon(void) {
+    unsigned int cpacr;
+    asm volatile("mrc p15, 0, %0, c1, c0, 2" : "=r"(cpacr));
+    asm volatile("mcr p15, 0, %0, c1, c0, 2" : : "r"(cpacr | CPACR_CP10_CP11) : "memory");
+    asm volatile("mcr p15, 0, %0, c7, c5, 4" : : "r"(0) : "memory");
+
+    register unsigned int r1 asm("r1") = FPEXC_EN;
+    asm volatile(".word " XSTR(VMSR_FPEXC_R1) : : "r"(r1) : "memory");
+}
+
+int main(void) {
+
+    printf("[PA] NEON differential test: %d instructions, %d rounds each\n", (int) TESTS, ROUNDS);
+
+    enable_neon();
+
+    unsigned int regs[12];
+
+    for (unsigned int t = 0; t < TESTS; t++) {
+        unsigned int sig[FORMS];
+        unsigned int qc[FORMS];
+
+        for (unsigned int form = 0; form < FORMS; form++) {
+            lcg_state = 13579 + t;
+            sig[form] = 2166136261u;
+            qc[form] = 0;
+
+            for (unsigned int r = 0; r < ROUNDS; r++) {
+                unsigned char *bytes = (unsigned char *) regs;
+                for (unsigned int i = 0; i < sizeof(regs); i++) {
+                    bytes[i] = operand_byte();
+                }
+
+                unsigned int fpscr = tests[t].fn[form](regs);
+
+                for (unsigned int i = 0; i < 12; i++) {
+                    sig[form] = mix(sig[form], regs[i]);
+                }
+                if (fpscr & FPSCR_QC) {
+                    sig[form] = mix(sig[form], 1);
+                    qc[form]++;
+                }
+            }
+        }
+
+        printf("[PA] %-10s", tests[t].name);
+        for (unsigned int form = 0; form < FORMS; form++) {
+            printf(" %s %08x/%3u", form_name[form], sig[form], qc[form]);
+        }
+        printf("\n");
+    }
+
+    for (unsigned int i = 0; i < 12; i++) {
+        regs[i] = next_random();
+    }
+    clock_t start = clock();
+    kernel(regs, KERNEL_LOOPS);
+    clock_t ticks = clock() - start;
+
+    unsigned int sig = 2166136261u;
+    for (unsigned int i = 0; i < 12; i++) {
+        sig = mix(sig, regs[i]);
+    }
+    printf("[PA] kernel: %d loops of 6 Q operations, signature %08x\n", KERNEL_LOOPS, sig);
+    printf("[PA] kernel time: %ld clock ticks (%ld per second)\n", (long) ticks, (long) CLOCKS_PER_SEC);
+    printf("[PA] Example finished...\n");
+
+    return 0;
+}
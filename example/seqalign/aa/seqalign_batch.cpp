@@ -0,0 +1,19 @@
+/**
+ * MURAC Test Application - Smith-Waterman Sequence Alignment, batched
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <iostream>
+#include <systemc.h>
+#include "../../../framework/murac.h"
+
+using std::cout;
+using std::endl;
+
+extern int run_seqalign_batch_simulation(unsigned long int stack);
+
+MURAC_AA_EXECUTE(seqalign_batch) {
+    cout << "[AA] Running Sequence Alignment batch AA simulation" << endl;
+    return run_seqalign_batch_simulation(stack);
+}
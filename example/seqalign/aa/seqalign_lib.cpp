@@ -18,20 +18,37 @@
  */
 #define SC_INCLUDE_DYNAMIC_PROCESSES
 #include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
 #include <systemc.h>
 #include "../../../framework/murac.h"
 
 #include "sw_gen_affine.h"
+#include "sw_array_affine.h"
 
-#define LOG_LEN 3
-#define LEN 4
+#define LOG_LEN 6
+#define LEN 48
 #define SCORE_WIDTH 11
 
+/* Scores are offset by the PEs' neutral score */
+#define NEUTRAL_SCORE 1024
+
 #define N_A 0        //nucleotide "A"
 #define N_G 1        //nucleotide "G"
 #define N_T 2        //nucleotide "T"
 #define N_C 3        //nucleotide "C"
 
+/*
+ * Packed sequences hold four 2-bit nucleotides per byte, nucleotide k in
+ * bits 2*(k%4)+1:2*(k%4) of byte k/4. Shared with pa/seqalign_scan.cpp.
+ */
+#define PACKED_NT(buf, k) (((buf)[(k) >> 2] >> (((k) & 3) * 2)) & 3)
+
+/* Bytes of packed database moved per bus burst */
+#define SCAN_CHUNK 4096
+
 #define WAIT_CYCLES(x) for (int i = 0; i < x; i++) wait(invoker->seqalign_clock.posedge_event());
 
 class seqalign_invoker {
@@ -42,26 +59,37 @@ public:
     sc_signal<bool> reset;
     sc_signal<sc_uint<LOG_LEN> > query_length;
     sc_signal<bool> local;
-    sc_signal<sc_uint<(LEN * 2)> > query;
+    sc_signal<sc_biguint<(LEN * 2)> > query;
     sc_signal<bool> input_valid;
     sc_signal<sc_uint<2> > data;
     sc_signal<bool> output_valid;
     sc_signal<sc_uint<(SCORE_WIDTH)> > result;
 
     sw_gen_affine<LOG_LEN,LEN>* seq_obj;
+    sw_array_affine<LOG_LEN,LEN>* array_obj;
 
-    seqalign_invoker(): seqalign_clock("seqalign_clock", 1, SC_MS) {
+    seqalign_invoker(bool array): seqalign_clock("seqalign_clock", 1, SC_MS), seq_obj(0), array_obj(0) {
 
-        seq_obj = new sw_gen_affine<LOG_LEN,LEN>("seqalign");
-        seq_obj->clk(seqalign_clock);
-        seq_obj->rst(reset);
-        seq_obj->i_query_length(query_length);
-        seq_obj->i_local(local);
-        seq_obj->query(query);
-        seq_obj->i_vld(input_valid);
-        seq_obj->i_data(data);
-        seq_obj->o_vld(output_valid);
-        seq_obj->m_result(result);
+        if (array) {
+            array_obj = new sw_array_affine<LOG_LEN,LEN>("seqalign");
+            bind(array_obj);
+        } else {
+            seq_obj = new sw_gen_affine<LOG_LEN,LEN>("seqalign");
+            bind(seq_obj);
+        }
+    }
+
+private:
+    template<class MODEL> void bind(MODEL *obj) {
+        obj->clk(seqalign_clock);
+        obj->rst(reset);
+        obj->i_query_length(query_length);
+        obj->i_local(local);
+        obj->query(query);
+        obj->i_vld(input_valid);
+        obj->i_data(data);
+        obj->o_vld(output_valid);
+        obj->m_result(result);
     }
 };
 
@@ -71,52 +99,192 @@ static seqalign_invoker* invoker;
 MURAC_AA_INIT(seqalign) {
     printf("[AA] Initialising Sequence Alignment example\n");
     ::bus = bus;
-    ::invoker = new seqalign_invoker();
+
+    /* PE array model, from the SEQALIGN_MODEL environment variable */
+    bool array = false;
+    const char *selected = getenv("SEQALIGN_MODEL");
+    if (selected && strcmp(selected, "array") == 0) {
+        array = true;
+    } else if (selected && strcmp(selected, "rtl") != 0) {
+        printf("Unknown SEQALIGN_MODEL '%s', using rtl\n", selected);
+    }
+    ::invoker = new seqalign_invoker(array);
     return 0;
 }
 
-unsigned char do_sequence() {
+/* Sequential reader over a packed sequence in PA memory, fetched in bursts */
+class packed_reader {
 
-    printf("[AA] Starting Sequence Alignment\n");
-    invoker->reset.write(0);
+public:
+    packed_reader(unsigned long int addr, unsigned long long nucleotides) {
+        open(addr, nucleotides);
+    }
+
+    void open(unsigned long int addr, unsigned long long nucleotides) {
+        base = addr;
+        size = (nucleotides + 3) >> 2;
+        chunk_start = 0;
+        chunk_len = 0;
+    }
+
+    bool covers(unsigned long int addr, unsigned long long nucleotides) const {
+        return addr == base && ((nucleotides + 3) >> 2) == size;
+    }
+
+    /* Nucleotide at index, or -1 on a bus error */
+    int get(unsigned long long index) {
+        unsigned long long byte = index >> 2;
+        if (byte < chunk_start || byte >= chunk_start + chunk_len) {
+            chunk_start = byte;
+            chunk_len = size - byte < SCAN_CHUNK ? size - byte : SCAN_CHUNK;
+            if (bus->read(base + byte, chunk, chunk_len)) {
+                printf("[AA] Error reading fom bus 0x%llx\n", base + byte);
+                chunk_len = 0;
+                return -1;
+            }
+        }
+        return (chunk[byte - chunk_start] >> ((index & 3) * 2)) & 3;
+    }
+
+private:
+    unsigned long long base;
+    unsigned long long size;
+    unsigned long long chunk_start;
+    unsigned int       chunk_len;
+    unsigned char      chunk[SCAN_CHUNK];
+};
+
+/* Load a query of qlen nucleotides into the PEs */
+static void load_query(const unsigned char *packed, unsigned int qlen) {
+    sc_biguint<(LEN * 2)> q = 0;
+    for (unsigned int i = 0; i < qlen; i++) {
+        q.range(i*2+1, i*2) = PACKED_NT(packed, i);
+    }
+    invoker->query = q;
+    invoker->query_length = qlen - 1;
+    invoker->local = 1;
+}
+
+/* One local alignment of a packed query against part of a packed subject */
+struct align_job {
+    const unsigned char *query;
+    unsigned int         qlen;
+    unsigned long int    subject;       /* PA address of the packed subject */
+    unsigned long long   subject_size;  /* nucleotides readable at subject */
+    unsigned long long   start;
+    unsigned int         length;
+
+    /* Filled in by align_jobs */
+    unsigned long long   first_cycle;
+    unsigned int         best;
+    unsigned int         best_end;
+
+    int score() const { return best - NEUTRAL_SCORE; }
+    unsigned long long last_read() const { return first_cycle + length - 1 + qlen; }
+};
+
+static bool same_query(const align_job &a, const align_job &b) {
+    if (a.qlen != b.qlen) {
+        return false;
+    }
+    for (unsigned int i = 0; i < a.qlen; i++) {
+        if (PACKED_NT(a.query, i) != PACKED_NT(b.query, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Clock the array once and credit m_result to the job it belongs to.
+ *
+ * The value of m_result read just after edge t is the array state after
+ * edge t-1. Subject column j of a job whose first nucleotide went in on
+ * cycle t0 reaches m_result at the read of cycle t0 + j + qlen, so the
+ * job is read from t0 + qlen to t0 + length - 1 + qlen. Reads outside
+ * those windows see a draining or resetting array and are ignored.
+ */
+static void align_cycle(align_job *jobs, unsigned int &done, unsigned int started, unsigned long long &cycle) {
     WAIT_CYCLES(1)
-    printf("[AA] Reseting PEs\n");
-    invoker->reset.write(1);
-    invoker->input_valid.write(0);
-    invoker->data.write(0);
-    invoker->local.write(1);
-    WAIT_CYCLES(2)
-    invoker->reset.write(0);
-    WAIT_CYCLES(10)
-    printf("[AA] Writing data\n");
-    invoker->data = N_G;
-    invoker->input_valid = 1;
-    
-    WAIT_CYCLES(2)
-    invoker->data = N_G;
-    WAIT_CYCLES(2)
-    invoker->data = N_G;
-    WAIT_CYCLES(2)
-    invoker->data = N_C;
-
-    WAIT_CYCLES(2)
-
-    printf("[AA] Waiting for result\n");
-    invoker->input_valid = 0;
-    WAIT_CYCLES(20)
 
-    int timeout = 20;
-    while (timeout > 0 && invoker->output_valid.read() > 0) {
-        WAIT_CYCLES(1)
-        timeout--;
+    unsigned int value = invoker->result.read();
+    for (unsigned int n = done; n < started; n++) {
+        align_job &job = jobs[n];
+        if (cycle >= job.first_cycle + job.qlen && cycle <= job.last_read() && value > job.best) {
+            job.best = value;
+            job.best_end = cycle - job.first_cycle - job.qlen;
+        }
+    }
+    while (done < started && cycle >= jobs[done].last_read()) {
+        done++;
     }
+    cycle++;
+}
+
+/*
+ * Run jobs through the array back to back, one nucleotide per clock.
+ *
+ * The reset before each job is sent down the array right behind the
+ * previous job's last nucleotide, so it overlaps that job's drain. A job
+ * with the same query as the one before follows the reset directly. A
+ * new query is loaded once the previous job's last column has passed
+ * the active PEs. Once the last job has been read the array must have
+ * drained. Returns the number of cycles used, or -1 on a bus error or if
+ * the array did not drain.
+ */
+static long long align_jobs(align_job *jobs, unsigned int count) {
+    packed_reader reader(0, 0);
+    unsigned long long cycle = 0;
+    unsigned int done = 0;
 
-    if (timeout <= 0) {
-        printf("[AA] Error, sequence did not complete...\n");
-        return 0;
+    for (unsigned int n = 0; n < count; n++) {
+        align_job &job = jobs[n];
+        job.best = NEUTRAL_SCORE;
+        job.best_end = 0;
+
+        invoker->input_valid = 0;
+        invoker->data = 0;
+        invoker->reset = 1;
+        align_cycle(jobs, done, n, cycle);
+        align_cycle(jobs, done, n, cycle);
+        invoker->reset = 0;
+        align_cycle(jobs, done, n, cycle);
+
+        if (n == 0 || !same_query(jobs[n - 1], job)) {
+            while (done < n) {
+                align_cycle(jobs, done, n, cycle);
+            }
+            load_query(job.query, job.qlen);
+        }
+
+        if (!reader.covers(job.subject, job.subject_size)) {
+            reader.open(job.subject, job.subject_size);
+        }
+
+        job.first_cycle = cycle;
+        for (unsigned int k = 0; k < job.length; k++) {
+            int nt = reader.get(job.start + k);
+            if (nt < 0) {
+                return -1;
+            }
+            invoker->data = nt;
+            invoker->input_valid = 1;
+            align_cycle(jobs, done, n + 1, cycle);
+        }
+    }
+
+    invoker->input_valid = 0;
+    while (done < count) {
+        align_cycle(jobs, done, count, cycle);
     }
 
-    return invoker->result.read();
+    /* One cycle past the last read, the last column has left the array */
+    align_cycle(jobs, done, count, cycle);
+    if (invoker->output_valid.read()) {
+        printf("[AA] Error, array did not drain\n");
+        return -1;
+    }
+    return cycle;
 }
 
 #define NUMBER_OF_INPUT_VARS 2
@@ -127,17 +295,28 @@ int run_seqalign_simulation(unsigned long int stack) {
     unsigned int variables[NUMBER_OF_INPUT_VARS];
     printf("[AA] Reading addresses from bus at 0x%x\n", stack);
     if (bus->read(stack, (unsigned char*) variables, NUMBER_OF_INPUT_VARS*sizeof(unsigned int))) {
-        printf("[AA] Error reading fom bus 0x%x\n", stack);
+        printf("[AA] Error reading fom bus 0x%lx\n", stack);
         return -1;
     }
     for (int i = 0; i < NUMBER_OF_INPUT_VARS; i++) {
         printf("[AA]    Memory address[%d] = 0x%x\n", i, variables[i]);
     }
 
-    invoker->query_length = LOG_LEN;
-    invoker->query = (N_G, N_C, N_C, N_C);
+    /* Query GCCC against the packed 4 nucleotide subject filled in by the PA */
+    unsigned char query = N_G | (N_C << 2) | (N_C << 4) | (N_C << 6);
 
-    unsigned char result = do_sequence();
+    printf("[AA] Starting Sequence Alignment\n");
+    align_job job;
+    job.query = &query;
+    job.qlen = 4;
+    job.subject = variables[0];
+    job.subject_size = 4;
+    job.start = 0;
+    job.length = 4;
+    if (align_jobs(&job, 1) < 0) {
+        return -1;
+    }
+    unsigned char result = job.score();
 
     /* Output */
     if (bus->write(variables[1], &result, 1)) {
@@ -146,3 +325,160 @@ int run_seqalign_simulation(unsigned long int stack) {
     } 
     return 0;
 }
+
+/*
+ * Database scan
+ *
+ * stack[0] packed query, stack[1] query length in nucleotides (1 to LEN),
+ * stack[2] packed database, stack[3] record table of count + 1 start
+ * offsets in nucleotides, stack[4] record count, stack[5] results, two
+ * words per record: best local score and end position within the record.
+ */
+int run_seqalign_scan_simulation(unsigned long int stack) {
+
+    unsigned int variables[6];
+    if (bus->read(stack, (unsigned char*) variables, 6*sizeof(unsigned int))) {
+        printf("[AA] Error reading fom bus 0x%lx\n", stack);
+        return -1;
+    }
+
+    unsigned int qlen = variables[1];
+    unsigned int count = variables[4];
+    if (qlen < 1 || qlen > LEN) {
+        printf("[AA] Query length %u not supported, array has %d PEs\n", qlen, LEN);
+        return -1;
+    }
+
+    unsigned char query[(LEN + 3) / 4];
+    std::vector<unsigned int> offsets(count + 1);
+    if (bus->read(variables[0], query, (qlen + 3) / 4) ||
+        bus->read(variables[3], (unsigned char*) &offsets[0], (count + 1) * sizeof(unsigned int))) {
+        printf("[AA] Error reading query or record table\n");
+        return -1;
+    }
+
+    struct timeval wall_start, wall_end;
+    gettimeofday(&wall_start, NULL);
+    sc_time sim_start = sc_time_stamp();
+
+    /* Records share the query, so each follows the one before through the array */
+    std::vector<align_job> jobs(count);
+    unsigned long long nucleotides = 0;
+    for (unsigned int r = 0; r < count; r++) {
+        jobs[r].query = query;
+        jobs[r].qlen = qlen;
+        jobs[r].subject = variables[2];
+        jobs[r].subject_size = offsets[count];
+        jobs[r].start = offsets[r];
+        jobs[r].length = offsets[r + 1] - offsets[r];
+        nucleotides += jobs[r].length;
+    }
+    if (count && align_jobs(&jobs[0], count) < 0) {
+        return -1;
+    }
+
+    std::vector<unsigned int> results(2 * count);
+    for (unsigned int r = 0; r < count; r++) {
+        results[2*r] = jobs[r].score();
+        results[2*r + 1] = jobs[r].best_end;
+    }
+
+    if (count && bus->write(variables[5], (unsigned char*) &results[0], 2 * count * sizeof(unsigned int))) {
+        printf("[AA] Error writing to bus 0x%x\n", variables[5]);
+        return -1;
+    }
+
+    gettimeofday(&wall_end, NULL);
+    double wall_s = (wall_end.tv_sec - wall_start.tv_sec) + (wall_end.tv_usec - wall_start.tv_usec) / 1e6;
+    double sim_s  = (sc_time_stamp() - sim_start).to_seconds();
+    double cells  = (double) nucleotides * qlen;
+
+    printf("[AA] Scanned %u records, %llu nucleotides, %.0f cells\n", count, nucleotides, cells);
+    printf("[AA]   %.3f s wall, %.3e CUPS wall, %.3e CUPS simulated\n",
+           wall_s, wall_s > 0 ? cells / wall_s : 0.0, sim_s > 0 ? cells / sim_s : 0.0);
+    return 1;
+}
+
+/* Alignments and wall time since the last batch report */
+static unsigned long long batch_alignments = 0;
+static unsigned int batch_calls = 0;
+static struct timeval batch_start;
+
+/*
+ * Batched alignment
+ *
+ * stack[0] job table, four words per job: packed query, query length
+ * (1 to LEN), packed subject, subject length in nucleotides. stack[1]
+ * job count, stack[2] results, two words per job: best local score and
+ * end position within the subject. When stack[3] is set, the calls and
+ * alignments since the previous report are printed with the wall time
+ * between them, which includes the BrArch/RetArch cost of every call.
+ */
+int run_seqalign_batch_simulation(unsigned long int stack) {
+
+    unsigned int variables[4];
+    if (bus->read(stack, (unsigned char*) variables, 4*sizeof(unsigned int))) {
+        printf("[AA] Error reading fom bus 0x%lx\n", stack);
+        return -1;
+    }
+
+    if (batch_calls == 0) {
+        gettimeofday(&batch_start, NULL);
+    }
+
+    unsigned int count = variables[1];
+    std::vector<unsigned int> table(4 * count);
+    if (count && bus->read(variables[0], (unsigned char*) &table[0], 4 * count * sizeof(unsigned int))) {
+        printf("[AA] Error reading job table from bus 0x%x\n", variables[0]);
+        return -1;
+    }
+
+    std::vector<unsigned char> queries(count * ((LEN + 3) / 4));
+    std::vector<align_job> jobs(count);
+    for (unsigned int n = 0; n < count; n++) {
+        align_job &job = jobs[n];
+        job.query = &queries[n * ((LEN + 3) / 4)];
+        job.qlen = table[4*n + 1];
+        job.subject = table[4*n + 2];
+        job.subject_size = table[4*n + 3];
+        job.start = 0;
+        job.length = table[4*n + 3];
+        if (job.qlen < 1 || job.qlen > LEN) {
+            printf("[AA] Job %u: query length %u not supported, array has %d PEs\n", n, job.qlen, LEN);
+            return -1;
+        }
+        if (bus->read(table[4*n], &queries[n * ((LEN + 3) / 4)], (job.qlen + 3) / 4)) {
+            printf("[AA] Error reading query from bus 0x%x\n", table[4*n]);
+            return -1;
+        }
+    }
+
+    long long cycles = count ? align_jobs(&jobs[0], count) : 0;
+    if (cycles < 0) {
+        return -1;
+    }
+
+    std::vector<unsigned int> results(2 * count);
+    for (unsigned int n = 0; n < count; n++) {
+        results[2*n] = jobs[n].score();
+        results[2*n + 1] = jobs[n].best_end;
+    }
+    if (count && bus->write(variables[2], (unsigned char*) &results[0], 2 * count * sizeof(unsigned int))) {
+        printf("[AA] Error writing to bus 0x%x\n", variables[2]);
+        return -1;
+    }
+
+    batch_alignments += count;
+    batch_calls++;
+
+    if (variables[3]) {
+        struct timeval now;
+        gettimeofday(&now, NULL);
+        double wall_s = (now.tv_sec - batch_start.tv_sec) + (now.tv_usec - batch_start.tv_usec) / 1e6;
+        printf("[AA] %llu alignments in %u calls, %.3f s wall, %.1f alignments/s wall\n",
+               batch_alignments, batch_calls, wall_s, wall_s > 0 ? batch_alignments / wall_s : 0.0);
+        batch_alignments = 0;
+        batch_calls = 0;
+    }
+    return 1;
+}
@@ -0,0 +1,225 @@
+/**
+ * MURAC Test Application - Smith-Waterman Sequence Alignment
+ * Single-process model of the sw_gen_affine PE array
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#ifndef SW_ARRAY_AFFINE_H
+#define SW_ARRAY_AFFINE_H
+
+#include <string.h>
+#include <stdint.h>
+#include "systemc.h"
+
+/* Eight 16-bit PE lanes, through the GCC vector extension */
+typedef uint16_t sw_lanes __attribute__((vector_size(16)));
+
+/*
+ * Same ports and cycle behaviour as sw_gen_affine, but the registers of
+ * all PEs are held as structure-of-arrays state and every PE is
+ * evaluated by one method per clock edge, eight PEs per host vector.
+ * The arrays are padded to a whole number of vectors; the padding lanes
+ * are computed but never feed a real PE. o_vld and m_result follow the
+ * registers of PE i_query_length.
+ */
+template<unsigned LOGLENGTH = 6, unsigned LENGTH = 48>
+SC_MODULE(sw_array_affine)
+{
+    static const unsigned SCORE_WIDTH = 11;
+    static const uint16_t SCORE_MASK = (1 << SCORE_WIDTH) - 1;
+    static const uint16_t NEUTRAL = 1024;
+    static const uint16_t MATCH = 5;
+    static const uint16_t MISMATCH = 0x7fc;
+    static const uint16_t GOPEN = 12;
+    static const uint16_t GEXT = 4;
+
+    static const unsigned LANES = sizeof(sw_lanes) / sizeof(uint16_t);
+    static const unsigned PADDED = (LENGTH + LANES - 1) / LANES * LANES;
+
+    sc_in<bool>	clk;
+    sc_in<bool>	rst;
+    sc_in<sc_uint<LOGLENGTH> >	i_query_length;
+    sc_in<bool>	i_local;
+    sc_in<sc_biguint<(LENGTH * 2)> > query;
+    sc_in<bool>	i_vld;
+    sc_in<sc_uint<2> >	i_data;
+    sc_out<bool>	o_vld;
+    sc_out<sc_uint<SCORE_WIDTH> >	m_result;
+
+    SC_CTOR(sw_array_affine) {
+        memset(rst_q, 0, sizeof(rst_q));
+        memset(vld_q, 0, sizeof(vld_q));
+        memset(high, 0, sizeof(high));
+        memset(right_m, 0, sizeof(right_m));
+        memset(right_i, 0, sizeof(right_i));
+        memset(data, 0, sizeof(data));
+        memset(diag_m, 0, sizeof(diag_m));
+        memset(diag_i, 0, sizeof(diag_i));
+        memset(state, 0, sizeof(state));
+        memset(preload, 0, sizeof(preload));
+        memset(start, 0, sizeof(start));
+        start[0] = 1;
+        memset(in_rst, 0, sizeof(in_rst));
+        memset(in_vld, 0, sizeof(in_vld));
+        memset(in_data, 0, sizeof(in_data));
+        memset(in_high, 0, sizeof(in_high));
+        memset(in_m, 0, sizeof(in_m));
+        memset(in_i, 0, sizeof(in_i));
+
+        SC_METHOD(clock_process);
+        sensitive << clk.pos();
+
+        SC_METHOD(output_process);
+        sensitive << i_local << i_query_length;
+
+        SC_METHOD(query_process);
+        sensitive << query;
+    }
+
+private:
+    /* PE registers, index i is sw_pe_affine i */
+    uint16_t rst_q[PADDED];
+    uint16_t vld_q[PADDED];
+    uint16_t high[PADDED];
+    uint16_t right_m[PADDED];
+    uint16_t right_i[PADDED];
+    uint16_t data[PADDED];
+    uint16_t diag_m[PADDED];
+    uint16_t diag_i[PADDED];
+    uint16_t state[PADDED];
+
+    uint16_t preload[PADDED];
+    uint16_t start[PADDED];
+
+    /* Inputs of each PE for this edge: the ports for PE 0, PE i-1's registers otherwise */
+    uint16_t in_rst[PADDED];
+    uint16_t in_vld[PADDED];
+    uint16_t in_data[PADDED];
+    uint16_t in_high[PADDED];
+    uint16_t in_m[PADDED];
+    uint16_t in_i[PADDED];
+
+    static uint16_t max16(uint16_t a, uint16_t b) {
+        return a > b ? a : b;
+    }
+
+    static sw_lanes splat(uint16_t x) {
+        sw_lanes v = { x, x, x, x, x, x, x, x };
+        return v;
+    }
+
+    static sw_lanes load(const uint16_t *p) {
+        sw_lanes v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    static void store(uint16_t *p, sw_lanes v) {
+        memcpy(p, &v, sizeof(v));
+    }
+
+    /* Lanes of a where mask is set, of b elsewhere; masks are all ones or zero per lane */
+    static sw_lanes select(sw_lanes mask, sw_lanes a, sw_lanes b) {
+        return (a & mask) | (b & ~mask);
+    }
+
+    static sw_lanes vmax(sw_lanes a, sw_lanes b) {
+        return select((sw_lanes) (a > b), a, b);
+    }
+
+    void query_process() {
+        sc_biguint<(LENGTH * 2)> q = query.read();
+        for (unsigned i = 0; i < LENGTH; i++) {
+            preload[i] = q.range(i*2+1, i*2).to_uint();
+        }
+    }
+
+    void output_process() {
+        unsigned q = i_query_length.read();
+        o_vld = vld_q[q] != 0;
+        if (i_local.read()) {
+            m_result = high[q];
+        } else {
+            m_result = max16(right_m[q], right_i[q]);
+        }
+    }
+
+    void clock_process() {
+        in_rst[0]  = rst.read();
+        in_vld[0]  = i_vld.read();
+        in_data[0] = i_data.read();
+        in_high[0] = 0;
+        in_m[0]    = NEUTRAL;
+        in_i[0]    = NEUTRAL;
+        memcpy(&in_rst[1],  rst_q,   (LENGTH - 1) * sizeof(uint16_t));
+        memcpy(&in_vld[1],  vld_q,   (LENGTH - 1) * sizeof(uint16_t));
+        memcpy(&in_data[1], data,    (LENGTH - 1) * sizeof(uint16_t));
+        memcpy(&in_high[1], high,    (LENGTH - 1) * sizeof(uint16_t));
+        memcpy(&in_m[1],    right_m, (LENGTH - 1) * sizeof(uint16_t));
+        memcpy(&in_i[1],    right_i, (LENGTH - 1) * sizeof(uint16_t));
+
+        const sw_lanes zero     = splat(0);
+        const sw_lanes one      = splat(1);
+        const sw_lanes mask     = splat(SCORE_MASK);
+        const sw_lanes neutral  = splat(NEUTRAL);
+        const sw_lanes gopen    = splat(GOPEN);
+        const sw_lanes gext     = splat(GEXT);
+        const sw_lanes local    = splat(i_local.read() ? 0xffff : 0);
+
+        for (unsigned i = 0; i < PADDED; i += LANES) {
+            sw_lanes st     = (sw_lanes) (load(&start[i]) != zero);
+            sw_lanes dm     = load(&diag_m[i]);
+            sw_lanes di     = load(&diag_i[i]);
+            sw_lanes rm     = load(&right_m[i]);
+            sw_lanes ri     = load(&right_i[i]);
+            sw_lanes hi     = load(&high[i]);
+            sw_lanes sta    = load(&state[i]);
+            sw_lanes dat    = load(&data[i]);
+            sw_lanes im     = load(&in_m[i]);
+            sw_lanes ii     = load(&in_i[i]);
+            sw_lanes idata  = load(&in_data[i]);
+            sw_lanes ivld   = (sw_lanes) (load(&in_vld[i]) != zero);
+
+            /* Combinational scores, as the assign processes of sw_pe_affine */
+            sw_lanes match      = select((sw_lanes) (idata == load(&preload[i])), splat(MATCH), splat(MISMATCH));
+            sw_lanes start_left = (dm - select((sw_lanes) (sta == one), gopen, gext)) & mask;
+            sw_lanes left_max   = select(st, start_left, vmax((im - gopen) & mask, (ii - gext) & mask));
+            sw_lanes up_max     = vmax((rm - gopen) & mask, (ri - gext) & mask);
+            sw_lanes m_nxt      = (match + vmax(dm, di)) & mask;
+            sw_lanes i_nxt      = vmax(left_max, up_max);
+            sw_lanes rightmax   = vmax(m_nxt, i_nxt);
+
+            sw_lanes r   = (sw_lanes) (load(&in_rst[i]) != zero);
+            sw_lanes v   = ivld & ~r;
+            sw_lanes gap = select(st, gopen, gext);
+
+            /* Registers */
+            sw_lanes high_v  = vmax(vmax(hi, rightmax), load(&in_high[i]));
+            sw_lanes m_v     = select(local, vmax(m_nxt, neutral), m_nxt);
+            sw_lanes i_v     = select(local, vmax(i_nxt, neutral), i_nxt);
+            sw_lanes dm_v    = select(st, select(local, neutral, (dm - gext) & mask), im);
+            sw_lanes di_v    = select(st, select(local, neutral, (di - gext) & mask), ii);
+            sw_lanes m_r     = select(local, neutral, (im - gap) & mask);
+            sw_lanes i_r     = select(local, neutral, (ii - gap) & mask);
+            sw_lanes dm_r    = select(st | local, neutral, im);
+            sw_lanes di_r    = select(st | local, neutral, ii);
+            sw_lanes state_v = select((sw_lanes) (sta == zero), one,
+                               select((sw_lanes) (sta == splat(3)), splat(3), select(ivld, splat(2), one)));
+
+            store(&high[i],    select(r, neutral, select(v, high_v, hi)));
+            store(&right_m[i], select(r, m_r, select(v, m_v, rm)));
+            store(&right_i[i], select(r, i_r, select(v, i_v, ri)));
+            store(&diag_m[i],  select(r, dm_r, select(v, dm_v, dm)));
+            store(&diag_i[i],  select(r, di_r, select(v, di_v, di)));
+            store(&data[i],    select(r, zero, select(v, idata, dat)));
+            store(&state[i],   select(r, zero, state_v));
+            store(&vld_q[i],   v & one);
+            store(&rst_q[i],   r & one);
+        }
+
+        output_process();
+    }
+};
+
+#endif // SW_ARRAY_AFFINE_H
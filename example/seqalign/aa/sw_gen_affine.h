@@ -33,20 +33,17 @@ SC_MODULE(sw_gen_affine)
 	sc_in<bool>	rst;
 	sc_in<sc_uint<LOGLENGTH> >	i_query_length;
 	sc_in<bool>	i_local;
-	sc_in<sc_uint<(LENGTH * 2)> > query;
+	sc_in<sc_biguint<(LENGTH * 2)> > query;
 	sc_in<bool>	i_vld;
 	sc_in<sc_uint<2> >	i_data;
 	sc_out<bool>	o_vld;
 	sc_out<sc_uint<SCORE_WIDTH> >	m_result;
 
 	//Internal Signals...
-	sc_signal<sc_uint<(2 * (LENGTH - 1)) + 1 + 1> >	data;
 	sc_signal<bool>	vld[LENGTH];
 	sc_signal<sc_uint<SCORE_WIDTH> >	right_m[LENGTH];
 	sc_signal<sc_uint<SCORE_WIDTH> >	right_i[LENGTH];
 	sc_signal<sc_uint<SCORE_WIDTH> >	high_score[LENGTH];
-	sc_signal<sc_uint<LENGTH> >	gap;
-	sc_signal<sc_uint<LENGTH> >	reset;
 
 	//Processes Declaration...
 	void assign_process_o_vld_50();
@@ -65,17 +62,12 @@ SC_MODULE(sw_gen_affine)
 	sc_signal<bool> ZERO_SUPPLY;
 
 	//Signal Handler...
+	//reset_l and data_l are driven by the PEs, each PE taking its
+	//reset and nucleotide from the one before it
 	void signal_handler()
 	{
 		for (int i=0; i < LENGTH; i = i + 1) {
-			reset_l[i] = reset.read()[i];
-			query_l[i] = query.read().range(i*2+1,i*2);
-
-			if (i == 0) {
-				data_l[i] = i_data.read().range(1,0);
-			} else {
-				data_l[i] = data.read().range(2*(i-1)+1,(i-1)*2);
-			}
+			query_l[i] = query.read().range(i*2+1,i*2).to_uint();
 		}
 		
 		BINARY_10000000000 = 1024;
@@ -89,9 +81,15 @@ SC_MODULE(sw_gen_affine)
 
 		SC_METHOD(assign_process_o_vld_50);
 		sensitive << i_query_length;
+		for (int i=0; i < LENGTH; i = i + 1) {
+			sensitive << vld[i];
+		}
 
 		SC_METHOD(assign_process_m_result_51);
 		sensitive << i_local << i_query_length;
+		for (int i=0; i < LENGTH; i = i + 1) {
+			sensitive << high_score[i] << right_m[i] << right_i[i];
+		}
 
 		char *name[LENGTH];
 		for (int i=0; i < LENGTH; i = i + 1) {
@@ -109,7 +107,7 @@ SC_MODULE(sw_gen_affine)
 				pe_block[i]->start(ONE_SUPPLY);
 			} else {
 				pe_block[i]->i_rst(reset_l[i-1]);
-				pe_block[i]->i_data(data_l[i]);
+				pe_block[i]->i_data(data_l[i-1]);
 				pe_block[i]->i_left_m(right_m[i-1]);
 				pe_block[i]->i_left_i(right_i[i-1]);
 				pe_block[i]->i_vld(vld[i-1]);
@@ -129,7 +127,7 @@ SC_MODULE(sw_gen_affine)
 		}
 
 		SC_METHOD(signal_handler);
-		sensitive << reset << query << data;
+		sensitive << query;
 	}
 };
 
@@ -0,0 +1,166 @@
+/**
+ * MURAC Test Application - Smith-Waterman Sequence Alignment
+ * Host cost of the sw_gen_affine and sw_array_affine PE array models
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ * Usage: seqalign_bench <rtl|array|check> <4|48|256> [records]
+ *
+ * Streams random records through the array, alternating local and
+ * global mode and varying the query length. check runs both models on
+ * the same inputs and compares o_vld and m_result on every cycle.
+ *
+ * The last line of output is a RESULT line of key=value pairs for scripts.
+ */
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <systemc.h>
+
+#include "../aa/sw_gen_affine.h"
+#include "../aa/sw_array_affine.h"
+
+#define RECORD_LENGTH 1000
+
+static double wall_seconds(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+template<unsigned LOGLENGTH, unsigned LENGTH>
+SC_MODULE(seqalign_bench) {
+
+    sc_clock clock;
+    sc_signal<bool> reset;
+    sc_signal<sc_uint<LOGLENGTH> > query_length;
+    sc_signal<bool> local;
+    sc_signal<sc_biguint<(LENGTH * 2)> > query;
+    sc_signal<bool> input_valid;
+    sc_signal<sc_uint<2> > data;
+    sc_signal<bool> rtl_vld, array_vld;
+    sc_signal<sc_uint<11> > rtl_result, array_result;
+
+    sw_gen_affine<LOGLENGTH, LENGTH> *rtl;
+    sw_array_affine<LOGLENGTH, LENGTH> *array;
+
+    int records;
+    unsigned long long cycles;
+    unsigned long long mismatches;
+
+    void compare() {
+        cycles++;
+        if (rtl && array && (rtl_vld.read() != array_vld.read() || rtl_result.read() != array_result.read())) {
+            if (mismatches < 10) {
+                printf("cycle %llu: rtl o_vld %d m_result %u, array o_vld %d m_result %u\n", cycles,
+                       (int) rtl_vld.read(), (unsigned) rtl_result.read(),
+                       (int) array_vld.read(), (unsigned) array_result.read());
+            }
+            mismatches++;
+        }
+    }
+
+    void step() {
+        wait(clock.posedge_event());
+        compare();
+    }
+
+    void run() {
+        double start = wall_seconds();
+        srand(1);
+
+        for (int r = 0; r < records; r++) {
+            unsigned qlen = 1 + rand() % LENGTH;
+            sc_biguint<(LENGTH * 2)> q = 0;
+            for (unsigned i = 0; i < LENGTH; i++) {
+                q.range(i*2+1, i*2) = rand() & 3;
+            }
+            query = q;
+            query_length = qlen - 1;
+            local = r & 1;
+
+            input_valid = 0;
+            reset = 1;
+            step();
+            step();
+            reset = 0;
+            step();
+
+            /* Random record with valid gaps, then drain */
+            for (int k = 0; k < RECORD_LENGTH; k++) {
+                data = rand() & 3;
+                input_valid = (rand() & 7) != 0;
+                step();
+            }
+            input_valid = 0;
+            for (unsigned k = 0; k <= LENGTH; k++) {
+                step();
+            }
+        }
+
+        double seconds = wall_seconds() - start;
+        const char *model = rtl && array ? "check" : rtl ? "rtl" : "array";
+        printf("%s LENGTH %u: %d records, %llu cycles, %.3f s wall, %.3e cycles/s",
+               model, LENGTH, records, cycles, seconds, seconds > 0 ? cycles / seconds : 0.0);
+        if (rtl && array) {
+            printf(", %llu mismatches", mismatches);
+        }
+        printf("\n");
+        printf("RESULT model=%s length=%u records=%d cycles=%llu wall_s=%.6f mismatches=%llu\n",
+               model, LENGTH, records, cycles, seconds, mismatches);
+        sc_stop();
+    }
+
+    template<class MODEL> void bind(MODEL *obj, sc_signal<bool> &vld, sc_signal<sc_uint<11> > &result) {
+        obj->clk(clock);
+        obj->rst(reset);
+        obj->i_query_length(query_length);
+        obj->i_local(local);
+        obj->query(query);
+        obj->i_vld(input_valid);
+        obj->i_data(data);
+        obj->o_vld(vld);
+        obj->m_result(result);
+    }
+
+    SC_HAS_PROCESS(seqalign_bench);
+    seqalign_bench(sc_module_name name, bool with_rtl, bool with_array, int n)
+        : sc_module(name), clock("clock", 1, SC_MS), rtl(0), array(0), records(n), cycles(0), mismatches(0) {
+        if (with_rtl) {
+            rtl = new sw_gen_affine<LOGLENGTH, LENGTH>("rtl");
+            bind(rtl, rtl_vld, rtl_result);
+        }
+        if (with_array) {
+            array = new sw_array_affine<LOGLENGTH, LENGTH>("array");
+            bind(array, array_vld, array_result);
+        }
+        SC_THREAD(run);
+    }
+};
+
+int sc_main(int argc, char *argv[]) {
+    const char *model = argc > 1 ? argv[1] : "check";
+    int length = argc > 2 ? atoi(argv[2]) : 48;
+    int records = argc > 3 ? atoi(argv[3]) : 10;
+
+    bool with_rtl = strcmp(model, "array") != 0;
+    bool with_array = strcmp(model, "rtl") != 0;
+
+    switch (length) {
+    case 4:
+        new seqalign_bench<3, 4>("bench", with_rtl, with_array, records);
+        break;
+    case 48:
+        new seqalign_bench<6, 48>("bench", with_rtl, with_array, records);
+        break;
+    case 256:
+        new seqalign_bench<8, 256>("bench", with_rtl, with_array, records);
+        break;
+    default:
+        printf("Unsupported array length %d, use 4, 48 or 256\n", length);
+        return 1;
+    }
+    sc_start();
+    return 0;
+}
@@ -12,6 +12,12 @@
 #include "../aa/embed/seqalign.h"
 #include "../../../framework/murac.h"
 
+/* 2-bit nucleotide codes, four per byte, shared with aa/seqalign_lib.cpp */
+#define N_A 0
+#define N_G 1
+#define N_T 2
+#define N_C 3
+
 void printdata(const char *data) {
     for (int i = 0; i < 16; i++) {
         printf(" 0x%x", data[i]);
@@ -25,6 +31,9 @@ int main(void) {
     unsigned char *input = (unsigned char*) malloc(4);
     unsigned char *output = (unsigned char*) malloc(1);
 
+    /* Subject GGGC, packed into one byte */
+    input[0] = N_G | (N_G << 2) | (N_G << 4) | (N_C << 6);
+
     unsigned int *vars = (unsigned int *) malloc(2*sizeof(unsigned int));
     vars[0] = (unsigned int) input;
     vars[1] = (unsigned int) output;
@@ -0,0 +1,113 @@
+/**
+ * MURAC Test Application - Smith-Waterman Sequence Alignment, batched
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../aa/embed/seqalign_batch.h"
+#include "../../../framework/murac.h"
+
+#define JOBS          256
+#define QUERIES       8
+#define QUERY_LENGTH  32
+#define READ_LENGTH   150
+#define READ_BYTES    ((READ_LENGTH + 3) / 4)
+
+/* Exact match scores +5 per nucleotide */
+#define MATCH_SCORE   5
+
+static unsigned int lcg_state = 4321;
+
+static unsigned int next_random(void) {
+    lcg_state = lcg_state * 1103515245 + 12345;
+    return lcg_state >> 16;
+}
+
+/* Four 2-bit nucleotides per byte, shared with aa/seqalign_lib.cpp */
+static void set_nucleotide(unsigned char *buf, unsigned int k, unsigned int nt) {
+    buf[k >> 2] = (buf[k >> 2] & ~(3 << ((k & 3) * 2))) | (nt << ((k & 3) * 2));
+}
+
+void seqalign_batch(unsigned int *vars) {
+    MURAC_SET_PTR(vars)
+
+    EXECUTE_SEQALIGN_BATCH
+}
+
+int main(void) {
+
+    printf("[PA] Sequence Alignment batch example...\n");
+
+    unsigned char *queries  = (unsigned char *) malloc(QUERIES * QUERY_LENGTH / 4);
+    unsigned char *reads    = (unsigned char *) malloc(JOBS * READ_BYTES);
+    unsigned int  *table    = (unsigned int *) malloc(4 * JOBS * sizeof(unsigned int));
+    unsigned int  *batched  = (unsigned int *) malloc(2 * JOBS * sizeof(unsigned int));
+    unsigned int  *single   = (unsigned int *) malloc(2 * JOBS * sizeof(unsigned int));
+
+    for (unsigned int i = 0; i < QUERIES * QUERY_LENGTH; i++) {
+        set_nucleotide(queries, i, next_random() & 3);
+    }
+
+    /* Consecutive jobs share a query; every other read contains it */
+    for (unsigned int n = 0; n < JOBS; n++) {
+        unsigned int q = n * QUERIES / JOBS;
+        unsigned char *read = reads + n * READ_BYTES;
+        for (unsigned int k = 0; k < READ_LENGTH; k++) {
+            set_nucleotide(read, k, next_random() & 3);
+        }
+        if (n & 1) {
+            unsigned int at = next_random() % (READ_LENGTH - QUERY_LENGTH);
+            for (unsigned int i = 0; i < QUERY_LENGTH; i++) {
+                unsigned int k = q * QUERY_LENGTH + i;
+                set_nucleotide(read, at + i, (queries[k >> 2] >> ((k & 3) * 2)) & 3);
+            }
+        }
+        table[4*n]     = (unsigned int) (queries + q * QUERY_LENGTH / 4);
+        table[4*n + 1] = QUERY_LENGTH;
+        table[4*n + 2] = (unsigned int) read;
+        table[4*n + 3] = READ_LENGTH;
+    }
+
+    unsigned int *vars = (unsigned int *) malloc(4*sizeof(unsigned int));
+
+    /* One job per BrArch */
+    printf("[PA] %d alignments, one per call\n", JOBS);
+    for (unsigned int n = 0; n < JOBS; n++) {
+        vars[0] = (unsigned int) (table + 4 * n);
+        vars[1] = 1;
+        vars[2] = (unsigned int) (single + 2 * n);
+        vars[3] = n == JOBS - 1;
+        seqalign_batch(vars);
+    }
+
+    /* All jobs in one BrArch */
+    printf("[PA] %d alignments in one call\n", JOBS);
+    vars[0] = (unsigned int) table;
+    vars[1] = JOBS;
+    vars[2] = (unsigned int) batched;
+    vars[3] = 1;
+    seqalign_batch(vars);
+
+    int hits = 0;
+    int same = 1;
+    for (unsigned int n = 0; n < JOBS; n++) {
+        hits += (int) batched[2*n] == QUERY_LENGTH * MATCH_SCORE;
+        same &= batched[2*n] == single[2*n] && batched[2*n + 1] == single[2*n + 1];
+    }
+    printf("[PA] %d of %d reads contain their query\n", hits, JOBS);
+    printf("[PA] Batched and single results %s\n", same ? "match" : "differ");
+    printf("[PA] Example finished...\n");
+
+    free(queries);
+    free(reads);
+    free(table);
+    free(batched);
+    free(single);
+    free(vars);
+
+    return 0;
+}
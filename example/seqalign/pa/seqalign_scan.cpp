@@ -0,0 +1,102 @@
+/**
+ * MURAC Test Application - Smith-Waterman Sequence Alignment, database scan
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../aa/embed/seqalign_scan.h"
+#include "../../../framework/murac.h"
+
+/* Four 2-bit nucleotides per byte, shared with aa/seqalign_lib.cpp */
+#define PACKED_NT(buf, k) (((buf)[(k) >> 2] >> (((k) & 3) * 2)) & 3)
+
+#define RECORDS       64
+#define RECORD_LENGTH 32768
+#define QUERY_LENGTH  32
+
+/* Exact match scores +5 per nucleotide */
+#define MATCH_SCORE   5
+
+static unsigned int lcg_state = 12345;
+
+static unsigned int next_nucleotide(void) {
+    lcg_state = lcg_state * 1103515245 + 12345;
+    return (lcg_state >> 16) & 3;
+}
+
+static void set_nucleotide(unsigned char *buf, unsigned int k, unsigned int nt) {
+    buf[k >> 2] = (buf[k >> 2] & ~(3 << ((k & 3) * 2))) | (nt << ((k & 3) * 2));
+}
+
+void seqalign_scan(unsigned int *vars) {
+    MURAC_SET_PTR(vars)
+
+    EXECUTE_SEQALIGN_SCAN
+}
+
+int main(void) {
+
+    printf("[PA] Sequence Alignment database scan example...\n");
+
+    unsigned int total = RECORDS * RECORD_LENGTH;
+    unsigned char *query    = (unsigned char *) malloc((QUERY_LENGTH + 3) / 4);
+    unsigned char *database = (unsigned char *) malloc((total + 3) / 4);
+    unsigned int  *offsets  = (unsigned int *) malloc((RECORDS + 1) * sizeof(unsigned int));
+    unsigned int  *results  = (unsigned int *) malloc(2 * RECORDS * sizeof(unsigned int));
+    unsigned int  *planted  = (unsigned int *) malloc(RECORDS * sizeof(unsigned int));
+
+    for (unsigned int i = 0; i < QUERY_LENGTH; i++) {
+        set_nucleotide(query, i, next_nucleotide());
+    }
+    for (unsigned int k = 0; k < total; k++) {
+        set_nucleotide(database, k, next_nucleotide());
+    }
+
+    /* Plant the query once in every record */
+    for (unsigned int r = 0; r <= RECORDS; r++) {
+        offsets[r] = r * RECORD_LENGTH;
+    }
+    for (unsigned int r = 0; r < RECORDS; r++) {
+        planted[r] = (r * 7919) % (RECORD_LENGTH - QUERY_LENGTH);
+        for (unsigned int i = 0; i < QUERY_LENGTH; i++) {
+            set_nucleotide(database, offsets[r] + planted[r] + i, PACKED_NT(query, i));
+        }
+    }
+
+    printf("[PA] %d records of %d nucleotides, query of %d\n", RECORDS, RECORD_LENGTH, QUERY_LENGTH);
+
+    unsigned int *vars = (unsigned int *) malloc(6*sizeof(unsigned int));
+    vars[0] = (unsigned int) query;
+    vars[1] = QUERY_LENGTH;
+    vars[2] = (unsigned int) database;
+    vars[3] = (unsigned int) offsets;
+    vars[4] = RECORDS;
+    vars[5] = (unsigned int) results;
+
+    seqalign_scan(vars);
+
+    int found = 0;
+    for (unsigned int r = 0; r < RECORDS; r++) {
+        int score = (int) results[2*r];
+        unsigned int end = results[2*r + 1];
+        int hit = score == QUERY_LENGTH * MATCH_SCORE && end == planted[r] + QUERY_LENGTH - 1;
+        printf("[PA] Record %2d: score %3d end %5u (planted end %5u) %s\n", r, score, end,
+               planted[r] + QUERY_LENGTH - 1, hit ? "MATCH" : "MISS");
+        found += hit;
+    }
+    printf("[PA] Found %d of %d planted queries\n", found, RECORDS);
+    printf("[PA] Example finished...\n");
+
+    free(query);
+    free(database);
+    free(offsets);
+    free(results);
+    free(planted);
+    free(vars);
+
+    return 0;
+}
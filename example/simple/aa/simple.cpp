@@ -5,7 +5,7 @@
 using std::cout;
 using std::endl;
 
-MURAC_AA_EXECUTE(example) {
+MURAC_AA_EXECUTE(simple) {
     cout << "[AA] MURAC AA Simulator Example" << endl;
     run_simple_simulation(stack);
     return 1;
@@ -0,0 +1,255 @@
+/**
+ * MURAC Test Application - Systolic Array Matrix Multiplication
+ * Cycle-level model of an output-stationary systolic array
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#ifndef SYSTOLIC_ARRAY_H
+#define SYSTOLIC_ARRAY_H
+
+#include <vector>
+#include <string.h>
+#include <stdint.h>
+#include "systemc.h"
+
+/*
+ * rows x cols output-stationary array. Every cycle row i takes one
+ * element of A from the left and column j one element of B from the top,
+ * skewed by i and j cycles, so PE (i,j) sees a[i][k] and b[k][j] together
+ * and accumulates element (i,j) of a rows x cols tile of C. The last
+ * element of a tile carries a flag; the PE then latches its result and
+ * starts on the next tile, so tiles follow each other through the array
+ * without draining it.
+ *
+ * Operands come from the bus through an input FIFO of fifo_bytes. Each
+ * cycle the bus moves bus_bytes, finished results first. The array
+ * advances when the FIFO holds the next slice (a column of the A tile and
+ * a row of the B tile) and stalls as a whole otherwise. All PEs are
+ * evaluated by one method per clock edge.
+ *
+ * The caller loads the operand panels of each tile, in order, into one
+ * of two slots, and writes back each tile once tiles_done() passes it.
+ * progress is notified whenever a slot is freed or a tile completes.
+ */
+class systolic_array : public sc_module {
+
+public:
+    sc_in<bool> clk;
+
+    sc_event progress;
+    sc_event done;
+
+    /* Counters for the current job */
+    unsigned long long cycles;
+    unsigned long long stall_cycles;
+    unsigned long long bus_cycles;
+
+    SC_HAS_PROCESS(systolic_array);
+    systolic_array(sc_module_name name, unsigned rows, unsigned cols, unsigned bus_bytes, unsigned fifo_bytes)
+        : sc_module(name), rows(rows), cols(cols), bus_bytes(bus_bytes), fifo_bytes(fifo_bytes),
+          depth(rows > cols ? rows : cols), active(false),
+          a_reg(rows * cols), b_reg(rows * cols), flag_reg(rows * cols), acc(rows * cols), tile_of(rows * cols),
+          hist_a(depth * rows), hist_b(depth * cols), hist_flag(depth) {
+        SC_METHOD(clock_process);
+        sensitive << clk.pos();
+    }
+
+    /* Start an m x k x n multiply of esize-byte operands, results into c */
+    void start(unsigned m, unsigned k, unsigned n, unsigned esize, uint32_t *c) {
+        this->m = m;
+        this->k = k;
+        this->n = n;
+        this->esize = esize;
+        this->c = c;
+        tile_rows = (m + rows - 1) / rows;
+        tile_cols = (n + cols - 1) / cols;
+        tiles = tile_rows * tile_cols;
+
+        input_left = 0;
+        for (unsigned t = 0; t < tiles; t++) {
+            input_left += (unsigned long long) slice_bytes(t) * k;
+        }
+        fifo_fill = 0;
+        pending_out = 0;
+        loaded = fed = completed = 0;
+        feed_k = 0;
+        step_count = 0;
+
+        for (int s = 0; s < 2; s++) {
+            a_slot[s].assign(rows * k, 0);
+            b_slot[s].assign(k * cols, 0);
+        }
+        memset(&flag_reg[0], 0, flag_reg.size());
+        memset(&hist_flag[0], 0, hist_flag.size());
+        memset(&acc[0], 0, acc.size() * sizeof(uint32_t));
+        memset(&tile_of[0], 0, tile_of.size() * sizeof(unsigned));
+
+        cycles = stall_cycles = bus_cycles = 0;
+        active = tiles > 0;
+    }
+
+    bool running() const { return active; }
+    unsigned tile_count() const { return tiles; }
+    unsigned tiles_fed() const { return fed; }
+    unsigned tiles_done() const { return completed; }
+
+    /* Rows and columns of C covered by tile t */
+    unsigned tile_row(unsigned t) const { return (t / tile_cols) * rows; }
+    unsigned tile_col(unsigned t) const { return (t % tile_cols) * cols; }
+    unsigned tile_height(unsigned t) const { return m - tile_row(t) < rows ? m - tile_row(t) : rows; }
+    unsigned tile_width(unsigned t) const { return n - tile_col(t) < cols ? n - tile_col(t) : cols; }
+
+    /* Operand slots of the next tile to load: rows x k of A, k x cols of B, zero padded */
+    uint32_t *a_panel() { return &a_slot[loaded & 1][0]; }
+    uint32_t *b_panel() { return &b_slot[loaded & 1][0]; }
+    void panel_loaded() { loaded++; }
+
+private:
+    enum { VALID = 1, LAST = 2 };
+
+    const unsigned rows, cols, bus_bytes, fifo_bytes, depth;
+
+    unsigned m, k, n, esize;
+    uint32_t *c;
+    unsigned tile_rows, tile_cols, tiles;
+    bool active;
+
+    /* Bus and FIFO */
+    unsigned long long input_left;
+    unsigned long long fifo_fill;
+    unsigned long long pending_out;
+
+    /* Tiles loaded by the caller, fully injected, and completed */
+    unsigned loaded, fed, completed;
+    unsigned feed_k;
+    unsigned long long step_count;
+
+    std::vector<uint32_t> a_slot[2];
+    std::vector<uint32_t> b_slot[2];
+
+    /* PE registers, PE (i,j) at i * cols + j */
+    std::vector<uint32_t> a_reg;
+    std::vector<uint32_t> b_reg;
+    std::vector<uint8_t> flag_reg;
+    std::vector<uint32_t> acc;
+    std::vector<unsigned> tile_of;
+
+    /* Injected slices, the input skew of row i and column j reads i and j steps back */
+    std::vector<uint32_t> hist_a;
+    std::vector<uint32_t> hist_b;
+    std::vector<uint8_t> hist_flag;
+
+    unsigned slice_bytes(unsigned t) const {
+        return (tile_height(t) + tile_width(t)) * esize;
+    }
+
+    void inject(unsigned pos) {
+        if (fed < tiles && feed_k < k && fed < loaded) {
+            const uint32_t *a = &a_slot[fed & 1][0];
+            const uint32_t *b = &b_slot[fed & 1][0];
+            for (unsigned i = 0; i < rows; i++) {
+                hist_a[pos * rows + i] = a[i * k + feed_k];
+            }
+            memcpy(&hist_b[pos * cols], &b[feed_k * cols], cols * sizeof(uint32_t));
+            hist_flag[pos] = VALID | (feed_k == k - 1 ? LAST : 0);
+            fifo_fill -= slice_bytes(fed);
+            if (++feed_k == k) {
+                feed_k = 0;
+                fed++;
+                progress.notify();
+            }
+        } else {
+            hist_flag[pos] = 0;
+        }
+    }
+
+    void step() {
+        unsigned pos = step_count % depth;
+        inject(pos);
+
+        bool tile_end = false;
+        for (unsigned i = rows; i-- > 0; ) {
+            for (unsigned j = cols; j-- > 0; ) {
+                unsigned p = i * cols + j;
+                uint32_t a, b;
+                uint8_t f;
+                if (j == 0) {
+                    unsigned h = (pos + depth - i) % depth;
+                    a = hist_a[h * rows + i];
+                    f = step_count >= i ? hist_flag[h] : 0;
+                } else {
+                    a = a_reg[p - 1];
+                    f = flag_reg[p - 1];
+                }
+                if (i == 0) {
+                    b = hist_b[((pos + depth - j) % depth) * cols + j];
+                } else {
+                    b = b_reg[p - cols];
+                }
+
+                if (f & VALID) {
+                    acc[p] += a * b;
+                    if (f & LAST) {
+                        unsigned t = tile_of[p]++;
+                        unsigned r = tile_row(t) + i;
+                        unsigned q = tile_col(t) + j;
+                        if (r < m && q < n) {
+                            c[r * n + q] = acc[p];
+                        }
+                        acc[p] = 0;
+                        tile_end |= p == rows * cols - 1;
+                    }
+                }
+                a_reg[p] = a;
+                b_reg[p] = b;
+                flag_reg[p] = f;
+            }
+        }
+
+        if (tile_end) {
+            pending_out += (unsigned long long) tile_height(completed) * tile_width(completed) * 4;
+            completed++;
+            progress.notify();
+        }
+        step_count++;
+    }
+
+    void clock_process() {
+        if (!active) {
+            return;
+        }
+        cycles++;
+
+        /* Results leave before operands come in */
+        unsigned long long budget = bus_bytes;
+        unsigned long long out = pending_out < budget ? pending_out : budget;
+        pending_out -= out;
+        budget -= out;
+        unsigned long long room = fifo_bytes - fifo_fill;
+        unsigned long long in = input_left < budget ? input_left : budget;
+        in = in < room ? in : room;
+        fifo_fill += in;
+        input_left -= in;
+        if (out || in) {
+            bus_cycles++;
+        }
+
+        /* Advance on a full slice, or with bubbles once every slice is in */
+        bool ready = fed < loaded && fifo_fill >= slice_bytes(fed);
+        if (ready || fed == tiles) {
+            if (completed < tiles) {
+                step();
+            }
+        } else {
+            stall_cycles++;
+        }
+
+        if (completed == tiles && pending_out == 0) {
+            active = false;
+            done.notify();
+        }
+    }
+};
+
+#endif // SYSTOLIC_ARRAY_H
@@ -0,0 +1,19 @@
+/**
+ * MURAC Test Application - Systolic Array Matrix Multiplication
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <iostream>
+#include <systemc.h>
+#include "../../../framework/murac.h"
+
+using std::cout;
+using std::endl;
+
+extern int run_systolic_matmul_simulation(unsigned long int stack);
+
+MURAC_AA_EXECUTE(systolic_matmul) {
+    cout << "[AA] Running Systolic Array Matrix Multiplication AA simulation" << endl;
+    return run_systolic_matmul_simulation(stack);
+}
@@ -0,0 +1,221 @@
+/**
+ * MURAC Test Application - Systolic Array Matrix Multiplication
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ * Integer matrix multiply on a cycle-level model of an output-stationary
+ * systolic array (aa/systolic_array.h). The kernel takes the address of a
+ * struct matmul_desc, shared with example/matrix_multiply, with int8,
+ * int16 or int32 operands and int32 results.
+ *
+ */
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <systemc.h>
+#include "../../../framework/murac.h"
+#include "../../matrix_multiply/aa/matmul_desc.h"
+
+#include "systolic_array.h"
+
+static BusInterface *bus = 0;
+static sc_clock *systolic_clock = 0;
+static systolic_array *array = 0;
+
+/*
+ * Array configuration, from the environment when the library is loaded:
+ * SYSTOLIC_ARRAY (rows x columns), SYSTOLIC_WIDTH (operand bits),
+ * SYSTOLIC_BUS_BYTES (per cycle) and SYSTOLIC_FIFO_BYTES (input FIFO).
+ */
+static unsigned int array_rows = 16;
+static unsigned int array_cols = 16;
+static unsigned int operand_width = 16;
+static unsigned int bus_bytes = 32;
+static unsigned int fifo_bytes = 1024;
+
+static unsigned int env_value(const char *name, unsigned int value) {
+    const char *s = getenv(name);
+    if (s && atoi(s) > 0) {
+        return atoi(s);
+    }
+    if (s) {
+        printf("Invalid %s '%s', using %u\n", name, s, value);
+    }
+    return value;
+}
+
+MURAC_AA_INIT(systolic_matmul_init) {
+    ::bus = bus;
+
+    const char *shape = getenv("SYSTOLIC_ARRAY");
+    if (shape && (sscanf(shape, "%ux%u", &array_rows, &array_cols) != 2 || !array_rows || !array_cols)) {
+        printf("Invalid SYSTOLIC_ARRAY '%s', using 16x16\n", shape);
+        array_rows = array_cols = 16;
+    }
+    operand_width = env_value("SYSTOLIC_WIDTH", operand_width);
+    if (operand_width != 8 && operand_width != 16 && operand_width != 32) {
+        printf("Unsupported SYSTOLIC_WIDTH %u, using 16\n", operand_width);
+        operand_width = 16;
+    }
+    bus_bytes = env_value("SYSTOLIC_BUS_BYTES", bus_bytes);
+    fifo_bytes = env_value("SYSTOLIC_FIFO_BYTES", fifo_bytes);
+
+    /* The FIFO must hold at least one slice */
+    unsigned int slice = (array_rows + array_cols) * operand_width / 8;
+    if (fifo_bytes < slice) {
+        fifo_bytes = slice;
+    }
+
+    printf("[AA] Systolic array: %ux%u PEs, %u-bit operands, %u bus bytes/cycle, %u byte input FIFO\n",
+           array_rows, array_cols, operand_width, bus_bytes, fifo_bytes);
+
+    systolic_clock = new sc_clock("systolic_clock", 1, SC_MS);
+    array = new systolic_array("systolic_array", array_rows, array_cols, bus_bytes, fifo_bytes);
+    array->clk(*systolic_clock);
+    return 0;
+}
+
+static unsigned int element_size(unsigned int type) {
+    switch (type) {
+    case MATMUL_INT8:  return 1;
+    case MATMUL_INT16: return 2;
+    case MATMUL_INT32: return 4;
+    default:           return 0;
+    }
+}
+
+static const char *type_name(unsigned int type) {
+    return type == MATMUL_INT8 ? "int8" : type == MATMUL_INT16 ? "int16" : "int32";
+}
+
+/* Sign-extend count operands of esize bytes */
+static void widen(const unsigned char *src, uint32_t *dst, unsigned int count, unsigned int esize) {
+    for (unsigned int i = 0; i < count; i++) {
+        switch (esize) {
+        case 1:  dst[i] = (int8_t) src[i]; break;
+        case 2:  dst[i] = ((const int16_t *) src)[i]; break;
+        default: dst[i] = ((const uint32_t *) src)[i]; break;
+        }
+    }
+}
+
+/*
+ * Read the operands of tile t into the array's free slot. The A panel is
+ * reused from the previous tile when both are in the same row of tiles.
+ */
+static int load_tile(const matmul_desc &d, unsigned int esize, unsigned int t, std::vector<unsigned char> &buf) {
+    unsigned int row0 = array->tile_row(t);
+    unsigned int col0 = array->tile_col(t);
+    unsigned int h = array->tile_height(t);
+    unsigned int w = array->tile_width(t);
+    uint32_t *a = array->a_panel();
+    uint32_t *b = array->b_panel();
+
+    static uint32_t *last_a = 0;
+    static unsigned int last_row = ~0u;
+    if (t > 0 && row0 == last_row) {
+        memcpy(a, last_a, (size_t) h * d.k * sizeof(uint32_t));
+    } else {
+        buf.resize((size_t) d.k * esize);
+        for (unsigned int i = 0; i < h; i++) {
+            unsigned long int addr = d.a + (unsigned long int) (row0 + i) * d.k * esize;
+            if (bus->read(addr, &buf[0], d.k * esize)) {
+                printf("[AA] Error reading from bus 0x%lx\n", addr);
+                return -1;
+            }
+            widen(&buf[0], &a[(size_t) i * d.k], d.k, esize);
+        }
+    }
+    last_a = a;
+    last_row = row0;
+
+    buf.resize((size_t) w * esize);
+    for (unsigned int p = 0; p < d.k; p++) {
+        unsigned long int addr = d.b + ((unsigned long int) p * d.n + col0) * esize;
+        if (bus->read(addr, &buf[0], w * esize)) {
+            printf("[AA] Error reading from bus 0x%lx\n", addr);
+            return -1;
+        }
+        widen(&buf[0], &b[(size_t) p * array_cols], w, esize);
+    }
+
+    array->panel_loaded();
+    return 0;
+}
+
+static int write_tile(const matmul_desc &d, unsigned int t, const std::vector<uint32_t> &c) {
+    unsigned int row0 = array->tile_row(t);
+    unsigned int col0 = array->tile_col(t);
+    for (unsigned int i = 0; i < array->tile_height(t); i++) {
+        size_t offset = (size_t) (row0 + i) * d.n + col0;
+        unsigned long int addr = d.c + offset * 4;
+        if (bus->write(addr, (unsigned char *) &c[offset], array->tile_width(t) * 4)) {
+            printf("[AA] Error writing to bus 0x%lx\n", addr);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int run_systolic_matmul_simulation(unsigned long int stack) {
+
+    matmul_desc d;
+    if (bus->read(stack, (unsigned char *) &d, sizeof(d))) {
+        printf("[AA] Error reading descriptor from bus: 0x%lx\n", stack);
+        return -1;
+    }
+
+    unsigned int esize = element_size(d.type);
+    if (!esize || esize * 8 > operand_width) {
+        printf("[AA] Matrix element type %u does not fit %u-bit operands\n", d.type, operand_width);
+        return -1;
+    }
+    if (!d.m || !d.k || !d.n) {
+        return 1;
+    }
+
+    struct timeval start, end;
+    gettimeofday(&start, NULL);
+
+    std::vector<uint32_t> c((size_t) d.m * d.n);
+    std::vector<unsigned char> buf;
+    array->start(d.m, d.k, d.n, esize, &c[0]);
+
+    /* Keep both operand slots full and write tiles back as they finish */
+    unsigned int tiles = array->tile_count();
+    unsigned int loaded = 0;
+    unsigned int written = 0;
+    while (written < tiles) {
+        while (loaded < tiles && loaded < array->tiles_fed() + 2) {
+            if (load_tile(d, esize, loaded++, buf) < 0) {
+                return -1;
+            }
+        }
+        while (written < array->tiles_done()) {
+            if (write_tile(d, written++, c) < 0) {
+                return -1;
+            }
+        }
+        if (written < tiles) {
+            wait(array->progress);
+        }
+    }
+    if (array->running()) {
+        wait(array->done);
+    }
+
+    gettimeofday(&end, NULL);
+    double wall_s = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6;
+    double macs = (double) d.m * d.k * d.n;
+    double cycles = (double) array->cycles;
+
+    printf("[AA] %ux%ux%u %s on %ux%u: %llu cycles, %llu stall cycles (%.1f%%), %.1f%% PE utilisation, "
+           "%.2f MAC/cycle, bus busy %.1f%%, %.3f s wall\n",
+           d.m, d.k, d.n, type_name(d.type), array_rows, array_cols, array->cycles, array->stall_cycles,
+           100.0 * array->stall_cycles / cycles, 100.0 * macs / (cycles * array_rows * array_cols),
+           macs / cycles, 100.0 * array->bus_cycles / cycles, wall_s);
+
+    return 1;
+}
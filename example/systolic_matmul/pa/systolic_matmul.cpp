@@ -0,0 +1,113 @@
+/**
+ * MURAC Test Application - Systolic Array Matrix Multiplication
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ * Runs a set of int16 and int8 multiplies, including shapes that do not
+ * fill the array, and checks every result against the PA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../aa/embed/systolic_matmul.h"
+#include "../../matrix_multiply/aa/matmul_desc.h"
+#include "../../../framework/murac.h"
+
+struct shape {
+    unsigned int m, k, n, type;
+};
+
+static const struct shape shapes[] = {
+    {  16,  16,  16, MATMUL_INT16 },
+    {  64,  64,  64, MATMUL_INT16 },
+    { 100,  37,  53, MATMUL_INT16 },
+    { 256, 256, 256, MATMUL_INT16 },
+    { 128,   8, 128, MATMUL_INT16 },
+    { 256, 256, 256, MATMUL_INT8  },
+};
+
+#define SHAPES (sizeof(shapes) / sizeof(shapes[0]))
+
+static unsigned int lcg_state = 2468;
+
+static unsigned int next_random(void) {
+    lcg_state = lcg_state * 1103515245 + 12345;
+    return lcg_state >> 16;
+}
+
+void systolic_matmul(struct matmul_desc *desc) {
+    MURAC_SET_PTR(desc)
+
+    EXECUTE_SYSTOLIC_MATMUL
+}
+
+static int element(const void *m, unsigned int i, unsigned int type) {
+    return type == MATMUL_INT8 ? ((const signed char *) m)[i] : ((const short *) m)[i];
+}
+
+/* Compare C with the product computed on the PA */
+static int check(const void *a, const void *b, const int *c, const struct shape *s) {
+    for (unsigned int i = 0; i < s->m; i++) {
+        for (unsigned int j = 0; j < s->n; j++) {
+            int sum = 0;
+            for (unsigned int p = 0; p < s->k; p++) {
+                sum += element(a, i * s->k + p, s->type) * element(b, p * s->n + j, s->type);
+            }
+            if (sum != c[i * s->n + j]) {
+                printf("[PA] C[%u][%u] = %d, expected %d\n", i, j, c[i * s->n + j], sum);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+int main(void) {
+
+    printf("[PA] Systolic array matrix multiplication example...\n");
+
+    struct matmul_desc *desc = (struct matmul_desc *) malloc(sizeof(struct matmul_desc));
+    int passed = 0;
+
+    for (unsigned int t = 0; t < SHAPES; t++) {
+        const struct shape *s = &shapes[t];
+        unsigned int esize = s->type == MATMUL_INT8 ? 1 : 2;
+
+        unsigned char *a = (unsigned char *) malloc(s->m * s->k * esize);
+        unsigned char *b = (unsigned char *) malloc(s->k * s->n * esize);
+        int *c = (int *) malloc(s->m * s->n * sizeof(int));
+
+        for (unsigned int i = 0; i < s->m * s->k * esize; i++) {
+            a[i] = next_random();
+        }
+        for (unsigned int i = 0; i < s->k * s->n * esize; i++) {
+            b[i] = next_random();
+        }
+        memset(c, 0, s->m * s->n * sizeof(int));
+
+        desc->a = (unsigned int) a;
+        desc->b = (unsigned int) b;
+        desc->c = (unsigned int) c;
+        desc->m = s->m;
+        desc->k = s->k;
+        desc->n = s->n;
+        desc->type = s->type;
+        systolic_matmul(desc);
+
+        int ok = check(a, b, c, s);
+        printf("[PA] %ux%ux%u %s: %s\n", s->m, s->k, s->n, s->type == MATMUL_INT8 ? "int8" : "int16",
+               ok ? "match" : "DIFFER");
+        passed += ok;
+
+        free(a);
+        free(b);
+        free(c);
+    }
+
+    printf("[PA] %d of %d multiplies match\n", passed, (int) SHAPES);
+    printf("[PA] Example finished...\n");
+    free(desc);
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+/**
+ * MURAC Test Application - Timer Tick Benchmark
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ * PA-only benchmark of the MPCore private timer driving a 1 kHz guest tick,
+ * as a guest kernel does. The private timer auto-reloads every millisecond
+ * and interrupts through the GIC, and the interrupt handler clears the
+ * timer status and counts the tick. Ticks are counted with the PA idle in
+ * WFI between them, and then with the PA busy between them, and the global
+ * timer checks the tick period.
+ *
+ * The timer counts in PERIPH_CLK (2) instruction periods, so a millisecond
+ * is taken as NOMINAL_HZ / 1000 instructions.
+ *
+ * Run with an MPCore PA variant, e.g. murac_sim -variant Cortex-A9MPx1.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#define TICK_HZ             1000
+#define TICKS               2000
+#define NOMINAL_HZ          100000000
+#define PERIPH_CLK          2
+#define TICK_LOAD           (NOMINAL_HZ / PERIPH_CLK / TICK_HZ - 1)
+
+/* Private memory region, at the address in CBAR */
+#define ICCICR              0x0100
+#define ICCPMR              0x0104
+#define ICCIAR              0x010c
+#define ICCEOIR             0x0110
+#define GTCOUNTER_LO        0x0200
+#define GTCOUNTER_HI        0x0204
+#define GTCONTROL           0x0208
+#define PTLOAD              0x0600
+#define PTCOUNTER           0x0604
+#define PTCONTROL           0x0608
+#define PTINTSTATUS         0x060c
+#define ICDDCR              0x1000
+#define ICDISER0            0x1100
+
+#define PT_ENABLE           (1 << 0)
+#define PT_AUTO_RELOAD      (1 << 1)
+#define PT_IT_ENABLE        (1 << 2)
+#define GT_TIMER_ENABLE     (1 << 0)
+#define PRIVATE_TIMER_ID    29
+#define SPURIOUS_ID         1023
+
+/* High exception vectors, in PA local memory */
+#define VECTORS             0xFFFF0000
+#define IRQ_VECTOR          0x18
+#define IRQ_LITERAL         0x40
+#define LDR_PC_PC(offset)   (0xE59FF000 | (offset))
+#define SCTLR_V             (1 << 13)
+
+#define CPSR_MODE_MASK      0x1f
+#define CPSR_MODE_IRQ       0x12
+#define CPSR_I              (1 << 7)
+
+/* WFI, emitted as a word as the cross compiler targets ARM7 */
+#define WFI()               asm volatile(".word 0xE320F003" : : : "memory")
+
+static volatile unsigned int *mp_base;
+static volatile unsigned int ticks;
+static volatile unsigned int spurious;
+static volatile unsigned int max_counter;
+
+static unsigned int irq_stack[256];
+
+static inline unsigned int mp_read(unsigned int offset)           { return mp_base[offset / 4]; }
+static inline void mp_write(unsigned int offset, unsigned int v)  { mp_base[offset / 4] = v; }
+
+/* CP15 access, in ARM encodings every core of the family accepts */
+static inline unsigned int read_cbar(void)           { unsigned int v; asm volatile("mrc p15, 4, %0, c15, c0, 0" : "=r"(v)); return v; }
+static inline unsigned int read_sctlr(void)          { unsigned int v; asm volatile("mrc p15, 0, %0, c1, c0, 0" : "=r"(v)); return v; }
+static inline void write_sctlr(unsigned int v)       { asm volatile("mcr p15, 0, %0, c1, c0, 0" : : "r"(v) : "memory"); }
+
+static void __attribute__((interrupt("IRQ"))) irq_handler(void) {
+    unsigned int iar = mp_read(ICCIAR);
+    unsigned int id = iar & 0x3ff;
+
+    if (id == PRIVATE_TIMER_ID) {
+        unsigned int counter = mp_read(PTCOUNTER);
+        if (counter > max_counter) {
+            max_counter = counter;
+        }
+        mp_write(PTINTSTATUS, 1);
+        ticks++;
+    } else {
+        spurious++;
+    }
+    if (id != SPURIOUS_ID) {
+        mp_write(ICCEOIR, iar);
+    }
+}
+
+/* Install the IRQ vector and stack, and unmask IRQs */
+static void enable_irq(void) {
+    volatile unsigned int *vectors = (volatile unsigned int *) VECTORS;
+    vectors[IRQ_VECTOR / 4] = LDR_PC_PC(IRQ_LITERAL - IRQ_VECTOR - 8);
+    vectors[IRQ_LITERAL / 4] = (unsigned int) irq_handler;
+    write_sctlr(read_sctlr() | SCTLR_V);
+
+    unsigned int cpsr;
+    asm volatile("mrs %0, cpsr" : "=r"(cpsr));
+    asm volatile(
+        "msr cpsr_c, %0\n\t"
+        "mov sp, %1\n\t"
+        "msr cpsr_c, %2\n\t"
+        : : "r"((cpsr & ~CPSR_MODE_MASK) | CPSR_MODE_IRQ | CPSR_I),
+            "r"(&irq_stack[sizeof(irq_stack) / sizeof(irq_stack[0])]),
+            "r"(cpsr & ~CPSR_I)
+        : "lr", "memory");
+}
+
+static void disable_irq(void) {
+    unsigned int cpsr;
+    asm volatile("mrs %0, cpsr" : "=r"(cpsr));
+    asm volatile("msr cpsr_c, %0" : : "r"(cpsr | CPSR_I) : "memory");
+}
+
+static unsigned long long read_global_timer(void) {
+    unsigned int hi, lo;
+    do {
+        hi = mp_read(GTCOUNTER_HI);
+        lo = mp_read(GTCOUNTER_LO);
+    } while (hi != mp_read(GTCOUNTER_HI));
+    return ((unsigned long long) hi << 32) | lo;
+}
+
+/* Wait for TICKS ticks, idle in WFI or busy, returns the busy iterations */
+static unsigned int run_ticks(int busy) {
+    unsigned int work = 0;
+    unsigned int end = ticks + TICKS;
+    while (ticks != end) {
+        if (busy) {
+            work++;
+        } else {
+            WFI();
+        }
+    }
+    return work;
+}
+
+int main(void) {
+
+    printf("[PA] Timer tick benchmark: %d ticks at %d Hz, load %d\n", TICKS, TICK_HZ, TICK_LOAD);
+
+    mp_base = (volatile unsigned int *) (read_cbar() & 0xffffe000);
+
+    /* Distributor and CPU interface, private timer interrupt enabled */
+    mp_write(ICDISER0, 1 << PRIVATE_TIMER_ID);
+    mp_write(ICDDCR, 1);
+    mp_write(ICCPMR, 0xf0);
+    mp_write(ICCICR, 1);
+
+    enable_irq();
+
+    /* Free-running global timer for the tick period, then the tick */
+    mp_write(GTCONTROL, GT_TIMER_ENABLE);
+    mp_write(PTLOAD, TICK_LOAD);
+    mp_write(PTCONTROL, PT_ENABLE | PT_AUTO_RELOAD | PT_IT_ENABLE);
+
+    const char *phase_name[2] = { "idle", "busy" };
+    for (int busy = 0; busy < 2; busy++) {
+        unsigned long long gt_start = read_global_timer();
+        clock_t start = clock();
+        unsigned int work = run_ticks(busy);
+        clock_t elapsed = clock() - start;
+        unsigned long long gt_counts = read_global_timer() - gt_start;
+
+        printf("[PA] %s: %d ticks in %ld clock ticks, %llu global timer counts per tick",
+               phase_name[busy], TICKS, (long) elapsed, gt_counts / TICKS);
+        if (busy) {
+            printf(", %u loops between ticks", work / TICKS);
+        }
+        printf("\n");
+    }
+
+    mp_write(PTCONTROL, 0);
+    disable_irq();
+
+    printf("[PA] expected %d global timer counts per tick, counter at most %u in the handler, %u spurious\n",
+           TICK_LOAD + 1, max_counter, spurious);
+    printf("[PA] %ld clock ticks per second\n", (long) CLOCKS_PER_SEC);
+    printf("[PA] Example finished...\n");
+
+    return 0;
+}
@@ -8,7 +8,20 @@
 #define MURAC_H
 
 
-#define MURAC_AA_EXECUTE(NAME) extern "C" int murac_execute(unsigned long int stack)
+#define MURAC_AA_EXECUTE(NAME) extern "C" const char murac_kernel_name[] = #NAME; \
+                               extern "C" int murac_execute(unsigned long int stack)
+
+/* Optional host-native functional entry, returns the kernel status as murac_execute does and sets the estimated AA cycle count */
+#define MURAC_AA_EXECUTE_FAST(NAME) extern "C" int murac_execute_fast(unsigned long int stack, unsigned long long *cycles)
+
+/* A range of PA memory written by a kernel */
+struct murac_range {
+    unsigned long int base;
+    unsigned long int size;
+};
+
+/* Optional, fills ranges with the PA memory the kernel writes for this stack and returns the count (< 0 on error) */
+#define MURAC_AA_WRITES(NAME) extern "C" int murac_kernel_writes(unsigned long int stack, murac_range *ranges, int max)
 
 #define MURAC_AA_INIT(NAME) extern "C" int murac_init(BusInterface* bus)
 
@@ -18,6 +31,8 @@ class BusInterface {
 public:
     virtual int read(unsigned long int addr, unsigned char*data, unsigned int len) = 0;
     virtual int write(unsigned long int addr, unsigned char*data, unsigned int len) = 0;
+    /* Host pointer to len bytes at addr if directly mapped, otherwise 0 */
+    virtual unsigned char *map(unsigned long int addr, unsigned int len) { return 0; }
 };
 
 /*
@@ -0,0 +1,310 @@
+/**
+ * MURAC software framework
+ *
+ * Offline disassembly of a binary PA instruction trace, as recorded by
+ * murac_sim -binarytrace (see library/muracPATrace.h). Each instruction is
+ * listed with its address, encoding, processor mode and disassembly, followed
+ * by the registers it changed.
+ *
+ * The disassembly is taken from an objdump -d listing of the PA application,
+ * as the trace only holds encodings. Instructions that are not in the listing,
+ * or whose encoding differs from the listing (e.g. code that was modified or
+ * loaded at run time), are shown by encoding only, except for BAA.
+ *
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../library/muracPATrace.h"
+
+#define READ_WORDS      (64 * 1024)
+#define LINE_BYTES      512
+
+/* BAA encoding, 1110|00010010|............|0100|Rn */
+#define BAA_MASK        0xfff000f0
+#define BAA_VALUE       0xe1200040
+
+typedef struct {
+    unsigned int address;
+    unsigned int encoding;      /* as in a trace record */
+    unsigned int mask;          /* encoding bits given by the listing */
+    char *text;
+} listing_entry;
+
+typedef struct {
+    unsigned int words[MURAC_TRACE_MAX_WORDS];
+    unsigned int count;
+} trace_record;
+
+static listing_entry *listing = 0;
+static unsigned int listing_count = 0;
+
+static const char *reg_names[MURAC_TRACE_REGS] = {
+    "r0", "r1", "r2",  "r3",  "r4",  "r5", "r6", "r7",
+    "r8", "r9", "r10", "r11", "r12", "sp", "lr", "cpsr"
+};
+
+static int compare_entries(const void *a, const void *b)
+{
+    unsigned int x = ((const listing_entry *) a)->address;
+    unsigned int y = ((const listing_entry *) b)->address;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Parse the encoding field of a listing line, as 32-bit words, halfwords or
+ * bytes in address order, into the little-endian form of a trace record
+ */
+static int parse_encoding(const char *field, const char *end, unsigned int *encoding, unsigned int *mask)
+{
+    unsigned int shift = 0;
+
+    *encoding = 0;
+    while (field < end) {
+        unsigned int value = 0;
+        unsigned int digits = 0;
+
+        while (field < end && *field == ' ') {
+            field++;
+        }
+        for (; field < end && *field != ' '; field++, digits++) {
+            int c = *field;
+            if (c >= '0' && c <= '9') {
+                value = (value << 4) | (c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                value = (value << 4) | (c - 'a' + 10);
+            } else {
+                return -1;
+            }
+        }
+        if (!digits) {
+            continue;
+        }
+        if ((digits != 2 && digits != 4 && digits != 8) || shift + digits * 4 > 32) {
+            return -1;
+        }
+        *encoding |= value << shift;
+        shift += digits * 4;
+    }
+
+    if (!shift) {
+        return -1;
+    }
+    *mask = (shift == 32) ? 0xffffffff : (1u << shift) - 1;
+    return 0;
+}
+
+/* Read the instruction lines of an objdump -d listing: "addr:\tencoding\ttext" */
+static int load_listing(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    char line[LINE_BYTES];
+    unsigned int size = 0;
+
+    if (!file) {
+        fprintf(stderr, "Cannot open listing %s\n", path);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file)) {
+        unsigned int address;
+        unsigned int encoding;
+        unsigned int mask;
+        char *field;
+        char *text;
+        char *c;
+
+        if (sscanf(line, " %x:\t", &address) != 1 || !(field = strchr(line, '\t')) ||
+            !(text = strchr(field + 1, '\t')) || parse_encoding(field + 1, text, &encoding, &mask) < 0) {
+            continue;
+        }
+        text++;
+        for (c = text; *c; c++) {
+            if (*c == '\t') {
+                *c = ' ';
+            } else if (*c == '\n') {
+                *c = '\0';
+                break;
+            }
+        }
+
+        if (listing_count == size) {
+            size = size ? size * 2 : 4096;
+            listing = (listing_entry *) realloc(listing, size * sizeof(listing_entry));
+        }
+        listing[listing_count].address = address;
+        listing[listing_count].encoding = encoding;
+        listing[listing_count].mask = mask;
+        listing[listing_count].text = strdup(text);
+        listing_count++;
+    }
+    fclose(file);
+
+    qsort(listing, listing_count, sizeof(listing_entry), compare_entries);
+    return 0;
+}
+
+/* Disassembly of the instruction at address, if the listing has the same encoding there */
+static const char *lookup_listing(unsigned int address, unsigned int encoding)
+{
+    listing_entry key;
+    listing_entry *entry;
+
+    key.address = address;
+    entry = (listing_entry *) bsearch(&key, listing, listing_count, sizeof(listing_entry), compare_entries);
+    return (entry && ((encoding ^ entry->encoding) & entry->mask) == 0) ? entry->text : 0;
+}
+
+static const char *mode_name(unsigned int mode)
+{
+    switch (mode) {
+        case 0x10: return "usr";
+        case 0x11: return "fiq";
+        case 0x12: return "irq";
+        case 0x13: return "svc";
+        case 0x16: return "mon";
+        case 0x17: return "abt";
+        case 0x1b: return "und";
+        case 0x1f: return "sys";
+        default:   return "???";
+    }
+}
+
+/* Print an instruction, and the registers changed by it from the next record */
+static void print_record(const trace_record *record, const trace_record *next)
+{
+    unsigned int address = record->words[0];
+    unsigned int encoding = record->words[1];
+    unsigned int info = record->words[2];
+    const char *text = lookup_listing(address, encoding);
+    char encoded[16];
+    char baa[16];
+
+    if (!MURAC_TRACE_THUMB(info)) {
+        sprintf(encoded, "%08x", encoding);
+    } else if ((encoding & 0xffff) >= 0xe800) {
+        sprintf(encoded, "%04x %04x", encoding & 0xffff, encoding >> 16);
+    } else {
+        sprintf(encoded, "%04x", encoding & 0xffff);
+    }
+
+    if (!text && !MURAC_TRACE_THUMB(info) && (encoding & BAA_MASK) == BAA_VALUE) {
+        sprintf(baa, "baa r%u", encoding & 0xf);
+        text = baa;
+    }
+
+    printf("%08x  %-9s  %s  %-32s", address, encoded, mode_name(MURAC_TRACE_MODE(info)), text ? text : "");
+
+    if (next) {
+        unsigned int mask = MURAC_TRACE_MASK(next->words[2]);
+        unsigned int word = MURAC_TRACE_RECORD_WORDS;
+        unsigned int r;
+
+        for (r = 0; r < MURAC_TRACE_REGS; r++) {
+            if (mask & (1 << r)) {
+                printf(" %s=%08x", reg_names[r], next->words[word++]);
+            }
+        }
+    }
+    printf("\n");
+}
+
+int main(int argc, char* argv[]) {
+
+    FILE *file;
+    unsigned int *buffer;
+    unsigned int available = 0;
+    unsigned int position = 0;
+    unsigned long long instructions = 0;
+    trace_record records[2];
+    trace_record *current = &records[0];
+    trace_record *previous = 0;
+    int at_end = 0;
+
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: %s <trace> (objdump -d listing)\n", argv[0]);
+        return -1;
+    }
+
+    if (argc == 3 && load_listing(argv[2]) < 0) {
+        return -1;
+    }
+
+    file = fopen(argv[1], "rb");
+    if (!file) {
+        fprintf(stderr, "Cannot open trace %s\n", argv[1]);
+        return -1;
+    }
+
+    buffer = (unsigned int *) malloc(READ_WORDS * sizeof(unsigned int));
+
+    available = fread(buffer, sizeof(unsigned int), READ_WORDS, file);
+    if (available < MURAC_TRACE_HEADER_WORDS || buffer[0] != MURAC_TRACE_MAGIC || buffer[1] != MURAC_TRACE_VERSION) {
+        fprintf(stderr, "%s is not a version %d MURAC PA trace\n", argv[1], MURAC_TRACE_VERSION);
+        fclose(file);
+        return -1;
+    }
+    position = MURAC_TRACE_HEADER_WORDS;
+
+    while (1) {
+        unsigned int mask;
+        unsigned int words;
+        unsigned int r;
+
+        /* Refill in large reads, keeping a partial record */
+        if (!at_end && available - position < MURAC_TRACE_MAX_WORDS) {
+            memmove(buffer, &buffer[position], (available - position) * sizeof(unsigned int));
+            available -= position;
+            position = 0;
+            available += fread(&buffer[available], sizeof(unsigned int), READ_WORDS - available, file);
+            at_end = feof(file);
+        }
+
+        if (available - position < MURAC_TRACE_RECORD_WORDS) {
+            break;
+        }
+
+        mask = MURAC_TRACE_MASK(buffer[position + 2]);
+        words = MURAC_TRACE_RECORD_WORDS;
+        for (r = 0; r < MURAC_TRACE_REGS; r++) {
+            words += (mask >> r) & 1;
+        }
+        if (available - position < words) {
+            break;
+        }
+
+        memcpy(current->words, &buffer[position], words * sizeof(unsigned int));
+        current->count = words;
+        position += words;
+        instructions++;
+
+        if (previous) {
+            print_record(previous, current);
+        } else {
+            printf("%-58s", "registers at start:");
+            for (r = 0, words = MURAC_TRACE_RECORD_WORDS; r < MURAC_TRACE_REGS; r++) {
+                if (mask & (1 << r)) {
+                    printf(" %s=%08x", reg_names[r], current->words[words++]);
+                }
+            }
+            printf("\n");
+        }
+        previous = current;
+        current = (current == &records[0]) ? &records[1] : &records[0];
+    }
+
+    if (previous) {
+        print_record(previous, 0);
+    }
+    if (position != available) {
+        fprintf(stderr, "Trace ends in a partial record\n");
+    }
+
+    printf("%llu instructions\n", instructions);
+
+    fclose(file);
+    free(buffer);
+    return 0;
+}
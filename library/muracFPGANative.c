@@ -0,0 +1,161 @@
+/**
+ *
+ * Morphable Runtime Architecture Computer
+ * Host-native kernels of the muracFPGA PSE
+ *
+ * Code in the PSE is simulated, so the kernels it runs on the matrices
+ * are intercepted here and executed natively on the host. The PSE moves
+ * the operands between shared memory and its own buffers with
+ * ppmReadAddressSpace/ppmWriteAddressSpace; this library reads the
+ * buffers from the PSE, computes and writes the result back.
+ *
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+ // standard includes
+#include <stdlib.h>
+#include <string.h>
+
+// VMI area includes
+#include "vmi/vmiMessage.h"
+#include "vmi/vmiOSAttrs.h"
+#include "vmi/vmiOSLib.h"
+#include "vmi/vmiRt.h"
+#include "vmi/vmiTypes.h"
+#include "vmi/vmiVersion.h"
+
+#include "../example/matrix_multiply/aa/matmul_kernel.h"
+
+typedef struct vmiosObjectS {
+    vmiRegInfoCP sp;        // PSE stack pointer, arguments follow the return address
+    vmiRegInfoCP result;    // PSE function result
+} vmiosObject;
+
+//
+// Read the next 32-bit argument of the intercepted PSE function
+//
+static Uns32 getArg(vmiProcessorP processor, vmiosObjectP object, Uns32 *offset) {
+
+    memDomainP domain = vmirtGetProcessorDataDomain(processor);
+    Uns32      sp     = 0;
+    Uns32      value  = 0;
+
+    vmiosRegRead(processor, object->sp, &sp);
+    vmirtReadNByteDomain(domain, sp+4+*offset, &value, sizeof(value), 0, False);
+    *offset += sizeof(value);
+
+    return value;
+}
+
+//
+// Bool muracMatrixMultiplyNative(Uns32 type, Uns32 m, Uns32 k, Uns32 n,
+//                                void *a, void *b, void *c)
+//
+// C = A * B on row-major matrices in PSE memory, with the cache-blocked,
+// vectorised host kernel of the SystemC library
+//
+static VMIOS_INTERCEPT_FN(doMatrixMultiply) {
+
+    memDomainP domain = vmirtGetProcessorDataDomain(processor);
+    Uns32      offset = 0;
+    Uns32      type   = getArg(processor, object, &offset);
+    Uns32      m      = getArg(processor, object, &offset);
+    Uns32      k      = getArg(processor, object, &offset);
+    Uns32      n      = getArg(processor, object, &offset);
+    Addr       aAddr  = getArg(processor, object, &offset);
+    Addr       bAddr  = getArg(processor, object, &offset);
+    Addr       cAddr  = getArg(processor, object, &offset);
+    size_t     aBytes = (size_t)m*k*4;
+    size_t     bBytes = (size_t)k*n*4;
+    size_t     cBytes = (size_t)m*n*4;
+    void      *a      = malloc(aBytes);
+    void      *b      = malloc(bBytes);
+    void      *c      = malloc(cBytes);
+    Uns32      result = False;
+
+    if(!a || !b || !c) {
+        vmiMessage("W", "MURAC_FPGA_NATIVE",
+            "%s: cannot allocate a %ux%ux%u matrix multiply",
+            vmirtProcessorName(processor),
+            m, k, n
+        );
+    } else {
+        vmirtReadNByteDomain(domain, aAddr, a, aBytes, 0, False);
+        vmirtReadNByteDomain(domain, bAddr, b, bBytes, 0, False);
+
+        if(type==MATMUL_FLOAT) {
+            matmul_gemm_float(m, n, k, a, k, b, n, c, n);
+        } else {
+            matmul_gemm_int32(m, n, k, a, k, b, n, c, n);
+        }
+
+        vmirtWriteNByteDomain(domain, cAddr, c, cBytes, 0, False);
+        result = True;
+    }
+
+    free(a);
+    free(b);
+    free(c);
+
+    vmiosRegWrite(processor, object->result, &result);
+}
+
+//
+// Constructor
+//
+static VMIOS_CONSTRUCTOR_FN(constructor) {
+
+    object->sp     = vmiosGetRegDesc(processor, "esp");
+    object->result = vmiosGetRegDesc(processor, "eax");
+
+    if(!object->sp || !object->result) {
+        vmiMessage("F", "MURAC_FPGA_NATIVE",
+            "%s: PSE stack pointer or result register not found",
+            vmirtProcessorName(processor)
+        );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// INTERCEPT ATTRIBUTES
+////////////////////////////////////////////////////////////////////////////////
+
+vmiosAttr modelAttrs = {
+
+    ////////////////////////////////////////////////////////////////////////
+    // VERSION
+    ////////////////////////////////////////////////////////////////////////
+
+    VMI_VERSION,            // version string (THIS MUST BE FIRST)
+    VMI_INTERCEPT_LIBRARY,  // model type
+    "murac_fpga_native",    // description
+    sizeof(vmiosObject),    // size in bytes of OSS object
+
+    ////////////////////////////////////////////////////////////////////////
+    // CONSTRUCTOR/DESTRUCTOR ROUTINES
+    ////////////////////////////////////////////////////////////////////////
+
+    constructor,            // object constructor
+    0,                      // object destructor
+
+    ////////////////////////////////////////////////////////////////////////
+    // INSTRUCTION INTERCEPT ROUTINES
+    ////////////////////////////////////////////////////////////////////////
+
+    0,                      // morph callback
+    0,                      // get next instruction address
+    0,                      // disassemble instruction
+
+    ////////////////////////////////////////////////////////////////////////
+    // ADDRESS INTERCEPT DEFINITIONS
+    ////////////////////////////////////////////////////////////////////////
+
+    {
+        // --------------------------- ----------- ------ -----------------
+        // Name                        Address     Opaque Callback
+        // --------------------------- ----------- ------ -----------------
+        { "muracMatrixMultiplyNative", 0,          True,  doMatrixMultiply },
+        { 0 },
+    }
+};
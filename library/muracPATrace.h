@@ -0,0 +1,41 @@
+/**
+ *
+ * Morphable Runtime Architecture Computer
+ * Primary Architecture (PA) binary instruction trace format
+ *
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#ifndef MURAC_PA_TRACE_H
+#define MURAC_PA_TRACE_H
+
+/**
+  A trace is a header of two words, the magic number and the version, followed
+  by one record per instruction executed, all in host-endian 32-bit words:
+
+    word 0    instruction address
+    word 1    encoding, the 4 bytes at the address as a little-endian word
+    word 2    CPSR mode and T bit (bits 5:0), changed register mask (bits 31:16)
+    word 3... value of each register in the mask, lowest first
+
+  Mask bits 0 to 14 are r0 to r14 and bit 15 is the CPSR. A register is in the
+  mask when its value differs from the previous record, i.e. the values are the
+  results of the previous instruction. The first record has every register.
+ */
+
+#define MURAC_TRACE_MAGIC           0x5441504d      /* "MPAT" */
+#define MURAC_TRACE_VERSION         1
+#define MURAC_TRACE_HEADER_WORDS    2
+
+#define MURAC_TRACE_REGS            16
+#define MURAC_TRACE_CPSR            15
+#define MURAC_TRACE_RECORD_WORDS    3
+#define MURAC_TRACE_MAX_WORDS       (MURAC_TRACE_RECORD_WORDS + MURAC_TRACE_REGS)
+
+#define MURAC_TRACE_INFO(_CPSR, _MASK)  (((_CPSR) & 0x3f) | ((_MASK) << 16))
+#define MURAC_TRACE_MODE(_INFO)         ((_INFO) & 0x1f)
+#define MURAC_TRACE_THUMB(_INFO)        (((_INFO) >> 5) & 1)
+#define MURAC_TRACE_MASK(_INFO)         ((_INFO) >> 16)
+
+#endif
@@ -8,7 +8,11 @@
  */
 
  // standard includes
+#include <ctype.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
 // VMI area includes
 #include "vmi/vmiCxt.h"
@@ -17,8 +21,11 @@
 #include "vmi/vmiOSAttrs.h"
 #include "vmi/vmiOSLib.h"
 #include "vmi/vmiRt.h"
+#include "vmi/vmiTypes.h"
 #include "vmi/vmiVersion.h"
 
+#include "muracPATrace.h"
+
 /**
   BAA Instruction Format
    
@@ -33,9 +40,50 @@
 #define WIDTH(_W, _ARG) ((_ARG) & ((1<<(_W))-1))
 #define EXRACT_B(_I) WIDTH(5,(_I))
 
+//
+// Console buffering: guest writes to stdout and stderr are collected here and
+// written to the host when the buffer fills, holds CONSOLE_FLUSH_LINES lines,
+// the output switches between stdout and stderr, the PA branches to the AA or
+// the simulation ends
+//
+#define CONSOLE_BUFFER_BYTES    4096
+#define CONSOLE_FLUSH_LINES     64
+#define CONSOLE_CHUNK_BYTES     256
+
+//
+// Instruction trace: a binary record per instruction executed (see
+// muracPATrace.h) is collected in the trace buffer, which is written in one
+// host write when it fills and when the simulation ends. Each processor has
+// its own trace file, TRACE_FILE_FMT with the processor name (characters
+// other than letters, digits and '_' replaced by '_')
+//
+#define TRACE_FILE_FMT          "murac_%s.trace"
+#define TRACE_FILE_BYTES        256
+#define TRACE_BUFFER_WORDS      (256*1024)
+
 typedef struct vmiosObjectS {
     // Enhanced instruction decode table
     vmidDecodeTableP table;
+
+    // Console buffering (consoleAttrs only)
+    vmiRegInfoCP     args[4];                       // argument registers r0-r3
+    Int32            fd;                            // descriptor of buffered output
+    Uns32            bytes;                         // bytes buffered
+    Uns32            lines;                         // newlines buffered
+    Uns32            writes;                        // console writes by the PA
+    Uns32            hostWrites;                    // host writes performed
+    char             buffer[CONSOLE_BUFFER_BYTES];
+
+    // Instruction trace (traceAttrs only)
+    vmiRegInfoCP     traceRegs[MURAC_TRACE_REGS];   // r0-r14 and cpsr
+    Uns32            traceValues[MURAC_TRACE_REGS]; // values at last record
+    Bool             traceStarted;                  // has a record been made?
+    FILE            *traceFile;                     // trace output
+    char             traceName[TRACE_FILE_BYTES];   // trace file name
+    Uns32           *trace;                         // trace buffer
+    Uns32            traceWords;                    // words buffered
+    Uns64            traceRecords;                  // instructions traced
+    Uns32            traceWrites;                   // host writes performed
 } vmiosObject;
 
 #define DECODE_ENTRY(_PRIORITY, _NAME, _FMT) \
@@ -138,6 +186,305 @@ static VMIOS_DISASSEMBLE_FN(muracPADisassemble) {
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// CONSOLE BUFFERING
+////////////////////////////////////////////////////////////////////////////////
+
+//
+// Write buffered console output to the host. Host stdio is used, so the output
+// stays in order with the AA, which also prints through stdio.
+//
+static void consoleFlush(vmiosObjectP object) {
+
+    if(object->bytes) {
+
+        FILE *stream = (object->fd==2) ? stderr : stdout;
+
+        fwrite(object->buffer, 1, object->bytes, stream);
+        fflush(stream);
+
+        object->hostWrites++;
+        object->bytes = 0;
+        object->lines = 0;
+    }
+}
+
+//
+// Add bytes written to console descriptor fd to the buffer
+//
+static void consoleAppend(vmiosObjectP object, Int32 fd, const char *data, Uns32 bytes) {
+
+    Uns32 i;
+
+    if(fd!=object->fd) {
+        consoleFlush(object);
+        object->fd = fd;
+    }
+
+    if(object->bytes+bytes > CONSOLE_BUFFER_BYTES) {
+        consoleFlush(object);
+    }
+
+    memcpy(&object->buffer[object->bytes], data, bytes);
+    object->bytes += bytes;
+
+    for(i=0; i<bytes; i++) {
+        object->lines += (data[i]=='\n');
+    }
+
+    if(object->lines >= CONSOLE_FLUSH_LINES) {
+        consoleFlush(object);
+    }
+}
+
+//
+// Read argument register n
+//
+static Uns32 getArg(vmiProcessorP processor, vmiosObjectP object, Uns32 n) {
+
+    Uns32 value = 0;
+
+    vmiosRegRead(processor, object->args[n], &value);
+
+    return value;
+}
+
+//
+// Opaque intercept of newlib _write_r(reent, fd, buf, cnt). Writes to stdout
+// and stderr are buffered, other descriptors are written to the host, as the
+// semihosting library opens files on host descriptors.
+//
+static VMIOS_INTERCEPT_FN(doWriteR) {
+
+    memDomainP domain = vmirtGetProcessorDataDomain(processor);
+    Int32      fd     = getArg(processor, object, 1);
+    Addr       buf    = getArg(processor, object, 2);
+    Uns32      cnt    = getArg(processor, object, 3);
+    Int32      result = cnt;
+    Uns32      done;
+    char       chunk[CONSOLE_CHUNK_BYTES];
+
+    if((fd==1) || (fd==2)) {
+        object->writes++;
+    } else {
+        consoleFlush(object);
+    }
+
+    for(done=0; done<cnt; done+=sizeof(chunk)) {
+
+        Uns32 bytes = (cnt-done < sizeof(chunk)) ? cnt-done : sizeof(chunk);
+
+        vmirtReadNByteDomain(domain, buf+done, chunk, bytes, 0, False);
+
+        if((fd==1) || (fd==2)) {
+            consoleAppend(object, fd, chunk, bytes);
+        } else if(write(fd, chunk, bytes) != (ssize_t)bytes) {
+            result = -1;
+            break;
+        }
+    }
+
+    vmiosRegWrite(processor, object->args[0], &result);
+}
+
+//
+// Flush console output before the PA branches to the AA; the BAA itself is
+// implemented by the processor
+//
+static VMIOS_INTERCEPT_FN(doConsoleBrArch) {
+    consoleFlush(object);
+}
+
+//
+// Constructor for console buffering
+//
+static VMIOS_CONSTRUCTOR_FN(consoleConstructor) {
+
+    object->table = createDecodeTable();
+    object->args[0] = vmiosGetRegDesc(processor, "r0");
+    object->args[1] = vmiosGetRegDesc(processor, "r1");
+    object->args[2] = vmiosGetRegDesc(processor, "r2");
+    object->args[3] = vmiosGetRegDesc(processor, "r3");
+    object->fd      = 1;
+}
+
+//
+// Destructor for console buffering: flush, and report the console writes that
+// did not go through semihosting
+//
+static VMIOS_DESTRUCTOR_FN(consoleDestructor) {
+
+    consoleFlush(object);
+
+    vmiMessage("I", "MURAC_PA_CONSOLE",
+        "%s: %u semihosting write intercepts avoided, console written in %u host writes",
+        vmirtProcessorName(processor),
+        object->writes,
+        object->hostWrites
+    );
+}
+
+//
+// Morpher callback flushing console output at BAA instructions
+//
+static VMIOS_MORPH_FN(consoleMorph) {
+    Uns32             instruction = vmicxtFetch4Byte(processor, thisPC);
+    armMURACInstrType type        = vmidDecode(object->table, instruction);
+
+    if ( type == ARM_MPA_BAA ) {
+        *opaque = False;
+        return doConsoleBrArch;
+    } else {
+        return 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// INSTRUCTION TRACE
+////////////////////////////////////////////////////////////////////////////////
+
+//
+// Write the trace buffer to the trace file
+//
+static void traceFlush(vmiosObjectP object) {
+
+    if(object->traceWords) {
+
+        fwrite(object->trace, sizeof(Uns32), object->traceWords, object->traceFile);
+
+        object->traceWrites++;
+        object->traceWords = 0;
+    }
+}
+
+//
+// Record the instruction at thisPC, with encoding userData, and the registers
+// changed since the last record. There is no formatting: the trace is
+// disassembled offline by murac_tracedump.
+//
+static VMIOS_INTERCEPT_FN(doTrace) {
+
+    Uns32 *record = &object->trace[object->traceWords];
+    Uns32  words  = MURAC_TRACE_RECORD_WORDS;
+    Uns32  mask   = 0;
+    Uns32  i;
+
+    for(i=0; i<MURAC_TRACE_REGS; i++) {
+
+        Uns32 value = 0;
+
+        vmiosRegRead(processor, object->traceRegs[i], &value);
+
+        if(!object->traceStarted || (value!=object->traceValues[i])) {
+            object->traceValues[i] = value;
+            record[words++] = value;
+            mask |= 1<<i;
+        }
+    }
+
+    record[0] = thisPC;
+    record[1] = (Uns32)userData;
+    record[2] = MURAC_TRACE_INFO(object->traceValues[MURAC_TRACE_CPSR], mask);
+
+    object->traceStarted = True;
+    object->traceRecords++;
+    object->traceWords += words;
+
+    if(object->traceWords > TRACE_BUFFER_WORDS-MURAC_TRACE_MAX_WORDS) {
+        traceFlush(object);
+    }
+}
+
+//
+// Constructor for the instruction trace
+//
+static VMIOS_CONSTRUCTOR_FN(traceConstructor) {
+
+    static const char *regNames[MURAC_TRACE_REGS] = {
+        "r0", "r1", "r2",  "r3",  "r4",  "r5", "r6", "r7",
+        "r8", "r9", "r10", "r11", "r12", "sp", "lr", "cpsr"
+    };
+    char  name[TRACE_FILE_BYTES];
+    Uns32 i;
+
+    for(i=0; i<MURAC_TRACE_REGS; i++) {
+        object->traceRegs[i] = vmiosGetRegDesc(processor, regNames[i]);
+    }
+
+    // trace file named after the processor, so processors do not share one
+    strncpy(name, vmirtProcessorName(processor), sizeof(name)-1);
+    name[sizeof(name)-1] = 0;
+    for(i=0; name[i]; i++) {
+        if(!isalnum((unsigned char)name[i]) && (name[i]!='_')) {
+            name[i] = '_';
+        }
+    }
+    snprintf(object->traceName, sizeof(object->traceName), TRACE_FILE_FMT, name);
+
+    object->traceFile = fopen(object->traceName, "wb");
+
+    if(!object->traceFile) {
+        vmiMessage("W", "MURAC_PA_TRACE",
+            "%s: cannot open %s, instructions are not traced",
+            vmirtProcessorName(processor),
+            object->traceName
+        );
+        return;
+    }
+
+    object->trace = malloc(TRACE_BUFFER_WORDS*sizeof(Uns32));
+
+    if(!object->trace) {
+        fclose(object->traceFile);
+        object->traceFile = 0;
+        vmiMessage("W", "MURAC_PA_TRACE",
+            "%s: cannot allocate the trace buffer, instructions are not traced",
+            vmirtProcessorName(processor)
+        );
+        return;
+    }
+
+    object->trace[0]   = MURAC_TRACE_MAGIC;
+    object->trace[1]   = MURAC_TRACE_VERSION;
+    object->traceWords = MURAC_TRACE_HEADER_WORDS;
+}
+
+//
+// Destructor for the instruction trace: write out the trace buffer
+//
+static VMIOS_DESTRUCTOR_FN(traceDestructor) {
+
+    if(object->traceFile) {
+
+        traceFlush(object);
+        fclose(object->traceFile);
+        free(object->trace);
+
+        vmiMessage("I", "MURAC_PA_TRACE",
+            "%s: "FMT_64u" instructions traced to %s in %u host writes",
+            vmirtProcessorName(processor),
+            object->traceRecords,
+            object->traceName,
+            object->traceWrites
+        );
+    }
+}
+
+//
+// Morpher callback adding a trace record before every instruction
+//
+static VMIOS_MORPH_FN(traceMorph) {
+
+    if(!object->traceFile) {
+        return 0;
+    }
+
+    *opaque   = False;
+    *userData = (void *)vmicxtFetch4Byte(processor, thisPC);
+
+    return doTrace;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // INTERCEPT ATTRIBUTES
 ////////////////////////////////////////////////////////////////////////////////
@@ -174,3 +521,81 @@ vmiosAttr modelAttrs = {
 
     {{0}}
 };
+
+//
+// Console buffering only, for PA models implementing BAA themselves
+//
+vmiosAttr consoleAttrs = {
+
+    ////////////////////////////////////////////////////////////////////////
+    // VERSION
+    ////////////////////////////////////////////////////////////////////////
+
+    VMI_VERSION,            // version string (THIS MUST BE FIRST)
+    VMI_INTERCEPT_LIBRARY,  // model type
+    "murac_pa_console",     // description
+    sizeof(vmiosObject),    // size in bytes of OSS object
+
+    ////////////////////////////////////////////////////////////////////////
+    // CONSTRUCTOR/DESTRUCTOR ROUTINES
+    ////////////////////////////////////////////////////////////////////////
+
+    consoleConstructor,     // object constructor
+    consoleDestructor,      // object destructor
+
+    ////////////////////////////////////////////////////////////////////////
+    // INSTRUCTION INTERCEPT ROUTINES
+    ////////////////////////////////////////////////////////////////////////
+
+    consoleMorph,           // morph callback
+    0,                      // get next instruction address
+    0,                      // disassemble instruction
+
+    ////////////////////////////////////////////////////////////////////////
+    // ADDRESS INTERCEPT DEFINITIONS
+    ////////////////////////////////////////////////////////////////////////
+
+    {
+        // ----------------- ----------- ------ -----------------
+        // Name              Address     Opaque Callback
+        // ----------------- ----------- ------ -----------------
+        { "_write_r",        0,          True,  doWriteR        },
+        { 0 },
+    }
+};
+
+//
+// Binary instruction trace, for offline disassembly with murac_tracedump
+//
+vmiosAttr traceAttrs = {
+
+    ////////////////////////////////////////////////////////////////////////
+    // VERSION
+    ////////////////////////////////////////////////////////////////////////
+
+    VMI_VERSION,            // version string (THIS MUST BE FIRST)
+    VMI_INTERCEPT_LIBRARY,  // model type
+    "murac_pa_trace",       // description
+    sizeof(vmiosObject),    // size in bytes of OSS object
+
+    ////////////////////////////////////////////////////////////////////////
+    // CONSTRUCTOR/DESTRUCTOR ROUTINES
+    ////////////////////////////////////////////////////////////////////////
+
+    traceConstructor,       // object constructor
+    traceDestructor,        // object destructor
+
+    ////////////////////////////////////////////////////////////////////////
+    // INSTRUCTION INTERCEPT ROUTINES
+    ////////////////////////////////////////////////////////////////////////
+
+    traceMorph,             // morph callback
+    0,                      // get next instruction address
+    0,                      // disassemble instruction
+
+    ////////////////////////////////////////////////////////////////////////
+    // ADDRESS INTERCEPT DEFINITIONS
+    ////////////////////////////////////////////////////////////////////////
+
+    {{0}}
+};
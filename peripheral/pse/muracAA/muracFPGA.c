@@ -6,6 +6,9 @@
 
 #define PREFIX "MuracFPGA"
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "peripheral/impTypes.h"
 #include "peripheral/bhm.h"
 #include "peripheral/ppm.h"
@@ -14,6 +17,9 @@
 #define REGISTER_SIZE 4
 
 static MuracFPGAState fpgaState;
+
+static const char *brArchPorts[MURAC_MAX_PA_CORES]  = { "fpga_brarch",  "fpga_brarch_CPU1",  "fpga_brarch_CPU2",  "fpga_brarch_CPU3"  };
+static const char *retArchPorts[MURAC_MAX_PA_CORES] = { "fpga_retarch", "fpga_retarch_CPU1", "fpga_retarch_CPU2", "fpga_retarch_CPU3" };
 static Uns32 finishOnReset = 0;
 Uns32 diagnosticLevel;
 
@@ -33,10 +39,12 @@ static inline Uns32 byteSwap(Uns32 data){
 }
 
 PPM_NET_CB(brArchIRQ) {
-    if ( ppmReadNet(fpgaState.brarch) == 1) {
+    Uns32 cpu = (Uns32)(unsigned long)userData;
+    if ( ppmReadNet(fpgaState.brarch[cpu]) == 1) {
         if (diagnosticLevel >= 3) {
-            bhmMessage("I", "muracFPGA", "Branch Architecture interrupt received\n");
+            bhmMessage("I", "muracFPGA", "Branch Architecture interrupt received from core %u\n", cpu);
         }
+        fpgaState.pending |= 1 << cpu;
         if(!fpgaState.busy) {
             bhmTriggerEvent(fpgaState.start);
         }
@@ -47,39 +55,242 @@ static void setDiagLevel(Uns32 new) {
     diagnosticLevel = new;
 }
 
+Bool muracRead(Uns32 address, Uns32 bytes, void *data) {
+    if (!ppmReadAddressSpace(fpgaState.readHandle, address, bytes, data)) {
+        bhmMessage("W", "muracFPGA", "Read of %u bytes at 0x%x failed\n", bytes, address);
+        return False;
+    }
+    return True;
+}
+
+Bool muracWrite(Uns32 address, Uns32 bytes, void *data) {
+    if (!ppmWriteAddressSpace(fpgaState.writeHandle, address, bytes, data)) {
+        bhmMessage("W", "muracFPGA", "Write of %u bytes at 0x%x failed\n", bytes, address);
+        return False;
+    }
+    return True;
+}
+
+Bool muracReadWords(Uns32 address, Uns32 words, Uns32 *data) {
+    Uns32 i;
+    if (!muracRead(address, words * REGISTER_SIZE, data)) {
+        return False;
+    }
+    for (i = 0; i < words; i++) {
+        data[i] = byteSwap(data[i]);
+    }
+    return True;
+}
+
+Bool muracWriteWords(Uns32 address, Uns32 words, Uns32 *data) {
+    Bool  ok;
+    Uns32 i;
+    for (i = 0; i < words; i++) {
+        data[i] = byteSwap(data[i]);
+    }
+    ok = muracWrite(address, words * REGISTER_SIZE, data);
+    for (i = 0; i < words; i++) {
+        data[i] = byteSwap(data[i]);
+    }
+    return ok;
+}
+
+/**************
+  Embedded AA object
+ **************/
+#define ELF_CLASS64      2
+#define ELF_SHT_DYNSYM   11
+#define ELF_NAME_SYMBOL  "murac_kernel_name"
+#define ELF_MAX_NAME     64
+
+static inline Uns32 field(const Uns8 *p, Uns32 offset, Uns32 bytes) {
+    Uns32 value = 0;
+    Uns32 i;
+    for (i = 0; i < bytes && i < 4; i++) {
+        value |= (Uns32)p[offset + i] << (8 * i);
+    }
+    return value;
+}
+
+//
+// Find murac_kernel_name in the dynamic symbols of the shared object
+// embedded at pc, reading only the headers and tables that are needed
+//
+static Bool getKernelName(Uns32 pc, Uns32 size, char *name) {
+    Uns8   ehdr[64];
+    Uns8  *shdrs   = 0;
+    Uns8  *syms    = 0;
+    char  *strs    = 0;
+    Bool   found   = False;
+    Bool   is64;
+    Uns32  shoff, shentsize, shnum, i;
+    Uns32  symoff = 0, symsize = 0, strsec = 0;
+
+    if (size < sizeof(ehdr) || !muracRead(pc, sizeof(ehdr), ehdr) || memcmp(ehdr, "\177ELF", 4)) {
+        return False;
+    }
+
+    is64      = ehdr[4] == ELF_CLASS64;
+    shoff     = field(ehdr, is64 ? 0x28 : 0x20, 4);
+    shentsize = field(ehdr, is64 ? 0x3a : 0x2e, 2);
+    shnum     = field(ehdr, is64 ? 0x3c : 0x30, 2);
+
+    if (!shnum || shoff + shnum * shentsize > size) {
+        return False;
+    }
+    shdrs = malloc(shnum * shentsize);
+    if (!shdrs || !muracRead(pc + shoff, shnum * shentsize, shdrs)) {
+        goto done;
+    }
+
+    // Locate the dynamic symbol table and its string table
+    for (i = 0; i < shnum; i++) {
+        const Uns8 *sh = shdrs + i * shentsize;
+        if (field(sh, 4, 4) == ELF_SHT_DYNSYM) {
+            symoff  = field(sh, is64 ? 0x18 : 0x10, 4);
+            symsize = field(sh, is64 ? 0x20 : 0x14, 4);
+            strsec  = field(sh, is64 ? 0x28 : 0x18, 4);
+            break;
+        }
+    }
+    if (!symsize || strsec >= shnum) {
+        goto done;
+    }
+
+    {
+        const Uns8 *strsh  = shdrs + strsec * shentsize;
+        Uns32       stroff  = field(strsh, is64 ? 0x18 : 0x10, 4);
+        Uns32       strsize = field(strsh, is64 ? 0x20 : 0x14, 4);
+        Uns32       symentsize = is64 ? 24 : 16;
+
+        syms = malloc(symsize);
+        strs = malloc(strsize + 1);
+        if (!syms || !strs ||
+            !muracRead(pc + symoff, symsize, syms) ||
+            !muracRead(pc + stroff, strsize, strs)) {
+            goto done;
+        }
+        strs[strsize] = 0;
+
+        for (i = 0; i < symsize / symentsize; i++) {
+            const Uns8 *sym   = syms + i * symentsize;
+            Uns32       sname = field(sym, 0, 4);
+            Uns32       value = field(sym, is64 ? 8 : 4, 4);
+            Uns32       shndx = field(sym, is64 ? 6 : 14, 2);
+            const Uns8 *sh;
+            Uns32       offset, j;
+
+            if (sname >= strsize || strcmp(strs + sname, ELF_NAME_SYMBOL) || shndx >= shnum) {
+                continue;
+            }
+
+            // Translate the symbol address to a file offset through its section
+            sh     = shdrs + shndx * shentsize;
+            offset = field(sh, is64 ? 0x18 : 0x10, 4) + value - field(sh, is64 ? 0x10 : 0x0c, 4);
+
+            if (offset + ELF_MAX_NAME > size || !muracRead(pc + offset, ELF_MAX_NAME, name)) {
+                break;
+            }
+            for (j = 0; j < ELF_MAX_NAME && name[j]; j++);
+            found = j < ELF_MAX_NAME;
+            break;
+        }
+    }
+
+  done:
+    free(shdrs);
+    free(syms);
+    free(strs);
+    return found;
+}
+
+static const muracKernel *findKernel(const char *name) {
+    const muracKernel *kernel;
+    for (kernel = muracKernels; kernel->name; kernel++) {
+        if (!strcmp(kernel->name, name)) {
+            return kernel;
+        }
+    }
+    return 0;
+}
+
 static void auxiliaryArchitectureThread(void *user) {
+    Uns32 cpu;
     Uns32 pc;
     Uns32 instSize;
-    Uns32 instCount;
+    Uns32 args;
+    Uns32 mailbox[3];
+    char  name[ELF_MAX_NAME];
+    const muracKernel *kernel;
+    Int32 cycles;
     for (;;) {
-        if (diagnosticLevel >= 3) {
-            bhmMessage("I", "muracFPGA", "auxiliaryArchitectureThread waiting\n");
+        if (!fpgaState.pending) {
+            if (diagnosticLevel >= 3) {
+                bhmMessage("I", "muracFPGA", "auxiliaryArchitectureThread waiting\n");
+            }
+            fpgaState.busy = False;
+            bhmWaitEvent(fpgaState.start);
+            if (diagnosticLevel >= 3) {
+                bhmMessage("I", "muracFPGA", "auxiliaryArchitectureThread processing\n");
+            }
+            fpgaState.busy = True;
         }
-        fpgaState.busy = False;
-        bhmWaitEvent(fpgaState.start);
-        if (diagnosticLevel >= 3) {
-            bhmMessage("I", "muracFPGA", "auxiliaryArchitectureThread processing\n");
+
+        // Service one core at a time, lowest first
+        for (cpu = 0; !(fpgaState.pending & (1 << cpu)); cpu++);
+        fpgaState.pending &= ~(1 << cpu);
+
+        // PC, instruction block size and argument pointer in one transfer
+        if (!muracReadWords(MURAC_MAILBOX_ADDRESS(cpu), 3, mailbox)) {
+            goto retarch;
+        }
+        pc       = mailbox[0];
+        instSize = mailbox[1];
+        args     = mailbox[2];
+
+        if (diagnosticLevel >= 2) {
+            bhmMessage("I", "muracFPGA", "Core %u PC 0x%x, AA instruction size %u, arguments 0x%x\n", cpu, pc, instSize, args);
+        }
+
+        if (!getKernelName(pc, instSize, name)) {
+            bhmMessage("W", "muracFPGA", "No murac_kernel_name in AA instruction block at 0x%x\n", pc);
+            goto retarch;
+        }
+
+        kernel = findKernel(name);
+        if (!kernel) {
+            bhmMessage("W", "muracFPGA", "No native kernel registered for '%s'\n", name);
+            goto retarch;
         }
-        fpgaState.busy = True;
 
-        ppmReadAddressSpace(fpgaState.readHandle, MURAC_PC_ADDRESS, 4, &pc);
-        bhmMessage("I", "muracFPGA", "PC is 0x%x\n", pc);
+        cycles = kernel->run(args);
+        if (cycles < 0) {
+            bhmMessage("W", "muracFPGA", "Kernel '%s' failed\n", name);
+            goto retarch;
+        }
+        if (diagnosticLevel >= 2) {
+            bhmMessage("I", "muracFPGA", "Kernel '%s' completed in %d cycles\n", name, cycles);
+        }
 
-        ppmReadAddressSpace(fpgaState.readHandle, MURAC_PC_ADDRESS + 4, 4, &instSize);
-        bhmMessage("I", "muracFPGA", "AA Instruction size is %d\n", instSize);
+        // Model the kernel latency
+        if (cycles > 0) {
+            bhmWaitDelay((double)cycles * fpgaState.cyclePeriod);
+        }
 
-        ppmReadAddressSpace(fpgaState.readHandle, MURAC_PC_ADDRESS + 8, 4, &instCount);
-        bhmMessage("I", "muracFPGA", "AA Instruction count is %d\n", instCount);
+      retarch:
 
-        // Trigger RetArch
-        ppmWriteNet(fpgaState.intRetArch, 1);
-        ppmWriteNet(fpgaState.intRetArch, 0);
+        // Trigger RetArch on the core that branched
+        if (fpgaState.intRetArch[cpu]) {
+            ppmWriteNet(fpgaState.intRetArch[cpu], 1);
+            ppmWriteNet(fpgaState.intRetArch[cpu], 0);
+        }
     }
 }
 
 int main(int argc, char **argv) {
 
  	bhmEventHandle wait_event;
+    Uns32          cpu;
 
     diagnosticLevel = 0;
     bhmInstallDiagCB(setDiagLevel);
@@ -88,20 +299,28 @@ int main(int argc, char **argv) {
     fpgaState.readHandle  = ppmOpenAddressSpace("fpga_memread");
     fpgaState.writeHandle = ppmOpenAddressSpace("fpga_memwrite");
 
-    /* Create the interrupt lines */
-    fpgaState.brarch = ppmOpenNetPort("fpga_brarch");
-    ppmInstallNetCallback(fpgaState.brarch, brArchIRQ, (void*)0);
-
-    fpgaState.intRetArch = ppmOpenNetPort("fpga_retarch");
+    /* Create the interrupt lines, a BrArch/RetArch pair for each connected core */
+    for (cpu = 0; cpu < MURAC_MAX_PA_CORES; cpu++) {
+        fpgaState.brarch[cpu] = ppmOpenNetPort(brArchPorts[cpu]);
+        if (fpgaState.brarch[cpu]) {
+            ppmInstallNetCallback(fpgaState.brarch[cpu], brArchIRQ, (void*)(unsigned long)cpu);
+        }
+        fpgaState.intRetArch[cpu] = ppmOpenNetPort(retArchPorts[cpu]);
+    }
 
     if (BHM_DIAG_LOW) 
         bhmMessage("I", PREFIX,"main\n");
 
     bhmIntegerAttribute("stoponsoftreset", &finishOnReset);
 
+    /* AA clock period in microseconds, 1ms by default as in the SystemC kernels */
+    fpgaState.cyclePeriod = 1000;
+    bhmIntegerAttribute("cyclePeriod", &fpgaState.cyclePeriod);
+
     /* Create thread */
     fpgaState.start = bhmCreateEvent();
     fpgaState.busy = False;
+    fpgaState.pending = 0;
     fpgaState.thread = bhmCreateThread(auxiliaryArchitectureThread, (void*)0, "muracFPGAthread", &fpgaState.stack[THREAD_STACK] );
 
     /* Idle until triggered */
@@ -17,18 +17,54 @@ extern Uns32 diagnosticLevel;
 #define THREAD_STACK      (8*1024)
 #define MURAC_PC_ADDRESS 0xcf000000
 
+// Each PA core has its own BAA mailbox (PC, block size, pointer) and its
+// own BrArch/RetArch nets, fpga_brarch/fpga_retarch for core 0 and
+// fpga_brarch_CPU<n>/fpga_retarch_CPU<n> for the others
+#define MURAC_MAX_PA_CORES          4
+#define MURAC_MAILBOX_SIZE          0x10
+#define MURAC_MAILBOX_ADDRESS(_CPU) (MURAC_PC_ADDRESS + (_CPU)*MURAC_MAILBOX_SIZE)
+
 typedef struct {
 	char  name[128]; // Device description    
     ppmAddressSpaceHandle readHandle;  // Memory Read Address Space Handle
     ppmAddressSpaceHandle writeHandle; // Memory Write Address Space Handle
-    ppmNetHandle          brarch;      // Interrupt to indicate BrArch
-    ppmNetHandle          intRetArch;  // Interrupt to return to Primary Architecture
+    ppmNetHandle          brarch[MURAC_MAX_PA_CORES];     // Interrupt to indicate BrArch, per core
+    ppmNetHandle          intRetArch[MURAC_MAX_PA_CORES]; // Interrupt to return to Primary Architecture, per core
 
     bhmThreadHandle       thread;
     bhmEventHandle        start;
     Bool                  busy;
+    Uns32                 pending;     // Cores with a BrArch not yet serviced
+    Uns32                 cyclePeriod; // AA clock period in microseconds
     char                  stack[THREAD_STACK];
 
 } MuracFPGAState;
 
+/****
+ * Native AA kernels
+ *
+ * The PSE cannot load the host shared object embedded after a BAA, so
+ * kernels are compiled into the peripheral and selected by the
+ * murac_kernel_name exported from the embedded object.
+ */
+
+// Run the kernel on the argument block at args, returns the AA cycle count (< 0 on error)
+typedef Int32 (*muracKernelFn)(Uns32 args);
+
+typedef struct {
+    const char    *name;
+    muracKernelFn  run;
+} muracKernel;
+
+// Registered kernels, terminated by a null entry
+extern const muracKernel muracKernels[];
+
+// Bulk transfers between the AA and shared memory
+Bool muracRead(Uns32 address, Uns32 bytes, void *data);
+Bool muracWrite(Uns32 address, Uns32 bytes, void *data);
+
+// Bulk transfers of 32-bit words, converted from and to PA byte order
+Bool muracReadWords(Uns32 address, Uns32 words, Uns32 *data);
+Bool muracWriteWords(Uns32 address, Uns32 words, Uns32 *data);
+
 #endif
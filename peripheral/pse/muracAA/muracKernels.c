@@ -0,0 +1,101 @@
+/**
+ * Murac FPGA peripheral - native AA kernels
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "peripheral/impTypes.h"
+#include "peripheral/bhm.h"
+#include "peripheral/ppm.h"
+#include "muracFPGA.h"
+
+/**************
+  Matrix multiply (example/matrix_multiply)
+ **************/
+#include "../../../example/matrix_multiply/aa/matmul_kernel.h"
+
+#define MM_DESC_WORDS (sizeof(struct matmul_desc) / 4)
+
+/*
+ * Intercepted by the host library (library/muracFPGANative.c), which runs
+ * the host kernel of the SystemC library natively on the PSE buffers.
+ * Returns False if the library is not loaded.
+ */
+Bool __attribute__((noinline)) muracMatrixMultiplyNative(Uns32 type, Uns32 m, Uns32 k, Uns32 n,
+                                                         void *a, void *b, void *c) {
+    return False;
+}
+
+/*
+ * C = A * B, row-major, with the latency model of the SystemC library at
+ * its default MAC array and bus width. Each operand is moved in one
+ * transfer, and the multiply runs natively on the host.
+ */
+static Int32 matrixMultiply(Uns32 args) {
+    struct matmul_desc d;
+    struct timeval     start, end;
+    Uns32             *a = 0, *b = 0, *c = 0;
+    Int32              result = -1;
+    unsigned long long cycles;
+    double             wallS, macs;
+
+    if (!muracReadWords(args, MM_DESC_WORDS, (Uns32 *) &d)) {
+        return -1;
+    }
+    if (d.type != MATMUL_INT32 && d.type != MATMUL_FLOAT) {
+        bhmMessage("W", "muracFPGA", "Unsupported matrix element type %u\n", d.type);
+        return -1;
+    }
+
+    gettimeofday(&start, 0);
+
+    a = malloc((size_t) d.m * d.k * 4);
+    b = malloc((size_t) d.k * d.n * 4);
+    c = malloc((size_t) d.m * d.n * 4);
+    if (!a || !b || !c) {
+        bhmMessage("W", "muracFPGA", "Cannot allocate a %ux%ux%u matrix multiply\n", d.m, d.k, d.n);
+        goto done;
+    }
+    if (!muracReadWords(d.a, d.m * d.k, a) || !muracReadWords(d.b, d.k * d.n, b)) {
+        goto done;
+    }
+
+    if (!muracMatrixMultiplyNative(d.type, d.m, d.k, d.n, a, b, c)) {
+        bhmMessage("W", "muracFPGA", "Native matrix multiply unavailable, running it as simulated PSE code\n");
+        if (d.type == MATMUL_FLOAT) {
+            matmul_gemm_float(d.m, d.n, d.k, (const float *) a, d.k, (const float *) b, d.n, (float *) c, d.n);
+        } else {
+            matmul_gemm_int32(d.m, d.n, d.k, (const int *) a, d.k, (const int *) b, d.n, (int *) c, d.n);
+        }
+    }
+
+    if (!muracWriteWords(d.c, d.m * d.n, c)) {
+        goto done;
+    }
+
+    gettimeofday(&end, 0);
+    wallS  = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6;
+    macs   = (double) d.m * d.k * d.n;
+    cycles = matmul_model_cycles(&d, MATMUL_MAC_ROWS, MATMUL_MAC_COLS, MATMUL_BUS_BYTES);
+
+    bhmPrintf("[AA] %ux%ux%u %s: %llu cycles, %.1f%% MAC utilisation, %.3f s wall, %.3e MAC/s wall\n",
+              d.m, d.k, d.n, d.type == MATMUL_FLOAT ? "float" : "int32", cycles,
+              cycles ? 100.0 * macs / ((double) cycles * MATMUL_MAC_ROWS * MATMUL_MAC_COLS) : 0.0,
+              wallS, wallS > 0 ? macs / wallS : 0.0);
+
+    result = cycles > 0x7fffffff ? 0x7fffffff : (Int32) cycles;
+
+  done:
+    free(a);
+    free(b);
+    free(c);
+    return result;
+}
+
+const muracKernel muracKernels[] = {
+    { "matrix_multiply", matrixMultiply },
+    { 0, 0 }
+};
@@ -20,8 +20,8 @@ class muracFPGA : public icmPeripheral
     icmInputNetPort  brarch;
     icmOutputNetPort intRetArch;
 
-    muracFPGA(sc_module_name name, const char *model_file, icmAttrListObject *initialAttrs = 0 )
-        : icmPeripheral(name, model_file ? model_file : getModel(), 0, initialAttrs)
+    muracFPGA(sc_module_name name, const char *model_file, const char *native_file = 0, icmAttrListObject *initialAttrs = 0 )
+        : icmPeripheral(name, model_file ? model_file : getModel(), native_file, initialAttrs)
         , memory_read(this, "fpga_memread", 32)
         , memory_write(this, "fpga_memwrite", 32)
         , brarch(this, "fpga_brarch")
@@ -12,6 +12,10 @@
 
 typedef int (*murac_init_func)(BusInterface*);
 typedef int (*murac_exec_func)(unsigned long int);
+typedef int (*murac_exec_fast_func)(unsigned long int, unsigned long long*);
+typedef int (*murac_writes_func)(unsigned long int, murac_range*, int);
+
+#define MURAC_MAX_WRITE_RANGES 16
 
 using std::cout;
 using std::endl;
@@ -20,25 +24,109 @@ using std::hex;
 
 SC_HAS_PROCESS( muracAA );
 
-muracAAInterupt::muracAAInterupt(const char *name, muracAA *aa):
+muracAAInterupt::muracAAInterupt(const char *name, muracAA *aa, unsigned int core):
   m_aa(aa),
-  m_name(name) {
+  m_name(name),
+  m_core(core) {
   
 }
 
 void muracAAInterupt::write(const int &value) {
     if (value == 1) {
-        m_aa->onBrArch(value);
+        m_aa->onBrArch(m_core);
     }
 }
 
 /** 
  * Constructor
  */
-muracAA::muracAA( sc_core::sc_module_name  name) :
+muracAA::muracAA( sc_core::sc_module_name  name, unsigned int cores) :
   sc_module( name ),
-  brarch("brarch", this) {
-  
+  brarch("brarch", this),
+  num_cores(cores < 1 ? 1 : (cores > MURAC_MAX_PA_CORES ? MURAC_MAX_PA_CORES : cores)),
+  brarch_count(0),
+  default_fidelity(MURAC_FIDELITY_CYCLE),
+  clock_period(1, SC_MS) {
+
+    brarch_cores[0]  = &brarch;
+    retarch_cores[0] = &intRetArch;
+    for (unsigned int i = 1; i < num_cores; i++) {
+        char port_name[32];
+        sprintf(port_name, "brarch_CPU%u", i);
+        brarch_cores[i]  = new muracAAInterupt(port_name, this, i);
+        sprintf(port_name, "intRetArch_CPU%u", i);
+        retarch_cores[i] = new tlm::tlm_analysis_port<int>(port_name);
+    }
+}
+
+muracAA::~muracAA() {
+    for (unsigned int i = 1; i < num_cores; i++) {
+        delete brarch_cores[i];
+        delete retarch_cores[i];
+    }
+}
+
+muracAAInterupt &muracAA::brarchCore(unsigned int core) {
+    sc_assert(core < num_cores);
+    return *brarch_cores[core];
+}
+
+tlm::tlm_analysis_port<int> &muracAA::intRetArchCore(unsigned int core) {
+    sc_assert(core < num_cores);
+    return *retarch_cores[core];
+}
+
+void muracAA::addDirectMemory(unsigned long int base, unsigned long int size, unsigned char *mem) {
+    directMemory region = { base, size, mem };
+    direct_memories.push_back(region);
+}
+
+void muracAA::setClockPeriod(const sc_core::sc_time &period) {
+    clock_period = period;
+}
+
+void muracAA::end_of_simulation() {
+    cout << "MURAC AA serviced " << brarch_count << " BrArch request(s)" << endl;
+}
+
+int muracAA::setFidelity(const char *spec) {
+    std::string kernel;
+    std::string mode(spec);
+    muracFidelity fidelity;
+
+    size_t sep = mode.find('=');
+    if (sep != std::string::npos) {
+        kernel = mode.substr(0, sep);
+        mode   = mode.substr(sep + 1);
+    }
+
+    if (mode == "cycle") {
+        fidelity = MURAC_FIDELITY_CYCLE;
+    } else if (mode == "fast") {
+        fidelity = MURAC_FIDELITY_FAST;
+    } else if (mode == "check") {
+        fidelity = MURAC_FIDELITY_CHECK;
+    } else {
+        cout << "Error: Unknown AA fidelity '" << mode << "' (expected cycle, fast or check)" << endl;
+        return -1;
+    }
+
+    if (kernel.empty()) {
+        default_fidelity = fidelity;
+    } else {
+        kernel_fidelity[kernel] = fidelity;
+    }
+    return 0;
+}
+
+muracFidelity muracAA::getFidelity(const char *kernel) {
+    if (kernel) {
+        std::map<std::string, muracFidelity>::iterator it = kernel_fidelity.find(kernel);
+        if (it != kernel_fidelity.end()) {
+            return it->second;
+        }
+    }
+    return default_fidelity;
 }
 
 int muracAA::loadLibrary(const char *library) {
@@ -71,44 +159,189 @@ int muracAA::invokePluginSimulation(const char* path, unsigned long int ptr) {
       return -1;
     }
 
+    // Optional symbols, absent in older plugins
+    void *m_fast = dlsym(handle, "murac_execute_fast");
+    void *m_writes = dlsym(handle, "murac_kernel_writes");
+    const char *kernel = (const char *) dlsym(handle, "murac_kernel_name");
+    dlerror();
+
+    muracFidelity fidelity = getFidelity(kernel);
+    if (fidelity != MURAC_FIDELITY_CYCLE && !m_fast) {
+      cout << "@" << sc_time_stamp() << " Kernel " << (kernel ? kernel : "<unnamed>")
+           << " has no fast path, using cycle model" << endl;
+      fidelity = MURAC_FIDELITY_CYCLE;
+    }
+
+    if (fidelity == MURAC_FIDELITY_FAST) {
+      return invokeFastSimulation(m_fast, ptr, true);
+    }
+
+    std::vector<murac_range> ranges;
+    std::vector<std::vector<unsigned char> > initial, fast;
+    int fast_result = 0;
+    if (fidelity == MURAC_FIDELITY_CHECK) {
+      if (writtenRanges(m_writes, ptr, kernel, ranges) < 0) {
+        return -1;
+      }
+      snapshotRanges(ranges, initial);
+      fast_result = invokeFastSimulation(m_fast, ptr, false);
+      snapshotRanges(ranges, fast);
+      restoreRanges(ranges, initial);
+    }
+
     int result = -1;
    
     sc_process_handle h = sc_spawn(&result, sc_bind(m_exec, ptr)  );
     wait(h.terminated_event());
 
+    if (fidelity == MURAC_FIDELITY_CHECK) {
+      if (fast_result != result) {
+        cout << "@" << sc_time_stamp() << " Kernel " << (kernel ? kernel : "<unnamed>")
+             << " fast path status " << fast_result << " MISMATCH against cycle model status " << result << endl;
+      }
+      if (compareRanges(ranges, fast) != 0) {
+        cout << "@" << sc_time_stamp() << " Kernel " << (kernel ? kernel : "<unnamed>")
+             << " fast path MISMATCH against cycle model" << endl;
+      }
+    }
+
     //dlclose(handle);
 
     return result;
 }
 
+int muracAA::invokeFastSimulation(void *fn, unsigned long int ptr, bool advance) {
+    murac_exec_fast_func m_fast = (murac_exec_fast_func) fn;
+
+    unsigned long long cycles = 0;
+    int result = m_fast(ptr, &cycles);
+    if (result < 0) {
+      cout << "@" << sc_time_stamp() << " Fast AA simulation failed" << endl;
+      return result;
+    }
+    cout << "@" << sc_time_stamp() << " Fast AA simulation estimated " << cycles << " cycles" << endl;
+
+    if (advance && cycles > 0) {
+      wait(clock_period * (double) cycles);
+    }
+    return result;
+}
+
+/**
+ * Ranges of direct memory compared in check mode, as declared by the kernel.
+ * Kernels without murac_kernel_writes are checked over all direct memory.
+ */
+int muracAA::writtenRanges(void *fn, unsigned long int ptr, const char *kernel, std::vector<murac_range> &ranges) {
+    ranges.clear();
+
+    if (!fn) {
+      cout << "@" << sc_time_stamp() << " Kernel " << (kernel ? kernel : "<unnamed>")
+           << " declares no write ranges, checking all direct memory" << endl;
+      for (size_t i = 0; i < direct_memories.size(); i++) {
+        murac_range range = { direct_memories[i].base, direct_memories[i].size };
+        ranges.push_back(range);
+      }
+      return 0;
+    }
+
+    murac_range declared[MURAC_MAX_WRITE_RANGES];
+    int count = ((murac_writes_func) fn)(ptr, declared, MURAC_MAX_WRITE_RANGES);
+    if (count < 0 || count > MURAC_MAX_WRITE_RANGES) {
+      cout << "@" << sc_time_stamp() << " Kernel write ranges unavailable" << endl;
+      return -1;
+    }
+    for (int i = 0; i < count; i++) {
+      if (declared[i].size && !map(declared[i].base, declared[i].size)) {
+        cout << "@" << sc_time_stamp() << " Kernel write range 0x" << hex << declared[i].base
+             << "+0x" << declared[i].size << dec << " is not in direct memory" << endl;
+        return -1;
+      }
+      ranges.push_back(declared[i]);
+    }
+    return 0;
+}
+
+void muracAA::snapshotRanges(const std::vector<murac_range> &ranges, std::vector<std::vector<unsigned char> > &snapshot) {
+    snapshot.resize(ranges.size());
+    for (size_t i = 0; i < ranges.size(); i++) {
+      const unsigned char *mem = map(ranges[i].base, ranges[i].size);
+      snapshot[i].assign(mem, mem + ranges[i].size);
+    }
+}
+
+void muracAA::restoreRanges(const std::vector<murac_range> &ranges, const std::vector<std::vector<unsigned char> > &snapshot) {
+    for (size_t i = 0; i < ranges.size(); i++) {
+      if (ranges[i].size) {
+        memcpy(map(ranges[i].base, ranges[i].size), &snapshot[i][0], ranges[i].size);
+      }
+    }
+}
+
+/**
+ * Compare the written ranges against the state left by the fast model
+ */
+int muracAA::compareRanges(const std::vector<murac_range> &ranges, const std::vector<std::vector<unsigned char> > &fast) {
+    int mismatches = 0;
+    for (size_t i = 0; i < ranges.size(); i++) {
+      const unsigned char *mem = map(ranges[i].base, ranges[i].size);
+      for (unsigned long int j = 0; j < ranges[i].size; j++) {
+        if (mem[j] != fast[i][j]) {
+          if (mismatches++ < 16) {
+            cout << "    0x" << hex << ranges[i].base + j << ": cycle 0x" << (int) mem[j]
+                 << " fast 0x" << (int) fast[i][j] << dec << endl;
+          }
+        }
+      }
+    }
+    if (mismatches) {
+      cout << "    " << mismatches << " byte(s) differ" << endl;
+    }
+    return mismatches;
+}
+
 /**
  * Handle the BrArch interrupt from the PA
+ *
+ * With several PA cores each request is serviced in its own process so that
+ * the sibling cores are not blocked while the AA runs. A single PA core has
+ * nothing to run until RetArch, so its requests are serviced in place.
  */
-void muracAA::onBrArch(const int &value) {
-    cout << "@" << sc_time_stamp() << " onBrArch" << endl;
+void muracAA::onBrArch(unsigned int core) {
+    cout << "@" << sc_time_stamp() << " onBrArch (core " << core << ")" << endl;
+
+    if (num_cores > 1) {
+        sc_spawn(sc_bind(&muracAA::serviceBrArch, this, core));
+    } else {
+        serviceBrArch(core);
+    }
+}
 
+void muracAA::serviceBrArch(unsigned int core) {
     int ret = -1;
     int fd;
+    unsigned long int mailbox = MURAC_MAILBOX_ADDRESS(core);
     unsigned long int pc = 0;
     unsigned int instruction_size = 0;
     unsigned long int ptr = 0;
     unsigned char* fmap;
     char *tmp_file_name = strdup("/tmp/murac_AA_XXXXXX");
 
-    if (busRead(MURAC_PC_ADDRESS, (unsigned char*) &pc, 4) < 0) {
+    brarch_count++;
+
+    if (busRead(mailbox, (unsigned char*) &pc, 4) < 0) {
       cout << "@" << sc_time_stamp() << " Memory read error !" << endl;
       goto trigger_return_interrupt;
     }
 
     cout << "@" << sc_time_stamp() << " PC: 0x" << hex << pc << endl;
 
-    if (busRead(MURAC_PC_ADDRESS + 4, (unsigned char*) &instruction_size, 4) < 0) {
+    if (busRead(mailbox + 4, (unsigned char*) &instruction_size, 4) < 0) {
       cout << "@" << sc_time_stamp() << " Memory read error !" << endl;
       goto trigger_return_interrupt;
     }
     cout << "@" << sc_time_stamp() << " Instruction size: " << dec << instruction_size << endl;
 
-    if (busRead(MURAC_PC_ADDRESS + 8, (unsigned char*) &ptr, 4) < 0) {
+    if (busRead(mailbox + 8, (unsigned char*) &ptr, 4) < 0) {
       cout << "@" << sc_time_stamp() << " Memory read error !" << endl;
       goto trigger_return_interrupt;
     }
@@ -157,9 +390,11 @@ void muracAA::onBrArch(const int &value) {
 
     close(fd);
 
+    fabric.lock();
     cout << "@" << sc_time_stamp() << " Running murac AA simulation " << endl;
     ret = invokePluginSimulation(tmp_file_name, ptr);
     cout << "@" << sc_time_stamp() << " Simulation result = " << ret << endl;
+    fabric.unlock();
 
     remove(tmp_file_name);
     
@@ -167,11 +402,11 @@ void muracAA::onBrArch(const int &value) {
 
     free(tmp_file_name);
 
-    cout << "@" << sc_time_stamp() << " Returning to PA " << endl;
+    cout << "@" << sc_time_stamp() << " Returning to PA (core " << core << ")" << endl;
 
     // Trigger interrupt for return to PA
-    intRetArch.write(1);
-    intRetArch.write(0);
+    retarch_cores[core]->write(1);
+    retarch_cores[core]->write(0);
 }
 
 /**
@@ -230,3 +465,13 @@ int muracAA::read(unsigned long int addr, unsigned char*data, unsigned int len)
 int muracAA::write(unsigned long int addr, unsigned char*data, unsigned int len) {
     return busWrite(addr, data, len);  
 }
+
+unsigned char *muracAA::map(unsigned long int addr, unsigned int len) {
+    for (size_t i = 0; i < direct_memories.size(); i++) {
+      const directMemory &region = direct_memories[i];
+      if (addr >= region.base && addr - region.base + len <= region.size) {
+        return region.mem + (addr - region.base);
+      }
+    }
+    return 0;
+}
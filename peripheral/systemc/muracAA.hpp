@@ -6,6 +6,9 @@
 #ifndef MURAC_AA_H
 #define MURAC_AA_H
 
+#include <map>
+#include <string>
+#include <vector>
 #include "tlm.h"
 #include "tlm_utils/simple_target_socket.h"
 #include "tlm_utils/simple_initiator_socket.h"
@@ -13,40 +16,95 @@
 
 #define MURAC_PC_ADDRESS 0xCF000000
 
+// Each PA core has its own BAA mailbox, indexed by MPIDR affinity level 0
+#define MURAC_MAILBOX_SIZE          0x10
+#define MURAC_MAILBOX_ADDRESS(_CPU) (MURAC_PC_ADDRESS + (_CPU)*MURAC_MAILBOX_SIZE)
+#define MURAC_MAX_PA_CORES          4
+
 class muracAA;
 
+/* Fidelity at which an AA kernel is simulated */
+enum muracFidelity {
+    MURAC_FIDELITY_CYCLE,   // Cycle-level SystemC model (murac_execute)
+    MURAC_FIDELITY_FAST,    // Host-native functional model (murac_execute_fast)
+    MURAC_FIDELITY_CHECK    // Run both models and compare the results
+};
+
 class muracAAInterupt: public tlm::tlm_analysis_if<int> {
   public:
-      muracAAInterupt(const char *name, muracAA *aa);
+      muracAAInterupt(const char *name, muracAA *aa, unsigned int core = 0);
       void write(const int &value);
 
   private:
       muracAA      *m_aa;
-      const char   *m_name;
+      std::string   m_name;
+      unsigned int  m_core;
 };
 
 class muracAA: public sc_core::sc_module, BusInterface {
     public:
-        muracAA (sc_core::sc_module_name  name);
+        muracAA (sc_core::sc_module_name  name, unsigned int cores = 1);
+        ~muracAA ();
         tlm_utils::simple_initiator_socket<muracAA> aa_bus;
         
-        /* BrArch interrupt from the PA */
+        /* BrArch interrupt from PA core 0 */
         muracAAInterupt brarch;
 
-        /* RetArch interrupt to signal return to PA */
+        /* RetArch interrupt to signal return to PA core 0 */
         tlm::tlm_analysis_port<int>  intRetArch;
 
-        /* Handle BrArch interrupt */
-        void onBrArch(const int &value);
+        /* Per-core BrArch/RetArch, core 0 is brarch/intRetArch */
+        muracAAInterupt             &brarchCore(unsigned int core);
+        tlm::tlm_analysis_port<int> &intRetArchCore(unsigned int core);
+
+        /* Handle BrArch interrupt from the given PA core */
+        void onBrArch(unsigned int core);
     
         /* Bus interface */
         int read(unsigned long int addr, unsigned char*data, unsigned int len);
         int write(unsigned long int addr, unsigned char*data, unsigned int len);
+        unsigned char *map(unsigned long int addr, unsigned int len);
 
         int loadLibrary(const char *library);
-        
+
+        /* Expose host memory backing [base, base+size) to fast AA kernels */
+        void addDirectMemory(unsigned long int base, unsigned long int size, unsigned char *mem);
+
+        /* Select fidelity from "<mode>" or "<kernel>=<mode>" */
+        int setFidelity(const char *spec);
+
+        /* Clock period used to convert fast kernel cycle estimates to time */
+        void setClockPeriod(const sc_core::sc_time &period);
+
+        void end_of_simulation();
+
     private:
 
+        unsigned int                  num_cores;
+        muracAAInterupt              *brarch_cores[MURAC_MAX_PA_CORES];
+        tlm::tlm_analysis_port<int>  *retarch_cores[MURAC_MAX_PA_CORES];
+
+        /* Serialises kernels on the shared AA fabric */
+        sc_core::sc_mutex             fabric;
+
+        unsigned long long            brarch_count;
+
+        /* Service a BAA request from the given PA core */
+        void serviceBrArch(unsigned int core);
+
+        struct directMemory {
+            unsigned long int base;
+            unsigned long int size;
+            unsigned char    *mem;
+        };
+
+        std::vector<directMemory>            direct_memories;
+        std::map<std::string, muracFidelity> kernel_fidelity;
+        muracFidelity                        default_fidelity;
+        sc_core::sc_time                     clock_period;
+
+        muracFidelity getFidelity(const char *kernel);
+
         /* Bus transport payload */
         tlm::tlm_generic_payload bus_payload;
 
@@ -64,6 +122,16 @@ class muracAA: public sc_core::sc_module, BusInterface {
         void busTransfer(tlm::tlm_generic_payload &trans);
 
         int invokePluginSimulation(const char* path, unsigned long int ptr);
+
+        /* Run the host-native kernel, optionally advancing time by its cycle estimate, and return its status */
+        int invokeFastSimulation(void *fn, unsigned long int ptr, bool advance);
+
+        /* Direct memory the kernel writes, from its optional murac_kernel_writes */
+        int writtenRanges(void *fn, unsigned long int ptr, const char *kernel, std::vector<murac_range> &ranges);
+
+        void snapshotRanges(const std::vector<murac_range> &ranges, std::vector<std::vector<unsigned char> > &snapshot);
+        void restoreRanges(const std::vector<murac_range> &ranges, const std::vector<std::vector<unsigned char> > &snapshot);
+        int compareRanges(const std::vector<murac_range> &ranges, const std::vector<std::vector<unsigned char> > &expected);
 };
 
 #endif  // MURAC_AA_H
\ No newline at end of file
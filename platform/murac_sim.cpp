@@ -8,6 +8,8 @@
  */
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "tlm.h"
 #include "ovpworld.org/modelSupport/tlmPlatform/1.0/tlm2.0/tlmPlatform.hpp"
@@ -28,7 +30,11 @@
 
 class MuracPlatform : public sc_core::sc_module {
   public:
-    MuracPlatform (sc_core::sc_module_name name);
+    // Extra PA model parameters, as name and value
+    typedef std::vector<std::pair<std::string, std::string> > ParamList;
+
+    MuracPlatform (sc_core::sc_module_name name, bool staticDecode = true, const char *variant = "Cortex-A8",
+                   const ParamList &paParams = ParamList());
     icmTLMPlatform  platform;
     
     decoder<2,3>    pa_bus;      // PA bus
@@ -48,18 +54,26 @@ class MuracPlatform : public sc_core::sc_module {
     murac_arm       pa;       // Murac Primary architecture
 #endif
 
-    icmAttrListObject *attributesForPA() {
+    icmAttrListObject *attributesForPA(bool staticDecode, const char *variant, const ParamList &paParams) {
         icmAttrListObject *userAttrs = new icmAttrListObject;
         userAttrs->addAttr("showHiddenRegs", "0");
         userAttrs->addAttr("compatibility", "ISA");
-        userAttrs->addAttr("variant", "Cortex-A8");
+        userAttrs->addAttr("variant", variant);
         userAttrs->addAttr("override_debugMask",0);
+#ifndef INTECEPT_OBJECT_SUPPORTED
+        // Parameters of the MURAC PA model only, the stock model rejects them
+        userAttrs->addAttr("staticDecode", staticDecode ? 1 : 0);
+        for (size_t i = 0; i < paParams.size(); i++) {
+            userAttrs->addAttr(paParams[i].first.c_str(), paParams[i].second.c_str());
+        }
+#endif
         return userAttrs;
     }
 };
 
 
-MuracPlatform::MuracPlatform (sc_core::sc_module_name name)
+MuracPlatform::MuracPlatform (sc_core::sc_module_name name, bool staticDecode, const char *variant,
+                              const ParamList &paParams)
     : sc_core::sc_module (name),
       platform ("icm", ICM_VERBOSE | ICM_STOP_ON_CTRLC | ICM_ENABLE_IMPERAS_INTERCEPTS | ICM_WALLCLOCK),
       pa_bus("pa_bus"),
@@ -71,9 +85,9 @@ MuracPlatform::MuracPlatform (sc_core::sc_module_name name)
       murac_memory("mem_murac", "sp1", 0x1000000),
       aa("aa"),
 #ifdef INTECEPT_OBJECT_SUPPORTED
-      pa ( "pa", 0, ICM_ATTR_SIMEX | ICM_ATTR_TRACE_ICOUNT | ICM_ATTR_RELAXED_SCHED, attributesForPA() )
+      pa ( "pa", 0, ICM_ATTR_SIMEX | ICM_ATTR_TRACE_ICOUNT | ICM_ATTR_RELAXED_SCHED, attributesForPA(staticDecode, variant, paParams) )
 #else
-      pa ( "pa", 0, MURAC_PA_MODEL_FILE, ICM_ATTR_SIMEX | ICM_ATTR_TRACE_ICOUNT | ICM_ATTR_RELAXED_SCHED , attributesForPA() )
+      pa ( "pa", 0, MURAC_PA_MODEL_FILE, ICM_ATTR_SIMEX | ICM_ATTR_TRACE_ICOUNT | ICM_ATTR_RELAXED_SCHED , attributesForPA(staticDecode, variant, paParams) )
 #endif
 {
 #ifdef INTECEPT_OBJECT_SUPPORTED
@@ -123,19 +137,62 @@ int sc_main (int argc, char *argv[]) {
 
     const char *pa_exe = "application/pa/murac_test.ARM7.elf";
     const char *aa_lib = 0;//SYSTEMC_LIB;
+    std::vector<const char *> fidelity;
+    bool static_decode = true;
+    bool buffer_console = false;
+    bool binary_trace = false;
+    const char *variant = "Cortex-A8";
+    MuracPlatform::ParamList pa_params;
     sc_time stop(10000,SC_MS);
 
-    if (argc > 1) {
-        pa_exe = argv[1];
-        if (argc > 2) {
-            aa_lib = argv[2];
+    int arg = 1;
+    while (arg < argc) {
+        if (arg < argc - 1 && strcmp(argv[arg], "-fidelity") == 0) {
+            fidelity.push_back(argv[arg + 1]);
+            arg += 2;
+        } else if (arg < argc - 1 && strcmp(argv[arg], "-variant") == 0) {
+            variant = argv[arg + 1];
+            arg += 2;
+        } else if (arg < argc - 1 && strcmp(argv[arg], "-paparam") == 0) {
+            std::string param(argv[arg + 1]);
+            size_t eq = param.find('=');
+            if (eq == std::string::npos) {
+                cout << "Expected <name>=<value> for -paparam, got " << param << endl;
+                return -1;
+            }
+            pa_params.push_back(std::make_pair(param.substr(0, eq), param.substr(eq + 1)));
+            arg += 2;
+        } else if (strcmp(argv[arg], "-runtimedecode") == 0) {
+            static_decode = false;
+            arg++;
+        } else if (strcmp(argv[arg], "-bufferconsole") == 0) {
+            buffer_console = true;
+            arg++;
+        } else if (strcmp(argv[arg], "-binarytrace") == 0) {
+            binary_trace = true;
+            arg++;
+        } else {
+            break;
+        }
+    }
+
+    if (arg < argc) {
+        pa_exe = argv[arg];
+        if (arg + 1 < argc) {
+            aa_lib = argv[arg + 1];
         }
     } else {
-        cout << endl << "Usage: " << argv[0] << " <pa application> [<aa library>]" << endl;
+        cout << endl << "Usage: " << argv[0] << " [-runtimedecode] [-bufferconsole] [-binarytrace] [-variant <pa variant>] [-paparam <name>=<value>]... [-fidelity [<kernel>=]<cycle|fast|check>]... <pa application> [<aa library>]" << endl;
         cout << "       Please specify application and library for simulation" << endl;
         return 0;
     }
 
+#ifdef INTECEPT_OBJECT_SUPPORTED
+    if (!static_decode || !pa_params.empty()) {
+        cout << "-runtimedecode and -paparam only apply to the MURAC PA model, ignored" << endl;
+    }
+#endif
+
     sc_report_handler::set_actions("/IEEE_Std_1666/deprecated", SC_DO_NOTHING);
 
     // Ignore some of the Warning messages
@@ -143,14 +200,34 @@ int sc_main (int argc, char *argv[]) {
 
     cout << "Running MURAC TLM platform simulator" << endl;
 
-    MuracPlatform murac("murac");
+    MuracPlatform murac("murac", static_decode, variant, pa_params);
 
     murac.pa.setIPS(1000);
 
+    // Buffer PA stdout/stderr in the host instead of a semihosting write per call
+    if (buffer_console) {
+        murac.pa.addInterceptObject("console", MURAC_PA_INSTRUCTIONS_FILE, "consoleAttrs", 0);
+    }
+
+    // Record a binary trace of PA instructions in murac_<processor>.trace, for murac_tracedump
+    if (binary_trace) {
+        murac.pa.addInterceptObject("trace", MURAC_PA_INSTRUCTIONS_FILE, "traceAttrs", 0);
+    }
+
     // Load the PA application into memory
     unsigned char *targetPtr = murac.shared_memory.getMemory()->get_mem_ptr();
     murac.pa.loadNativeMemory(targetPtr, 0x1000000, 0x00000000, "mem_shared", pa_exe, 0, 1, 1);
 
+    // Allow fast AA kernels to work directly on shared and signalling memory
+    murac.aa.addDirectMemory(0x00000000, 0x1000000, targetPtr);
+    murac.aa.addDirectMemory(0xCF000000, 0x1000000, murac.murac_memory.getMemory()->get_mem_ptr());
+
+    for (size_t i = 0; i < fidelity.size(); i++) {
+        if (murac.aa.setFidelity(fidelity[i]) < 0) {
+            return -1;
+        }
+    }
+
     // Load the AA library
     if (aa_lib) {
         murac.aa.loadLibrary(aa_lib);
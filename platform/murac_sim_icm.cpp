@@ -0,0 +1,350 @@
+/**
+ *
+ * Morphable Runtime Architecture Computer
+ * Platform Configuration (ICM C API)
+ *
+ * The PA, its memories and bus decoding are built directly with the ICM
+ * API, so PA accesses never pass through SystemC TLM decoders. BrArch is
+ * handled in-process: the brArch callback interrupts the ICM simulation,
+ * and the top-level loop runs the embedded AA kernel natively through
+ * murac_execute_fast, or in the SystemC kernel through murac_execute when
+ * only the cycle model is available (or requested). Simulation time is
+ * advanced by the kernel's duration before RetArch, and the PA resumes.
+ *
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include <systemc.h>
+#include "icm/icmCpuManager.h"
+#include "../framework/murac.h"
+
+#define MURAC_PC_ADDRESS    0xCF000000
+
+#define SHARED_BASE         0x00000000
+#define SHARED_SIZE         0x01000000
+#define SIGNAL_BASE         0xCF000000
+#define SIGNAL_SIZE         0x01000000
+
+#define SIMULATION_FLAGS ( ICM_ATTR_DEFAULT | \
+                           ICM_ATTR_RELAXED_SCHED )
+
+// AA clock period for native kernel cycle estimates, as in muracAA
+#define AA_CLOCK_PERIOD     1e-3
+
+typedef int (*murac_init_func)(BusInterface*);
+typedef int (*murac_exec_func)(unsigned long int);
+typedef int (*murac_exec_fast_func)(unsigned long int, unsigned long long*);
+
+/**
+ * AA view of the platform; shared and signalling memory are host buffers
+ * mapped into the PA bus, everything else goes through the PA
+ */
+class IcmBus : public BusInterface {
+public:
+    icmProcessorP  pa;
+    unsigned char *shared;
+    unsigned char *signal;
+
+    unsigned char *map(unsigned long int addr, unsigned int len) {
+        if (addr >= SHARED_BASE && addr - SHARED_BASE + len <= SHARED_SIZE) {
+            return shared + (addr - SHARED_BASE);
+        }
+        if (addr >= SIGNAL_BASE && addr - SIGNAL_BASE + len <= SIGNAL_SIZE) {
+            return signal + (addr - SIGNAL_BASE);
+        }
+        return 0;
+    }
+
+    int read(unsigned long int addr, unsigned char*data, unsigned int len) {
+        unsigned char *mem = map(addr, len);
+        if (mem) {
+            memcpy(data, mem, len);
+            return 0;
+        }
+        return icmReadProcessorMemory(pa, addr, data, len) ? 0 : -1;
+    }
+
+    int write(unsigned long int addr, unsigned char*data, unsigned int len) {
+        unsigned char *mem = map(addr, len);
+        if (mem) {
+            memcpy(mem, data, len);
+            return 0;
+        }
+        return icmWriteProcessorMemory(pa, addr, data, len) ? 0 : -1;
+    }
+};
+
+static struct {
+    IcmBus     bus;
+    icmNetP    retArch;
+    bool       cycleModel;   // always use the SystemC model
+    bool       pending;      // BrArch raised, not yet serviced
+    Uns64      calls;
+    Uns64      fastCycles;   // estimated AA cycles from native kernels
+    sc_time    systemcTime;  // AA time spent in the SystemC kernel
+    double     aaTime;       // simulated time the PA waited for RetArch
+} aa;
+
+static int runSystemC(murac_exec_func exec, unsigned long int ptr, bool *done) {
+    int result = exec(ptr);
+    *done = true;
+    return result;
+}
+
+/**
+ * Run murac_execute in the SystemC kernel until the kernel returns. Only
+ * called from the top-level loop, never from an ICM callback.
+ */
+static int invokeSystemC(murac_exec_func exec, unsigned long int ptr) {
+    int     result = -1;
+    bool    done   = false;
+    sc_time start  = sc_time_stamp();
+    sc_time quantum(1, SC_MS);
+
+    sc_spawn(&result, sc_bind(&runSystemC, exec, ptr, &done));
+    while (!done) {
+        sc_start(quantum);
+    }
+    aa.systemcTime += sc_time_stamp() - start;
+    return result;
+}
+
+/**
+ * Extract the AA instruction block following the BAA and run it. Returns
+ * the kernel result, and its duration in seconds in duration.
+ */
+static int runAuxiliaryArchitecture(double *duration) {
+    unsigned int   mailbox[3];
+    unsigned char *block;
+    char           path[] = "/tmp/murac_AA_XXXXXX";
+    int            result = -1;
+
+    if (aa.bus.read(MURAC_PC_ADDRESS, (unsigned char *) mailbox, sizeof(mailbox)) < 0) {
+        icmPrintf("[AA] Mailbox read error\n");
+        return -1;
+    }
+
+    block = aa.bus.map(mailbox[0], mailbox[1]);
+    if (!block) {
+        icmPrintf("[AA] AA instruction block at 0x%x is not in shared memory\n", mailbox[0]);
+        return -1;
+    }
+
+    int fd = mkstemp(path);
+    if (fd == -1 || ::write(fd, block, mailbox[1]) != (ssize_t) mailbox[1]) {
+        icmPrintf("[AA] Cannot write temporary file %s\n", path);
+        if (fd != -1) {
+            close(fd);
+            remove(path);
+        }
+        return -1;
+    }
+    close(fd);
+
+    void *handle = dlopen(path, RTLD_LAZY | RTLD_GLOBAL);
+    remove(path);
+    if (!handle) {
+        icmPrintf("[AA] %s\n", dlerror());
+        return -1;
+    }
+
+    murac_exec_fast_func fast = (murac_exec_fast_func) dlsym(handle, "murac_execute_fast");
+    murac_exec_func      exec = (murac_exec_func) dlsym(handle, "murac_execute");
+    dlerror();
+
+    if (fast && !aa.cycleModel) {
+        unsigned long long cycles = 0;
+        result = fast(mailbox[2], &cycles);
+        if (result >= 0) {
+            aa.fastCycles += cycles;
+            *duration = cycles * AA_CLOCK_PERIOD;
+        }
+    } else if (exec) {
+        sc_time start = sc_time_stamp();
+        result = invokeSystemC(exec, mailbox[2]);
+        *duration = (sc_time_stamp() - start).to_seconds();
+    } else {
+        icmPrintf("[AA] AA instruction block exports no murac_execute\n");
+    }
+
+    aa.calls++;
+    return result;
+}
+
+/**
+ * BrArch stops the simulation, the request is serviced by the top-level loop
+ */
+static void brArchCB(void *userData, Uns32 value) {
+    if (value == 1) {
+        aa.pending = true;
+        icmInterrupt();
+    }
+}
+
+/**
+ * Service a BrArch request between runs of the ICM simulation: the PA
+ * waits for the kernel's duration and then receives RetArch
+ */
+static void serviceBrArch(void) {
+    double duration = 0;
+
+    aa.pending = false;
+    runAuxiliaryArchitecture(&duration);
+
+    if (duration > 0) {
+        icmAdvanceTime(icmGetCurrentTime() + duration);
+        aa.aaTime += duration;
+    }
+
+    // Return to the PA
+    icmWriteNet(aa.retArch, 1);
+    icmWriteNet(aa.retArch, 0);
+}
+
+static int loadLibrary(const char *library) {
+    icmPrintf("Loading murac library: %s\n", library);
+    void *handle = dlopen(library, RTLD_NOW | RTLD_GLOBAL);
+    if (!handle) {
+        icmPrintf("%s\n", dlerror());
+        return -1;
+    }
+    murac_init_func init = (murac_init_func) dlsym(handle, "murac_init");
+    return init ? init(&aa.bus) : -1;
+}
+
+static double wallTime(void) {
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+int sc_main(int argc, char *argv[]) {
+
+    const char *variant = "Cortex-A8";
+
+    int arg = 1;
+    while (arg < argc) {
+        if (!strcmp(argv[arg], "-cycle")) {
+            aa.cycleModel = true;
+            arg++;
+        } else if (arg < argc - 1 && !strcmp(argv[arg], "-variant")) {
+            variant = argv[arg + 1];
+            arg += 2;
+        } else {
+            break;
+        }
+    }
+
+    if (arg >= argc) {
+        icmPrintf("usage: %s [-cycle] [-variant <pa variant>] <pa application> [<aa library>]\n", argv[0]);
+        return -1;
+    }
+    const char *pa_exe = argv[arg];
+    const char *aa_lib = arg + 1 < argc ? argv[arg + 1] : 0;
+
+    sc_report_handler::set_actions("/IEEE_Std_1666/deprecated", SC_DO_NOTHING);
+
+    icmInit(ICM_VERBOSE | ICM_STOP_ON_CTRLC | ICM_ENABLE_IMPERAS_INTERCEPTS, NULL, 0);
+
+    // Ignore some of the Warning messages
+    icmIgnoreMessage ("ICM_NPF");
+
+    /***************************************************************************************************
+       MURAC Primary Architecture
+     ***************************************************************************************************/
+#ifdef INTECEPT_OBJECT_SUPPORTED
+    const char *armModel    = icmGetVlnvString(NULL, "arm.ovpworld.org", "processor", "arm", "1.0", "model");
+#endif
+    const char *armSemihost = icmGetVlnvString(NULL, "arm.ovpworld.org", "semihosting", "armNewlib", "1.0", "model");
+
+    icmAttrListP armUserAttr = icmNewAttrList();
+    icmAddStringAttr(armUserAttr, "compatibility", "ISA");
+    icmAddStringAttr(armUserAttr, "variant", variant);
+
+    icmProcessorP pa = icmNewProcessor(
+        "pa",                // CPU name
+        "arm",               // CPU type
+        0,                   // CPU cpuId
+        0,                   // CPU model flags
+        32,                  // address bits
+#ifdef INTECEPT_OBJECT_SUPPORTED
+        armModel,            // model file
+#else
+        MURAC_PA_MODEL_FILE, // model file
+#endif
+        "modelAttrs",        // model attributes
+        SIMULATION_FLAGS,    // simulation flags
+        armUserAttr,         // user-defined attributes
+        armSemihost,         // semi-hosting file
+        "modelAttrs"         // semi-hosting attributes
+    );
+
+#ifdef INTECEPT_OBJECT_SUPPORTED
+    icmAddInterceptObject(pa, "murac_pa", MURAC_PA_INSTRUCTIONS_FILE, "modelAttrs", 0);
+#endif
+
+    /***************************************************************************************************
+       System Memory and Bus
+     ***************************************************************************************************/
+    icmBusP busPA = icmNewBus("pa_bus", 32);
+    icmConnectProcessorBusses(pa, busPA, busPA);
+
+    // Local memory for the PA
+    icmMemoryP localPA = icmNewMemory("mem_pa", ICM_PRIV_RWX, 0x000fffff);
+    icmConnectMemoryToBus(busPA, "mem_pa_port", localPA, 0xfff00000);
+
+    // Shared and signalling memory are host buffers, also used directly by the AA
+    aa.bus.pa     = pa;
+    aa.bus.shared = (unsigned char *) calloc(SHARED_SIZE, 1);
+    aa.bus.signal = (unsigned char *) calloc(SIGNAL_SIZE, 1);
+    icmMapNativeMemory(busPA, ICM_PRIV_RWX, SHARED_BASE, SHARED_BASE + SHARED_SIZE - 1, aa.bus.shared);
+    icmMapNativeMemory(busPA, ICM_PRIV_RWX, SIGNAL_BASE, SIGNAL_BASE + SIGNAL_SIZE - 1, aa.bus.signal);
+
+    /***************************************************************************************************
+       System Interrupt connections
+     ***************************************************************************************************/
+    icmNetP intBrArch = icmNewNet("brArch");
+    aa.retArch        = icmNewNet("retArch");
+
+    icmConnectProcessorNet(pa, intBrArch, "brarch", ICM_OUTPUT);
+    icmConnectProcessorNet(pa, aa.retArch, "fiq", ICM_INPUT);
+    icmAddNetCallback(intBrArch, brArchCB, 0);
+
+    /***************************************************************************************************
+       MURAC Simulation
+     ***************************************************************************************************/
+    if (aa_lib && loadLibrary(aa_lib) < 0) {
+        return -1;
+    }
+
+    icmLoadProcessorMemory(pa, pa_exe, False, False, True);
+
+    double start = wallTime();
+    icmProcessorP final = icmSimulatePlatform();
+    while (aa.pending) {
+        serviceBrArch();
+        final = icmSimulatePlatform();
+    }
+    double elapsed = wallTime() - start;
+
+    if ( final && (icmGetStopReason(final) == ICM_SR_INTERRUPT ) ) {
+        icmPrintf("*** MURAC simulation interrupted\n");
+    }
+
+    Uns64 icount = icmGetProcessorICount(pa);
+    icmPrintf("MURAC Primary Architecture has executed " FMT_64u " instructions\n", icount);
+    icmPrintf("MURAC PA throughput: %.2f MIPS (%.3f s host time)\n", elapsed > 0 ? icount / elapsed / 1e6 : 0.0, elapsed);
+    icmPrintf("MURAC AA calls: " FMT_64u ", native kernel cycles: " FMT_64u ", SystemC time: %s, AA time: %.3f s\n",
+        aa.calls, aa.fastCycles, aa.systemcTime.to_string().c_str(), aa.aaTime);
+
+    icmTerminate();
+
+    return 0;
+}
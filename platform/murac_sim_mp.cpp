@@ -0,0 +1,182 @@
+/**
+ *
+ * Morphable Runtime Architecture Computer
+ * Multi-core Platform Configuration
+ *
+ * An MPCore cluster acts as the PA. Each core branches to the shared AA
+ * through its own mailbox and BrArch/RetArch nets.
+ *
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "tlm.h"
+#include "ovpworld.org/modelSupport/tlmPlatform/1.0/tlm2.0/tlmPlatform.hpp"
+#include "ovpworld.org/modelSupport/tlmDecoder/1.0/tlm2.0/tlmDecoder.hpp"
+#include "ovpworld.org/memory/ram/1.0/tlm2.0/tlmMemory.hpp"
+#include "../peripheral/systemc/muracAA.hpp"
+#ifdef INTECEPT_OBJECT_SUPPORTED
+#error "The multi-core MURAC platform requires the full PA processor model"
+#else
+#include "../processor/tlm2.0/processor.igen.hpp"
+#endif
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES 1
+
+class MuracMPPlatform : public sc_core::sc_module {
+  public:
+    MuracMPPlatform (sc_core::sc_module_name name, unsigned int cores);
+    icmTLMPlatform  platform;
+    
+    decoder<2,3>    pa_bus;      // PA bus
+    decoder<1,3>    aa_bus;      // AA bus
+    decoder<4,2>    shared_bus;  // Shared memory bridge
+
+    ram             pa_memory;     // Local memory for PA
+    ram             aa_memory;     // Local memory for AA
+    ram             shared_memory; // Shared memory exposed to all processors
+    ram             murac_memory;  // Shared memory used for murac specific signalling
+
+    muracAA         aa;       // Murac Auxiliary architecture
+    murac_arm_mp    pa;       // Murac Primary architecture (MPCore cluster)
+
+    icmAttrListObject *attributesForPA(unsigned int cores) {
+        static char variant[32];
+        sprintf(variant, "Cortex-A9MPx%u", cores);
+        icmAttrListObject *userAttrs = new icmAttrListObject;
+        userAttrs->addAttr("showHiddenRegs", "0");
+        userAttrs->addAttr("compatibility", "ISA");
+        userAttrs->addAttr("variant", variant);
+        userAttrs->addAttr("override_debugMask",0);
+        return userAttrs;
+    }
+};
+
+
+MuracMPPlatform::MuracMPPlatform (sc_core::sc_module_name name, unsigned int cores)
+    : sc_core::sc_module (name),
+      platform ("icm", ICM_VERBOSE | ICM_STOP_ON_CTRLC | ICM_ENABLE_IMPERAS_INTERCEPTS | ICM_WALLCLOCK),
+      pa_bus("pa_bus"),
+      aa_bus("aa_bus"),
+      shared_bus("shared_bus"),
+      pa_memory("mem_pa", "sp1", 0x100000),
+      aa_memory("mem_aa", "sp1", 0x100000),
+      shared_memory("mem_shared", "sp1", 0x1000000),
+      murac_memory("mem_murac", "sp1", 0x1000000),
+      aa("aa", cores),
+      pa ( "pa", 0, cores, MURAC_PA_MODEL_FILE, ICM_ATTR_SIMEX | ICM_ATTR_TRACE_ICOUNT | ICM_ATTR_RELAXED_SCHED , attributesForPA(cores) )
+{
+    // PA bus master
+    pa.INSTRUCTION.socket(pa_bus.target_socket[0]);
+    pa.DATA.socket(pa_bus.target_socket[1]);
+
+    // PA bus slaves
+    pa_bus.initiator_socket[0](pa_memory.sp1);
+    pa_bus.setDecode(0, 0xFFF00000, 0xFFFFFFFF);
+
+    pa_bus.initiator_socket[1](shared_bus.target_socket[0]);
+    pa_bus.setDecode(1, 0x00000000, 0x00FFFFFF);
+
+    pa_bus.initiator_socket[2](shared_bus.target_socket[1]);
+    pa_bus.setDecode(2, 0xCF000000, 0xCFFFFFFF);
+
+    // AA bus master
+    aa.aa_bus(aa_bus.target_socket[0]);
+
+    // AA bus slaves
+    aa_bus.initiator_socket[0](aa_memory.sp1);
+    aa_bus.setDecode(0, 0xFFF00000, 0xFFFFFFFF);
+
+    aa_bus.initiator_socket[1](shared_bus.target_socket[2]);
+    aa_bus.setDecode(1, 0x00000000, 0x00FFFFFF);
+
+    aa_bus.initiator_socket[2](shared_bus.target_socket[3]);
+    aa_bus.setDecode(2, 0xCF000000, 0xCFFFFFFF);
+
+    // Share memory bridge
+    shared_bus.initiator_socket[0](shared_memory.sp1);
+    shared_bus.setDecode(0, 0x00000000, 0x00FFFFFF);
+
+    shared_bus.initiator_socket[1](murac_memory.sp1);
+    shared_bus.setDecode(1, 0xCF000000, 0xCFFFFFFF);
+
+    // Interrupts, one BrArch/RetArch pair per core
+    for (unsigned int i = 0; i < pa.numCPUs; i++) {
+        (*pa.brarch[i])( aa.brarchCore(i) );
+        aa.intRetArchCore(i)( *pa.fiq[i] );
+    }
+}
+
+int sc_main (int argc, char *argv[]) {
+
+    const char *pa_exe = 0;
+    const char *aa_lib = 0;
+    unsigned int cores = 2;
+    std::vector<const char *> fidelity;
+
+    int arg = 1;
+    while (arg < argc - 1 && argv[arg][0] == '-') {
+        if (strcmp(argv[arg], "-cores") == 0) {
+            cores = atoi(argv[arg + 1]);
+        } else if (strcmp(argv[arg], "-fidelity") == 0) {
+            fidelity.push_back(argv[arg + 1]);
+        } else {
+            break;
+        }
+        arg += 2;
+    }
+
+    if (arg < argc && cores >= 1 && cores <= MURAC_MAX_PA_CORES) {
+        pa_exe = argv[arg];
+        if (arg + 1 < argc) {
+            aa_lib = argv[arg + 1];
+        }
+    } else {
+        cout << endl << "Usage: " << argv[0] << " [-cores <1-" << MURAC_MAX_PA_CORES << ">] [-fidelity [<kernel>=]<cycle|fast|check>]... <pa application> [<aa library>]" << endl;
+        cout << "       Please specify application and library for simulation" << endl;
+        return 0;
+    }
+
+    sc_report_handler::set_actions("/IEEE_Std_1666/deprecated", SC_DO_NOTHING);
+
+    // Ignore some of the Warning messages
+    icmIgnoreMessage ("ICM_NPF");
+
+    cout << "Running MURAC TLM multi-core platform simulator (" << cores << " PA cores)" << endl;
+
+    MuracMPPlatform murac("murac", cores);
+
+    murac.pa.setIPS(1000);
+
+    // Load the PA application into memory, all cores start at its entry
+    unsigned char *targetPtr = murac.shared_memory.getMemory()->get_mem_ptr();
+    murac.pa.loadNativeMemory(targetPtr, 0x1000000, 0x00000000, "mem_shared", pa_exe, 0, 1, 1);
+
+    // Allow fast AA kernels to work directly on shared and signalling memory
+    murac.aa.addDirectMemory(0x00000000, 0x1000000, targetPtr);
+    murac.aa.addDirectMemory(0xCF000000, 0x1000000, murac.murac_memory.getMemory()->get_mem_ptr());
+
+    for (size_t i = 0; i < fidelity.size(); i++) {
+        if (murac.aa.setFidelity(fidelity[i]) < 0) {
+            return -1;
+        }
+    }
+
+    // Load the AA library
+    if (aa_lib) {
+        murac.aa.loadLibrary(aa_lib);
+    }
+
+    // Specify the debug processor.
+    murac.pa.debugThisProcessor();
+
+    sc_report_handler::set_actions (SC_ID_MORE_THAN_ONE_SIGNAL_DRIVER_, SC_DO_NOTHING);
+    // Start the simulation
+    cout << "Starting sc_main." << endl;
+    sc_core::sc_start();
+    cout << "Finished sc_main." << endl;
+    return 0;
+}
@@ -109,7 +109,8 @@ int main(int argc, char **argv) {
     if(finishOnSoftReset) {
         icmAddUns64Attr(fpgaAttrs, "stoponsoftreset",  1);
     }
-    icmPseP muracFpga = icmNewPSE("muracFpga", MURAC_AA_FPGA_PSE_FILE, fpgaAttrs, 0, 0);
+    // the native kernel library runs the PSE kernels on the host
+    icmPseP muracFpga = icmNewPSE("muracFpga", MURAC_AA_FPGA_PSE_FILE, fpgaAttrs, MURAC_AA_FPGA_NATIVE_FILE, "modelAttrs");
 
     // Connect memory access ports to the bus
     icmConnectPSEBus(muracFpga, busAA, "fpga_memread", True, 0x00000000, 0xffffffff);
@@ -25,13 +25,14 @@ class MuracPlatform : public sc_core::sc_module {
     MuracPlatform (sc_core::sc_module_name name);
     icmTLMPlatform  platform;
 
-    decoder<2,2>    pa_bus;      // PA bus
-    decoder<2,2>    aa_bus;      // AA bus
-    decoder<2,1>    shared_bus;  // Shared memory bridge
+    decoder<2,3>    pa_bus;      // PA bus
+    decoder<2,3>    aa_bus;      // AA bus
+    decoder<4,2>    shared_bus;  // Shared memory bridge
 
     ram             pa_memory;
     ram             aa_memory;
     ram             shared_memory;
+    ram             murac_memory;  // Shared memory used for murac specific signalling
 
     muracFPGA       aa;       // Murac Auxilliary Architecture
 
@@ -60,8 +61,9 @@ MuracPlatform::MuracPlatform (sc_core::sc_module_name name)
       shared_bus("shared_bus"),
       pa_memory("mem_pa", "sp1", 0x100000),
       aa_memory("mem_aa", "sp1", 0x100000),
-      shared_memory("mem_shared", "sp1", 0x100000),
-      aa ( "aa", MURAC_AA_FPGA_PSE_FILE, 0 ),
+      shared_memory("mem_shared", "sp1", 0x1000000),
+      murac_memory("mem_murac", "sp1", 0x1000000),
+      aa ( "aa", MURAC_AA_FPGA_PSE_FILE, MURAC_AA_FPGA_NATIVE_FILE ),
 #ifdef INTECEPT_OBJECT_SUPPORTED
       pa ( "pa", 0, ICM_ATTR_SIMEX | ICM_ATTR_TRACE_ICOUNT | ICM_ATTR_RELAXED_SCHED, attributesForPA() )
 #else
@@ -80,7 +82,10 @@ MuracPlatform::MuracPlatform (sc_core::sc_module_name name)
     pa_bus.setDecode(0, 0xFFF00000, 0xFFFFFFFF);
 
     pa_bus.initiator_socket[1](shared_bus.target_socket[0]);
-    pa_bus.setDecode(1, 0x00000000, 0x000FFFFF);
+    pa_bus.setDecode(1, 0x00000000, 0x00FFFFFF);
+
+    pa_bus.initiator_socket[2](shared_bus.target_socket[1]);
+    pa_bus.setDecode(2, 0xCF000000, 0xCFFFFFFF);
 
     // AA bus master
     aa.memory_read.socket(aa_bus.target_socket[0]);
@@ -90,12 +95,18 @@ MuracPlatform::MuracPlatform (sc_core::sc_module_name name)
     aa_bus.initiator_socket[0](aa_memory.sp1);
     aa_bus.setDecode(0, 0xFFF00000, 0xFFFFFFFF);
 
-    aa_bus.initiator_socket[1](shared_bus.target_socket[1]);
-    aa_bus.setDecode(1, 0x00000000, 0x000FFFFF);
+    aa_bus.initiator_socket[1](shared_bus.target_socket[2]);
+    aa_bus.setDecode(1, 0x00000000, 0x00FFFFFF);
+
+    aa_bus.initiator_socket[2](shared_bus.target_socket[3]);
+    aa_bus.setDecode(2, 0xCF000000, 0xCFFFFFFF);
 
     // Share memory bridge
     shared_bus.initiator_socket[0](shared_memory.sp1);
-    shared_bus.setDecode(0, 0x00000000, 0x000FFFFF);
+    shared_bus.setDecode(0, 0x00000000, 0x00FFFFFF);
+
+    shared_bus.initiator_socket[1](murac_memory.sp1);
+    shared_bus.setDecode(1, 0xCF000000, 0xCFFFFFFF);
 
     // Interrupts
     pa.brarch( aa.brarch );
@@ -125,7 +136,7 @@ int sc_main (int argc, char *argv[]) {
 
     MuracPlatform murac("murac");
     unsigned char *targetPtr = murac.shared_memory.getMemory()->get_mem_ptr();
-    murac.pa.loadNativeMemory(targetPtr, 0x100000, 0x00000000, "mem_shared", exe, 0, 1, 1);
+    murac.pa.loadNativeMemory(targetPtr, 0x1000000, 0x00000000, "mem_shared", exe, 0, 1, 1);
 
     // Specify the debug processor.
     murac.pa.debugThisProcessor();
@@ -0,0 +1,430 @@
+/**
+ * MURAC PA static decoder generator
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ * Generates the static instruction decoders of the PA model from the decode
+ * entry lists in processor/pa/armDecodeList*.h, so the model does not build
+ * its vmid decode tables at startup. Each decoder is a tree of nodes that
+ * switch on instruction fields, ending in short pattern lists that are tried
+ * in decreasing priority (processor/pa/armDecodeStatic.h).
+ *
+ * Every generated decoder is checked against a linear search of its entry
+ * list before it is written: exhaustively for 16-bit decoders, and for
+ * 32-bit decoders on every pattern with random don't-care bits plus random
+ * instructions.
+ *
+ * Usage: armDecodeGen arm|thumb > <header>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "armDecodeEntriesARM.h"
+#include "armDecodeEntriesThumb16.h"
+#include "armDecodeEntriesThumb32.h"
+
+//
+// Only priority, name and pattern are needed here, types are emitted by name
+//
+typedef struct decodeEntryS {
+    unsigned    priority;
+    const char *name;
+    const char *pattern;
+} decodeEntry;
+
+#undef DECODE_NORMAL
+#undef DECODE_TT16
+#undef DECODE_TT32
+#undef DECODE_LAST
+
+#define DECODE_NORMAL(_PRIORITY, _NAME, _PATTERN) \
+    {priority:_PRIORITY, name:#_NAME, pattern:_PATTERN}
+#define DECODE_TT16(_PRIORITY, _NAME, _PATTERN) \
+    {priority:_PRIORITY, name:#_NAME, pattern:_PATTERN}
+#define DECODE_TT32(_PRIORITY, _NAME, _PATTERN) \
+    {priority:_PRIORITY, name:#_NAME, pattern:_PATTERN}
+#define DECODE_LAST(_PRIORITY, _PATTERN) \
+    {priority:_PRIORITY, name:0, pattern:_PATTERN}
+
+#include "armDecodeListARM.h"
+#include "armDecodeListThumb16.h"
+#include "armDecodeListThumbEE16.h"
+#include "armDecodeListThumb32.h"
+
+//
+// Leaves hold at most this many patterns unless no field separates them
+//
+#define LEAF_PATTERNS 4
+
+//
+// Widest field an inner node switches on
+//
+#define MAX_FIELD_BITS 8
+
+//
+// Random instructions checked for each 32-bit decoder
+//
+#define RANDOM_CHECKS 4000000
+
+typedef struct decoderS {
+    const char        *set;         // command line selector
+    const char        *name;        // decoder name suffix
+    const decodeEntry *entries;     // entry list
+    unsigned           bits;        // instruction width
+    const char        *prefix;      // instruction type prefix
+    const char        *last;        // type for undecoded instructions
+} decoder;
+
+static const decoder decoders[] = {
+    { "arm",   "ARM",       decodeEntriesARM,       32, "ARM_IT_", "ARM_IT_LAST" },
+    { "thumb", "Thumb16",   decodeEntriesThumb16,   16, "TT16_",   "TT_LAST"     },
+    { "thumb", "ThumbEE16", decodeEntriesThumbEE16, 16, "TT16_",   "TT_LAST"     },
+    { "thumb", "Thumb32",   decodeEntriesThumb32,   32, "TT32_",   "TT_LAST"     },
+    { 0 }
+};
+
+//
+// A parsed entry
+//
+typedef struct patternS {
+    unsigned mask;
+    unsigned value;
+    unsigned priority;
+    unsigned type;          // index of the entry, -1 for undecoded
+} pattern;
+
+typedef struct nodeS {
+    unsigned shift;
+    unsigned bits;
+    unsigned count;
+    unsigned first;
+} node;
+
+static pattern  *patterns;      // parsed entries in decode order
+static unsigned  numPatterns;
+
+static node     *nodes;         // generated tree
+static unsigned  numNodes;
+static unsigned  maxNodes;
+
+static unsigned *leaves;        // leaf pattern lists (indices into patterns)
+static unsigned  numLeaves;
+static unsigned  maxLeaves;
+
+static void fail(const char *msg, const char *arg) {
+    fprintf(stderr, "armDecodeGen: %s%s\n", msg, arg ? arg : "");
+    exit(1);
+}
+
+//
+// Parse a "01.|" pattern of the passed width
+//
+static void parsePattern(const decodeEntry *e, unsigned bits, pattern *p) {
+
+    const char *c;
+    unsigned    n = 0;
+
+    p->mask     = 0;
+    p->value    = 0;
+    p->priority = e->priority;
+
+    for(c=e->pattern; *c; c++) {
+        if(*c=='|') {
+            continue;
+        } else if((*c!='0') && (*c!='1') && (*c!='.')) {
+            fail("bad character in pattern ", e->pattern);
+        }
+        p->mask  <<= 1;
+        p->value <<= 1;
+        if(*c!='.') {
+            p->mask  |= 1;
+            p->value |= *c=='1';
+        }
+        n++;
+    }
+
+    if(n!=bits) {
+        fail("pattern has the wrong width: ", e->pattern);
+    }
+}
+
+//
+// Order by decreasing priority, then by entry order
+//
+static int comparePatterns(const void *a, const void *b) {
+
+    const pattern *pa = a;
+    const pattern *pb = b;
+
+    if(pa->priority!=pb->priority) {
+        return pa->priority>pb->priority ? -1 : 1;
+    }
+    return pa->type<pb->type ? -1 : pa->type>pb->type;
+}
+
+static unsigned newNodes(unsigned count) {
+
+    unsigned first = numNodes;
+
+    if(numNodes+count>maxNodes) {
+        maxNodes = (numNodes+count)*2;
+        nodes    = realloc(nodes, maxNodes*sizeof(node));
+    }
+    memset(&nodes[first], 0, count*sizeof(node));
+    numNodes += count;
+
+    return first;
+}
+
+static void addLeafPattern(unsigned index) {
+
+    if(numLeaves==maxLeaves) {
+        maxLeaves = maxLeaves ? maxLeaves*2 : 1024;
+        leaves    = realloc(leaves, maxLeaves*sizeof(unsigned));
+    }
+    leaves[numLeaves++] = index;
+}
+
+//
+// Fill node n to decode instructions with knownValue in the knownMask bits,
+// from the candidate patterns (in decode order)
+//
+static void buildNode(
+    unsigned  n,
+    unsigned  bits,
+    unsigned *cand,
+    unsigned  count,
+    unsigned  knownMask,
+    unsigned  knownValue
+) {
+    unsigned *live = malloc((count ? count : 1)*sizeof(unsigned));
+    unsigned  numLive = 0;
+    unsigned  fixed[32] = {0};
+    unsigned  i, b;
+
+    // keep compatible candidates, up to the first that always matches
+    for(i=0; i<count; i++) {
+        pattern *p = &patterns[cand[i]];
+        if(!(p->mask & knownMask & (p->value^knownValue))) {
+            live[numLive++] = cand[i];
+            if(!(p->mask & ~knownMask)) {
+                break;
+            }
+        }
+    }
+
+    // count the candidates fixing each unknown bit
+    unsigned best = 0;
+    for(b=0; b<bits; b++) {
+        if(!(knownMask & (1u<<b))) {
+            for(i=0; i<numLive; i++) {
+                fixed[b] += (patterns[live[i]].mask>>b) & 1;
+            }
+            if(fixed[b]>fixed[best] || (knownMask & (1u<<best))) {
+                best = b;
+            }
+        }
+    }
+
+    if((numLive<=LEAF_PATTERNS) || (knownMask & (1u<<best)) || !fixed[best]) {
+
+        // leaf
+        nodes[n].first = numLeaves;
+        nodes[n].count = numLive;
+        for(i=0; i<numLive; i++) {
+            addLeafPattern(live[i]);
+        }
+
+    } else {
+
+        // widest run of bits fixed by every candidate, else the best bit
+        unsigned shift = best, width = 1;
+        unsigned runShift, runWidth;
+        for(b=0; b<bits; b=runShift+runWidth+1) {
+            for(runShift=b; (runShift<bits) && (fixed[runShift]!=numLive); runShift++) {}
+            for(runWidth=0; (runShift+runWidth<bits) && (fixed[runShift+runWidth]==numLive); runWidth++) {}
+            if(runWidth>MAX_FIELD_BITS) {
+                runShift += runWidth-MAX_FIELD_BITS;
+                runWidth  = MAX_FIELD_BITS;
+            }
+            if(runWidth>width || ((runWidth==width) && (fixed[shift]!=numLive))) {
+                shift = runShift;
+                width = runWidth;
+            }
+        }
+
+        unsigned fieldMask = ((1u<<width)-1) << shift;
+        unsigned first     = newNodes(1u<<width);
+
+        nodes[n].shift = shift;
+        nodes[n].bits  = width;
+        nodes[n].first = first;
+
+        for(i=0; i<(1u<<width); i++) {
+            buildNode(first+i, bits, live, numLive, knownMask|fieldMask, knownValue|(i<<shift));
+        }
+    }
+
+    free(live);
+}
+
+//
+// Reference decode: the first matching pattern in decode order
+//
+static unsigned decodeLinear(unsigned instr) {
+
+    unsigned i;
+
+    for(i=0; i<numPatterns; i++) {
+        if((instr&patterns[i].mask)==patterns[i].value) {
+            return patterns[i].type;
+        }
+    }
+    return -1;
+}
+
+static unsigned decodeTree(unsigned instr) {
+
+    const node *nd = nodes;
+    unsigned    i;
+
+    while(nd->bits) {
+        nd = &nodes[nd->first + ((instr>>nd->shift) & ((1u<<nd->bits)-1))];
+    }
+    for(i=0; i<nd->count; i++) {
+        const pattern *p = &patterns[leaves[nd->first+i]];
+        if((instr&p->mask)==p->value) {
+            return p->type;
+        }
+    }
+    return -1;
+}
+
+static unsigned randomState = 1;
+
+static unsigned nextRandom(void) {
+
+    unsigned high;
+
+    randomState = randomState*1103515245 + 12345;
+    high        = randomState>>16;
+    randomState = randomState*1103515245 + 12345;
+
+    return (high<<16) | (randomState>>16);
+}
+
+static void checkInstr(const decoder *d, unsigned instr) {
+    if(decodeTree(instr)!=decodeLinear(instr)) {
+        fprintf(stderr, "armDecodeGen: %s decoder differs on 0x%08x\n", d->name, instr);
+        exit(1);
+    }
+}
+
+//
+// Check the tree against the linear search
+//
+static void checkDecoder(const decoder *d) {
+
+    unsigned i, j;
+
+    if(d->bits==16) {
+        for(i=0; i<0x10000; i++) {
+            checkInstr(d, i);
+        }
+    } else {
+        for(i=0; i<numPatterns; i++) {
+            for(j=0; j<64; j++) {
+                checkInstr(d, (nextRandom() & ~patterns[i].mask) | patterns[i].value);
+            }
+        }
+        for(i=0; i<RANDOM_CHECKS; i++) {
+            checkInstr(d, nextRandom());
+        }
+    }
+}
+
+static void emitType(const decoder *d, unsigned type) {
+    if(type==-1u || !d->entries[type].name) {
+        printf("%s", d->last);
+    } else {
+        printf("%s%s", d->prefix, d->entries[type].name);
+    }
+}
+
+static void generate(const decoder *d) {
+
+    unsigned *cand;
+    unsigned  i;
+
+    // parse entries and sort them into decode order
+    for(numPatterns=0; d->entries[numPatterns].pattern; numPatterns++) {}
+    patterns = malloc(numPatterns*sizeof(pattern));
+    cand     = malloc(numPatterns*sizeof(unsigned));
+    for(i=0; i<numPatterns; i++) {
+        parsePattern(&d->entries[i], d->bits, &patterns[i]);
+        patterns[i].type = i;
+    }
+    qsort(patterns, numPatterns, sizeof(pattern), comparePatterns);
+    for(i=0; i<numPatterns; i++) {
+        cand[i] = i;
+    }
+
+    // build and check the tree
+    numNodes  = 0;
+    numLeaves = 0;
+    buildNode(newNodes(1), d->bits, cand, numPatterns, 0, 0);
+    checkDecoder(d);
+
+    fprintf(stderr, "armDecodeGen: %s: %u entries, %u nodes, %u leaf patterns\n",
+        d->name, numPatterns, numNodes, numLeaves);
+
+    printf("\n//\n// %s static decoder (%u entries)\n//\n", d->name, numPatterns);
+    printf("static const armDecodeNode decodeNodes%s[%u] = {\n", d->name, numNodes);
+    for(i=0; i<numNodes; i++) {
+        printf("    {%2u, %u, %2u, %6u},\n",
+            nodes[i].shift, nodes[i].bits, nodes[i].count, nodes[i].first);
+    }
+    printf("};\n\n");
+
+    printf("static const armDecodePattern decodePatterns%s[%u] = {\n", d->name, numLeaves ? numLeaves : 1);
+    for(i=0; i<numLeaves; i++) {
+        const pattern *p = &patterns[leaves[i]];
+        printf("    {0x%08x, 0x%08x, ", p->mask, p->value);
+        emitType(d, p->type);
+        printf("},\n");
+    }
+    if(!numLeaves) {
+        printf("    {0}\n");
+    }
+    printf("};\n");
+
+    free(patterns);
+    free(cand);
+}
+
+int main(int argc, char *argv[]) {
+
+    const decoder *d;
+    int            found = 0;
+
+    if(argc!=2) {
+        fprintf(stderr, "Usage: %s arm|thumb\n", argv[0]);
+        return 1;
+    }
+
+    printf("//\n// Generated by armDecodeGen %s, do not edit\n//\n", argv[1]);
+
+    for(d=decoders; d->set; d++) {
+        if(!strcmp(d->set, argv[1])) {
+            generate(d);
+            found = 1;
+        }
+    }
+
+    if(!found) {
+        fail("unknown instruction set ", argv[1]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,225 @@
+/**
+ * MURAC PA floating point table generator
+ * Author: Brandon Hamilton <brandon.hamilton@gmail.com>
+ *
+ * Generates the lookup tables used by the PA model for the VRECPE and
+ * VRSQRTE estimates and for half to single precision conversion, from the
+ * recip_estimate and recip_sqrt_estimate pseudo code of the ARM Architecture
+ * Reference Manual. processor/pa/armFPLookup.h defines how the model indexes
+ * the tables.
+ *
+ * Before the tables are written, the estimate lookups are checked against
+ * the per-element implementations the model used before the tables
+ * (processor/pa/armFPReference.h): for every single-precision fraction with
+ * odd and even exponents at both ends of the range, and for every setting of
+ * the top 24 bits of an unsigned operand (the lower bits are ignored by the
+ * estimates, and are set randomly). The half to single precision table is
+ * checked for every half-precision value against a conversion by ldexp, so
+ * it does not depend on the code it was built with.
+ *
+ * Usage: armFPTableGen > <header>
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hostapi/impTypes.h"
+
+#include "armFPLookup.h"
+#include "armFPReference.h"
+
+static Uns8  recipTable[ARM_ESTIMATE_TABLE_SIZE];
+static Uns8  rsqrtTable[ARM_ESTIMATE_TABLE_SIZE];
+static Uns32 halfTable[ARM_HALF_TABLE_SIZE];
+
+static void fail(const char *msg, Uns32 value) {
+    fprintf(stderr, "armFPTableGen: %s 0x%08x\n", msg, value);
+    exit(1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// TABLES
+////////////////////////////////////////////////////////////////////////////////
+
+//
+// Fraction bits of an estimate in [1.0, 2.0)
+//
+static Uns8 estimateFraction(Flt64 estimate) {
+
+    Int32 s = (Int32)(estimate * 256.0);
+
+    if((s < 256) || (s > 511) || ((Flt64)s != estimate * 256.0)) {
+        fail("estimate out of range at index", s);
+    }
+
+    return (Uns8)(s - 256);
+}
+
+static void buildTables(void) {
+
+    Uns32 i;
+
+    // entry i covers operands in [(256+i)/512, (257+i)/512)
+    for(i=0; i<ARM_ESTIMATE_TABLE_SIZE; i++) {
+        recipTable[i] = estimateFraction(armRefRecipEstimate((256 + i + 0.5) / 512.0));
+    }
+
+    // entries below 0x80 cover [0.25, 0.5) in steps of 1/512, the others
+    // cover [0.5, 1.0) in steps of 1/256
+    for(i=0; i<ARM_ESTIMATE_TABLE_SIZE; i++) {
+        Flt64 a = (i & 0x80) ? (128 + (i & 0x7f) + 0.5) / 256.0 : (128 + i + 0.5) / 512.0;
+        rsqrtTable[i] = estimateFraction(armRefRecipSqrtEstimate(a));
+    }
+
+    for(i=0; i<ARM_HALF_TABLE_SIZE; i++) {
+        halfTable[i] = armRefFPHalfToSingle(i);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// CHECKS
+////////////////////////////////////////////////////////////////////////////////
+
+static Uns32 lcgState = 1;
+
+static Uns32 randomBits(void) {
+    lcgState = lcgState * 1103515245 + 12345;
+    return lcgState >> 8;
+}
+
+//
+// Single-precision value of a half-precision value without sign, decoded from
+// its fields with exponent 0x1f taken as a normal exponent
+//
+static Uns32 decodeHalf(Uns32 half) {
+
+    Int32 exponent = ARM_FP16_EXPONENT(half);
+    Uns32 fraction = ARM_FP16_FRACTION(half);
+    union {Uns32 u; Flt32 f;} single;
+
+    if(exponent) {
+        single.f = ldexp(fraction | (1<<ARM_FP16_EXP_SHIFT), exponent-ARM_FP16_EXP_BIAS-ARM_FP16_EXP_SHIFT);
+    } else {
+        single.f = ldexp(fraction, 1-ARM_FP16_EXP_BIAS-ARM_FP16_EXP_SHIFT);
+    }
+
+    return single.u;
+}
+
+//
+// Single-precision estimates composed from the tables as armSIMDVFP.c does
+//
+static Uns32 lookupRecipFP32(Uns32 op) {
+
+    Uns32 result = (253 - ARM_FP32_EXPONENT(op)) << 23;
+
+    result |= ARM_ESTIMATE_FP32_FRACTION(recipTable[ARM_RECIP_INDEX_FP32(op)]);
+
+    return ARM_FP32_SIGN(op) ? (result | (1 << 31)) : result;
+}
+
+static Uns32 lookupRSqrtFP32(Uns32 op) {
+
+    Uns32 result = ((380 - ARM_FP32_EXPONENT(op)) / 2) << 23;
+
+    return result | ARM_ESTIMATE_FP32_FRACTION(rsqrtTable[ARM_RSQRT_INDEX_FP32(op)]);
+}
+
+static void checkTables(void) {
+
+    // exponents at both ends of the range of each estimate, odd and even
+    static const Uns32 recipExponents[] = {1, 2, 126, 127, 251, 252};
+    static const Uns32 rsqrtExponents[] = {1, 2, 126, 127, 253, 254};
+
+    Uns32 i, e;
+
+    for(i=0; i<ARM_HALF_TABLE_SIZE; i++) {
+        if(halfTable[ARM_HALF_INDEX(i)] != decodeHalf(i)) {
+            fail("half to single precision differs on", i);
+        }
+    }
+
+    // normal single-precision operands, of either sign for the reciprocal
+    for(i=0; i<(1<<ARM_FP32_EXP_SHIFT); i++) {
+
+        for(e=0; e<sizeof(recipExponents)/sizeof(recipExponents[0]); e++) {
+
+            Uns32 op = (recipExponents[e] << ARM_FP32_EXP_SHIFT) | i;
+
+            if(lookupRecipFP32(op) != armRefFPRecipEstimate(op)) {
+                fail("single-precision reciprocal estimate differs on", op);
+            }
+            if(lookupRecipFP32(op | 0x80000000) != armRefFPRecipEstimate(op | 0x80000000)) {
+                fail("single-precision reciprocal estimate differs on", op | 0x80000000);
+            }
+        }
+
+        for(e=0; e<sizeof(rsqrtExponents)/sizeof(rsqrtExponents[0]); e++) {
+
+            Uns32 op = (rsqrtExponents[e] << ARM_FP32_EXP_SHIFT) | i;
+
+            if(lookupRSqrtFP32(op) != armRefFPRSqrtEstimate(op)) {
+                fail("single-precision reciprocal square root estimate differs on", op);
+            }
+        }
+    }
+
+    // unsigned operands in range of each estimate
+    for(i=0; i<(1<<24); i++) {
+
+        Uns32 op = (i << 8) | (randomBits() & 0xff);
+
+        if((op & 0x80000000) && (ARM_ESTIMATE_U32(recipTable[ARM_RECIP_INDEX_U32(op)]) != armRefFPUnsignedRecipEstimate(op))) {
+            fail("unsigned reciprocal estimate differs on", op);
+        }
+        if((op & 0xc0000000) && (ARM_ESTIMATE_U32(rsqrtTable[ARM_RSQRT_INDEX_U32(op)]) != armRefFPUnsignedRsqrtEstimate(op))) {
+            fail("unsigned reciprocal square root estimate differs on", op);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// OUTPUT
+////////////////////////////////////////////////////////////////////////////////
+
+static void writeEstimateTable(const char *name, const Uns8 *table) {
+
+    Uns32 i;
+
+    printf("\nstatic const Uns8 %s[ARM_ESTIMATE_TABLE_SIZE] = {", name);
+    for(i=0; i<ARM_ESTIMATE_TABLE_SIZE; i++) {
+        printf("%s0x%02x,", (i%16) ? " " : "\n    ", table[i]);
+    }
+    printf("\n};\n");
+}
+
+static void writeHalfTable(void) {
+
+    Uns32 i;
+
+    printf("\nstatic const Uns32 armHalfToSingleTable[ARM_HALF_TABLE_SIZE] = {");
+    for(i=0; i<ARM_HALF_TABLE_SIZE; i++) {
+        printf("%s0x%08x,", (i%8) ? " " : "\n    ", halfTable[i]);
+    }
+    printf("\n};\n");
+}
+
+int main(int argc, char *argv[]) {
+
+    if(argc!=1) {
+        fprintf(stderr, "Usage: %s\n", argv[0]);
+        return 1;
+    }
+
+    buildTables();
+    checkTables();
+
+    printf("//\n// Generated by armFPTableGen, do not edit\n//\n");
+
+    writeEstimateTable("armRecipEstimateTable", recipTable);
+    writeEstimateTable("armRSqrtEstimateTable", rsqrtTable);
+    writeHalfTable();
+
+    return 0;
+}
@@ -597,6 +597,11 @@ static ARM_CP_WRITEFN(writeCp15SCTLR) {
     if(CP_FIELD_CHANGED(arm, SCTLR, SW)) {
         writeCp15SW(arm);
     }
+
+    // cached level 1 descriptors were read with the old table endianness
+    if(CP_FIELD_CHANGED(arm, SCTLR, EE)) {
+        armVMInvalidateWalkCache(arm);
+    }
 }
 
 //
@@ -1208,6 +1213,23 @@ static ARM_CP_READFN(readCp15DMAContextID) {
     }
 }
 
+//
+// Write TTBCR register value
+//
+static ARM_CP_WRITEFN(writeCp15TTBCR) {
+
+    // get old and new values, allowing for writable bits
+    GET_MASKED_VALUES(TTBCR);
+
+    // a new TTBR0/TTBR1 split changes which table each MVA is walked in;
+    // TTBR writes need no action as walk cache entries are found by
+    // descriptor address
+    if(oldValue!=newValue) {
+        CP_REG_UNS32(arm, TTBCR) = newValue;
+        armVMInvalidateWalkCache(arm);
+    }
+}
+
 //
 // Write CONTEXTIDR register value
 //
@@ -1397,7 +1419,7 @@ const static cpRegAttrs cpRegInfo[CP_ID(Size)] = {
     CP_ATTR1(15, CPACR,                    0,  2,  1,  0,  1,1,0,0, AU_ALL,   6,      0,        RP_HI,  1,   0,   0,                       writeCp15CPACR           ),
     CP_ATTR1(15, TTBR0,                    0,  0,  2,  0,  1,1,0,0, AU_MMU,   6,      0,        RP_HI,  0,   0,   0,                       0                        ),
     CP_ATTR1(15, TTBR1,                    0,  1,  2,  0,  1,1,0,0, AU_MMU,   6,      0,        RP_HI,  0,   0,   0,                       0                        ),
-    CP_ATTR1(15, TTBCR,                    0,  2,  2,  0,  1,1,0,0, AU_MMU,   6,      0,        RP_HI,  0,   0,   0,                       0                        ),
+    CP_ATTR1(15, TTBCR,                    0,  2,  2,  0,  1,1,0,0, AU_MMU,   6,      0,        RP_HI,  0,   0,   0,                       writeCp15TTBCR           ),
     CP_ATTR1(15, DACR,                     0,  0,  3,  0,  1,1,0,0, AU_MMU,   0,      0,        RP_HI,  0,   0,   0,                       writeCp15DACR            ),
     CP_ATTR1(15, DFSR,                     0,  0,  5,  0,  1,1,0,0, AU_ALL,   6,      0,        RP_HI,  0,   0,   0,                       0                        ),
     CP_ATTR1(15, IFSR,                     0,  1,  5,  0,  1,1,0,0, AU_ALL,   6,      0,        RP_HI,  0,   0,   0,                       0                        ),
@@ -32,15 +32,25 @@
  *
  */
 
+// Imperas header files
+#include "hostapi/impAlloc.h"
+
 // VMI header files
 #include "vmi/vmiCxt.h"
+#include "vmi/vmiMessage.h"
 
 // model header files
+#include "armCPRegisters.h"
 #include "armDecodeARM.h"
 #include "armDecodeThumb.h"
 #include "armDecodeTypes.h"
 #include "armStructure.h"
 
+//
+// Prefix for messages from this module
+//
+#define CPU_PREFIX "ARM_DECODE"
+
 //
 // Null decoder for trivial Jazelle extension
 //
@@ -60,24 +70,200 @@ static void decodeJazelle(armP arm, Uns32 thisPC, armInstructionInfoP info) {
     *info = jazelleInfo;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// DECODED INSTRUCTION CACHE
+////////////////////////////////////////////////////////////////////////////////
+
 //
-// Decode the instruction at the passed address. The 'info' structure is filled
-// with details of the instruction.
+// Number of entries in the decoded instruction cache (a power of 2)
 //
-ARM_DECODER_FN(armDecode) {
+#define DECODE_CACHE_ENTRIES 4096
+
+//
+// Decoder state that affects the decoded instruction, besides its address and
+// encoding
+//
+#define DECODE_STATE_VALID  0x0001
+#define DECODE_STATE_THUMB  0x0002
+#define DECODE_STATE_EE     0x0004
+#define DECODE_STATE_U      0x0008
+#define DECODE_STATE_IT_SHIFT 8
+
+//
+// Decoded instruction cache entry
+//
+typedef struct decodeCacheEntryS {
+    Uns32              state;       // decoder state (0 if invalid)
+    armInstructionInfo info;        // decoded instruction
+} decodeCacheEntry, *decodeCacheEntryP;
+
+//
+// Decoded instruction cache, direct mapped by instruction address. Entries are
+// validated by encoding when they are used, so they stay correct when code
+// is modified or remapped and need no invalidation.
+//
+typedef struct armDecodeCacheS {
+    decodeCacheEntry entries[DECODE_CACHE_ENTRIES];
+    Uns64            hits;          // decodes satisfied from the cache
+    Uns64            misses;        // decodes that needed a full decode
+} armDecodeCache;
+
+//
+// Return the decoder state for the current mode
+//
+static Uns32 getDecodeState(armP arm) {
+
+    Uns32 state = DECODE_STATE_VALID;
+
+    if(IN_THUMB_MODE(arm)) {
+        state |= DECODE_STATE_THUMB;
+        state |= arm->itStateMT << DECODE_STATE_IT_SHIFT;
+    }
+    if(IN_THUMB_EE_MODE(arm)) {
+        state |= DECODE_STATE_EE;
+    }
+    if(CP_FIELD(arm, SCTLR, U)) {
+        state |= DECODE_STATE_U;
+    }
+
+    return state;
+}
+
+//
+// Return the cache entry for the passed address and decoder state. ARM
+// instructions are word aligned, so they are indexed by word to use every
+// entry.
+//
+static decodeCacheEntryP getDecodeCacheEntry(
+    armP  arm,
+    Uns32 thisPC,
+    Uns32 state
+) {
+    Uns32 index = (state & DECODE_STATE_THUMB) ? thisPC>>1 : thisPC>>2;
+
+    if(!arm->decodeCache) {
+        arm->decodeCache = STYPE_CALLOC(armDecodeCache);
+    }
+
+    return &arm->decodeCache->entries[index & (DECODE_CACHE_ENTRIES-1)];
+}
+
+//
+// Does the cached instruction still match the encoding at its address?
+//
+static Bool matchEncoding(armP arm, armInstructionInfoP info, Uns32 state) {
+
+    vmiProcessorP processor = (vmiProcessorP)arm;
+    Uns32         thisPC    = info->thisPC;
 
-    // record current PC in decoded structure
-    info->thisPC = thisPC;
+    if(!(state & DECODE_STATE_THUMB)) {
+        return vmicxtFetch4Byte(processor, thisPC) == info->instruction;
+    } else if(info->bytes==2) {
+        return vmicxtFetch2Byte(processor, thisPC) == info->instruction;
+    } else {
+        Uns32 instr = vmicxtFetch2Byte(processor, thisPC);
+        return (
+            ((instr<<16) | vmicxtFetch2Byte(processor, thisPC+2)) ==
+            info->instruction
+        );
+    }
+}
+
+//
+// Free the decoded instruction cache, reporting its hit rate in verbose mode
+//
+void armDecodeCacheFree(armP arm) {
+
+    armDecodeCacheP dc = arm->decodeCache;
+
+    if(dc) {
+
+        Uns64 decodes = dc->hits + dc->misses;
+
+        if(arm->verbose && decodes) {
+            vmiMessage("I", CPU_PREFIX"_DCS",
+                "decoded instruction cache: "FMT_64u" hits, "FMT_64u" misses "
+                "(%.1f%% hit rate)",
+                dc->hits, dc->misses, 100.0*dc->hits/decodes
+            );
+        }
 
+        STYPE_FREE(dc);
+        arm->decodeCache = 0;
+    }
+}
+
+//
+// Decode the instruction at the passed address using the decoded instruction
+// cache, counting the lookup in the cache statistics if 'count' is set
+//
+static void decodeCached(
+    armP                arm,
+    Uns32               thisPC,
+    armInstructionInfoP info,
+    Bool                count
+) {
     if(IN_JAZELLE_MODE(arm)) {
+
+        // record current PC in decoded structure
+        info->thisPC = thisPC;
+
         decodeJazelle(arm, thisPC, info);
-    } else if(IN_THUMB_MODE(arm)) {
-        armDecodeThumb(arm, thisPC, info, IN_THUMB_EE_MODE(arm));
+
     } else {
-        armDecodeARM(arm, thisPC, info);
+
+        Uns32             state = getDecodeState(arm);
+        decodeCacheEntryP entry = getDecodeCacheEntry(arm, thisPC, state);
+
+        if(
+            (entry->state==state)         &&
+            (entry->info.thisPC==thisPC)  &&
+            matchEncoding(arm, &entry->info, state)
+        ) {
+
+            // previously decoded at this address in this state
+            if(count) {
+                arm->decodeCache->hits++;
+            }
+
+        } else {
+
+            // record current PC in decoded structure
+            entry->info.thisPC = thisPC;
+
+            if(state & DECODE_STATE_THUMB) {
+                armDecodeThumb(arm, thisPC, &entry->info, state & DECODE_STATE_EE);
+            } else {
+                armDecodeARM(arm, thisPC, &entry->info);
+            }
+
+            entry->state = state;
+
+            if(count) {
+                arm->decodeCache->misses++;
+            }
+        }
+
+        *info = entry->info;
     }
 }
 
+//
+// Decode the instruction at the passed address. The 'info' structure is filled
+// with details of the instruction.
+//
+ARM_DECODER_FN(armDecode) {
+    decodeCached(arm, thisPC, info, False);
+}
+
+//
+// Decode the instruction at the passed address for the morpher, counting the
+// lookup in the decoded instruction cache statistics
+//
+ARM_DECODER_FN(armDecodeMorph) {
+    decodeCached(arm, thisPC, info, True);
+}
+
 //
 // Return the size of the instruction at the passed address and the mode
 //
@@ -48,6 +48,17 @@
 //
 void armDecode(armP arm, Uns32 thisPC, armInstructionInfoP info);
 
+//
+// Decode the instruction at the passed address for the morpher, counting the
+// lookup in the decoded instruction cache statistics
+//
+void armDecodeMorph(armP arm, Uns32 thisPC, armInstructionInfoP info);
+
+//
+// Free the decoded instruction cache, reporting its hit rate in verbose mode
+//
+void armDecodeCacheFree(armP arm);
+
 //
 // Return the size of the instruction at the passed address and the mode
 //
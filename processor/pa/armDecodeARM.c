@@ -939,576 +939,26 @@ typedef struct decodeEntryS {
     const char        *pattern;
 } decodeEntry;
 
+// decode entry list, shared with the build-time decoder generator
+#include "armDecodeListARM.h"
+
+// static decoder generated from the entry list
+#ifdef ARM_STATIC_DECODE
+#include "armDecodeStatic.h"
+#include "armDecodeTablesARM.h"
+#endif
+
 //
 // Create the ARM instruction decode table
 //
 static vmidDecodeTableP createDecodeTableARM(void) {
 
-    const static decodeEntry entries[] = {
-
-        ////////////////////////////////////////////////////////////////////////
-        // NORMAL INSTRUCTIONS
-        ////////////////////////////////////////////////////////////////////////
-
-        // data processing instructions
-        DECODE_SET_ADC (ADC, "0101"),
-        DECODE_SET_ADC (ADD, "0100"),
-        DECODE_SET_ADC (AND, "0000"),
-        DECODE_SET_ADC (BIC, "1110"),
-        DECODE_SET_ADC (EOR, "0001"),
-        DECODE_SET_MOV (MOV, "1101"),
-        DECODE_SET_MOV (MVN, "1111"),
-        DECODE_SET_ADC (ORR, "1100"),
-        DECODE_SET_ADC (RSB, "0011"),
-        DECODE_SET_ADC (RSC, "0111"),
-        DECODE_SET_ADC (SBC, "0110"),
-        DECODE_SET_ADC (SUB, "0010"),
-
-        // ARMv6T2 move instructions
-        DECODE_SET_MOVT (MOVT, "1010"),
-        DECODE_SET_MOVT (MOVW, "1000"),
-
-        // multiply instructions
-        DECODE_SET_MLA (MLA,   "0000001."),
-        DECODE_SET_MLA (MLS,   "00000110"),
-        DECODE_SET_MLA (MUL,   "0000000."),
-        DECODE_SET_MLA (SMLAL, "0000111."),
-        DECODE_SET_MLA (SMULL, "0000110."),
-        DECODE_SET_MLA (UMAAL, "00000100"),
-        DECODE_SET_MLA (UMLAL, "0000101."),
-        DECODE_SET_MLA (UMULL, "0000100."),
-
-        // compare instructions
-        DECODE_SET_CMN (CMN, "1011"),
-        DECODE_SET_CMN (CMP, "1010"),
-        DECODE_SET_CMN (TEQ, "1001"),
-        DECODE_SET_CMN (TST, "1000"),
-
-        // branch instructions
-        DECODE_SET_B    (B,    "0"),
-        DECODE_SET_B    (BL,   "1"),
-        DECODE_SET_BLX1 (BLX1),
-        DECODE_SET_BLX2 (BLX2, "0011"),
-        DECODE_SET_BLX2 (BX,   "0001"),
-        DECODE_SET_BLX2 (BXJ,  "0010"),
-
-        // MURAC instructions
-        DECODE_SET_BLX2 (BAA,  "0100"),
-
-        // miscellaneous instructions
-        DECODE_SET_BKPT (BKPT),
-        DECODE_SET_CLZ  (CLZ),
-        DECODE_SET_SWI  (SWI),
-
-        // load and store instructions
-        DECODE_SET_LDR   (LDR,   "0", "1"),
-        DECODE_SET_LDR   (LDRB,  "1", "1"),
-        DECODE_SET_LDRBT (LDRBT, "1", "1"),
-        DECODE_SET_LDRH  (LDRH,  "1", ".", "01"),
-        DECODE_SET_LDRH  (LDRSB, "1", ".", "10"),
-        DECODE_SET_LDRH  (LDRSH, "1", ".", "11"),
-        DECODE_SET_LDRBT (LDRT,  "0", "1"),
-        DECODE_SET_LDR   (STR,   "0", "0"),
-        DECODE_SET_LDR   (STRB,  "1", "0"),
-        DECODE_SET_LDRBT (STRBT, "1", "0"),
-        DECODE_SET_LDRH  (STRH,  "0", ".", "01"),
-        DECODE_SET_LDRBT (STRT,  "0", "0"),
-
-        // load and store multiple instructions
-        DECODE_SET_LDM1  (LDM1, "1"),
-        DECODE_SET_LDM2  (LDM2),
-        DECODE_SET_LDM3  (LDM3),
-        DECODE_SET_LDM1  (STM1, "0"),
-        DECODE_SET_STM2  (STM2),
-
-        // ARMv6T2 load and store instructions
-        DECODE_SET_LDRHT (LDRHT,  "1", "01"),
-        DECODE_SET_LDRHT (LDRSBT, "1", "10"),
-        DECODE_SET_LDRHT (LDRSHT, "1", "11"),
-        DECODE_SET_LDRHT (STRHT,  "0", "01"),
-
-        // semaphore instructions
-        DECODE_SET_SWP (SWP,    "0000"),
-        DECODE_SET_SWP (SWPB,   "0100"),
-
-        // synchronization primitives
-        DECODE_SET_SWP (LDREX,  "1001"),
-        DECODE_SET_SWP (LDREXB, "1101"),
-        DECODE_SET_SWP (LDREXH, "1111"),
-        DECODE_SET_SWP (LDREXD, "1011"),
-        DECODE_SET_SWP (STREX,  "1000"),
-        DECODE_SET_SWP (STREXB, "1100"),
-        DECODE_SET_SWP (STREXH, "1110"),
-        DECODE_SET_SWP (STREXD, "1010"),
-
-        // coprocessor instructions
-        DECODE_SET_CDP  (CDP),
-        DECODE_SET_CDP2 (CDP2),
-        DECODE_SET_LDC  (LDC,  "1"),
-        DECODE_SET_LDC2 (LDC2, "1"),
-        DECODE_SET_MCR  (MCR,  "0"),
-        DECODE_SET_MCR2 (MCR2, "0"),
-        DECODE_SET_MCR  (MRC,  "1"),
-        DECODE_SET_MCR2 (MRC2, "1"),
-        DECODE_SET_LDC  (STC,  "0"),
-        DECODE_SET_LDC2 (STC2, "0"),
-
-        // status register access instructions
-        DECODE_SET_MRS (MRSC, "0"),
-        DECODE_SET_MRS (MRSS, "1"),
-        DECODE_SET_MSR (MSRC, "0"),
-        DECODE_SET_MSR (MSRS, "1"),
-
-        // hint instructions
-        DECODE_SET_NOP (NOP,   "00000000"),
-        DECODE_SET_NOP (YIELD, "00000001"),
-        DECODE_SET_NOP (WFE,   "00000010"),
-        DECODE_SET_NOP (WFI,   "00000011"),
-        DECODE_SET_NOP (SEV,   "00000100"),
-        DECODE_SET_NOP (DBG,   "1111...."),
-
-        // ARMv6 exception instructions
-        DECODE_SET_SRS  (SRS, "100..1.0"),
-        DECODE_SET_SRS  (RFE, "100..0.1"),
-
-        // ARMv6 miscellaneous instructions
-        DECODE_SET_MISC (SETEND, "0010000", "0000", "...1"),
-        DECODE_SET_MISC (CPS,    "0010000", "..0.", "...0"),
-        DECODE_SET_MISC (CLREX,  "1010111", "0001", "...."),
-
-        // ARMv6/ARMv7 memory hint instructions
-        DECODE_SET_PLD  (PLD,   "1.1"),
-        DECODE_SET_PLD  (PLI,   "0.1"),
-        DECODE_SET_PLD  (PLDW,  "1.0"),
-        DECODE_SET_MISC (DMB,   "1010111", "0101", "...."),
-        DECODE_SET_MISC (DSB,   "1010111", "0100", "...."),
-        DECODE_SET_MISC (ISB,   "1010111", "0110", "...."),
-        DECODE_SET_MISC (UHINT, "100.001", "....", "...."),
-
-        ////////////////////////////////////////////////////////////////////////
-        // DSP INSTRUCTIONS
-        ////////////////////////////////////////////////////////////////////////
-
-        // data processing instructions
-        DECODE_SET_QADD (QADD,  "00"),
-        DECODE_SET_QADD (QDADD, "10"),
-        DECODE_SET_QADD (QDSUB, "11"),
-        DECODE_SET_QADD (QSUB,  "01"),
-
-        // multiply instructions
-        DECODE_SET_SMLA_XY (SMLA,  "00"),
-        DECODE_SET_SMLA_XY (SMLAL, "10"),
-        DECODE_SET_SMLAW_Y (SMLAW, "0" ),
-        DECODE_SET_SMLA_XY (SMUL,  "11"),
-        DECODE_SET_SMLAW_Y (SMULW, "1" ),
-
-        // load and store instructions
-        DECODE_SET_LDRH (LDRD, "0", "0", "10"),
-        DECODE_SET_LDRH (STRD, "0", "0", "11"),
-
-        // coprocessor instructions
-        DECODE_SET_MCRR  (MCRR,  "0"),
-        DECODE_SET_MCRR2 (MCRR2, "0"),
-        DECODE_SET_MCRR  (MRRC,  "1"),
-        DECODE_SET_MCRR2 (MRRC2, "1"),
-
-        ////////////////////////////////////////////////////////////////////////
-        // MEDIA INSTRUCTIONS
-        ////////////////////////////////////////////////////////////////////////
-
-        // basic instructions
-        DECODE_SET_MEDIA (USAD8,  1, "11000", "000", "....", "1111", "...."),
-        DECODE_SET_MEDIA (USADA8, 0, "11000", "000", "....", "....", "...."),
-        DECODE_SET_MEDIA (SBFX,   0, "1101.", ".10", "....", "....", "...."),
-        DECODE_SET_MEDIA (BFC,    1, "1110.", ".00", "....", "....", "1111"),
-        DECODE_SET_MEDIA (BFI,    0, "1110.", ".00", "....", "....", "...."),
-        DECODE_SET_MEDIA (UBFX,   0, "1111.", ".10", "....", "....", "...."),
-
-        // parallel add/subtract instructions
-        DECODE_SET_PAS (ADD16, "000"),
-        DECODE_SET_PAS (ASX,   "001"),
-        DECODE_SET_PAS (SAX,   "010"),
-        DECODE_SET_PAS (SUB16, "011"),
-        DECODE_SET_PAS (ADD8,  "100"),
-        DECODE_SET_PAS (SUB8,  "111"),
-
-        // packing, unpacking, saturation and reversal instructions
-        DECODE_SET_MEDIA (PKHBT,   0, "01" "000", ".00", "....", "....", "...."),
-        DECODE_SET_MEDIA (PKHTB,   0, "01" "000", ".10", "....", "....", "...."),
-        DECODE_SET_MEDIA (SSAT,    0, "01" "01.", "..0", "....", "....", "...."),
-        DECODE_SET_MEDIA (SSAT16,  0, "01" "010", "001", "....", "....", "...."),
-        DECODE_SET_MEDIA (USAT,    0, "01" "11.", "..0", "....", "....", "...."),
-        DECODE_SET_MEDIA (USAT16,  0, "01" "110", "001", "....", "....", "...."),
-        DECODE_SET_MEDIA (SXTAB,   0, "01" "010", "011", "....", "....", "...."),
-        DECODE_SET_MEDIA (UXTAB,   0, "01" "110", "011", "....", "....", "...."),
-        DECODE_SET_MEDIA (SXTAB16, 0, "01" "000", "011", "....", "....", "...."),
-        DECODE_SET_MEDIA (UXTAB16, 0, "01" "100", "011", "....", "....", "...."),
-        DECODE_SET_MEDIA (SXTAH,   0, "01" "011", "011", "....", "....", "...."),
-        DECODE_SET_MEDIA (UXTAH,   0, "01" "111", "011", "....", "....", "...."),
-        DECODE_SET_MEDIA (SXTB,    1, "01" "010", "011", "1111", "....", "...."),
-        DECODE_SET_MEDIA (UXTB,    1, "01" "110", "011", "1111", "....", "...."),
-        DECODE_SET_MEDIA (SXTB16,  1, "01" "000", "011", "1111", "....", "...."),
-        DECODE_SET_MEDIA (UXTB16,  1, "01" "100", "011", "1111", "....", "...."),
-        DECODE_SET_MEDIA (SXTH,    1, "01" "011", "011", "1111", "....", "...."),
-        DECODE_SET_MEDIA (UXTH,    1, "01" "111", "011", "1111", "....", "...."),
-        DECODE_SET_MEDIA (SEL,     0, "01" "000", "101", "....", "....", "...."),
-        DECODE_SET_MEDIA (REV,     0, "01" "011", "001", "....", "....", "...."),
-        DECODE_SET_MEDIA (REV16,   0, "01" "011", "101", "....", "....", "...."),
-        DECODE_SET_MEDIA (RBIT,    0, "01" "111", "001", "....", "....", "...."),
-        DECODE_SET_MEDIA (REVSH,   0, "01" "111", "101", "....", "....", "...."),
-
-        // signed multiply instructions
-        DECODE_SET_MEDIA_X (SMLAD,  0, "10" "000", "00", "....", "....", "...."),
-        DECODE_SET_MEDIA_X (SMUAD,  1, "10" "000", "00", "....", "1111", "...."),
-        DECODE_SET_MEDIA_X (SMLSD,  0, "10" "000", "01", "....", "....", "...."),
-        DECODE_SET_MEDIA_X (SMUSD,  1, "10" "000", "01", "....", "1111", "...."),
-        DECODE_SET_MEDIA_X (SMLALD, 0, "10" "100", "00", "....", "....", "...."),
-        DECODE_SET_MEDIA_X (SMLSLD, 0, "10" "100", "01", "....", "....", "...."),
-        DECODE_SET_MEDIA_R (SMMLA,  0, "10" "101", "00", "....", "....", "...."),
-        DECODE_SET_MEDIA_R (SMMUL,  1, "10" "101", "00", "....", "1111", "...."),
-        DECODE_SET_MEDIA_R (SMMLS,  0, "10" "101", "11", "....", "....", "...."),
-
-        ////////////////////////////////////////////////////////////////////////////
-        // SIMD/VFP INSTRUCTIONS
-        ////////////////////////////////////////////////////////////////////////////
-
-        // SIMD data processing instructions - Miscellaneous
-        DECODE_SET_VEXT  (VEXT),
-        DECODE_SET_VTBL  (VTBL, "0"),
-        DECODE_SET_VTBL  (VTBX, "1"),
-        DECODE_SET_VDUPZ (VDUPZ),
-
-        // SIMD data processing instructions - 3 regs same length
-        DECODE_SET_SIMD_RRR_QD_BHW  (VHADDU,  "0000", "0", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VHADDS,  "0000", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VQADDU,  "0000", "1", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VQADDS,  "0000", "1", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VRHADDU, "0001", "0", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VRHADDS, "0001", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD      (VAND,    "0001", "1", "0", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VBIC,    "0001", "1", "0", "01"),
-        DECODE_SET_SIMD_RRR_QD      (VORR,    "0001", "1", "0", "10"),
-        DECODE_SET_SIMD_RRR_QD      (VORN,    "0001", "1", "0", "11"),
-        DECODE_SET_SIMD_RRR_QD      (VEOR,    "0001", "1", "1", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VBSL,    "0001", "1", "1", "01"),
-        DECODE_SET_SIMD_RRR_QD      (VBIT,    "0001", "1", "1", "10"),
-        DECODE_SET_SIMD_RRR_QD      (VBIF,    "0001", "1", "1", "11"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VHSUBU,  "0010", "0", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VHSUBS,  "0010", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VQSUBU,  "0010", "1", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VQSUBS,  "0010", "1", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VCGTU,   "0011", "0", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VCGTS,   "0011", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VCGEU,   "0011", "1", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VCGES,   "0011", "1", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VSHLU,   "0100", "0", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VSHLS,   "0100", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VQSHLU,  "0100", "1", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VQSHLS,  "0100", "1", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VRSHLU,  "0101", "0", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VRSHLS,  "0101", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VQRSHLU, "0101", "1", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VQRSHLS, "0101", "1", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VMAXU,   "0110", "0", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VMAXS,   "0110", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VMINU,   "0110", "1", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VMINS,   "0110", "1", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VABDU,   "0111", "0", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VABDS,   "0111", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VABAU,   "0111", "1", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VABAS,   "0111", "1", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VADD,    "1000", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHWD (VSUB,    "1000", "0", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VTST,    "1000", "1", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VCEQ,    "1000", "1", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VMLA,    "1001", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VMLS,    "1001", "0", "1"),
-        DECODE_SET_SIMD_RRR_QD_BHW  (VMUL,    "1001", "1", "0"),
-        DECODE_SET_SIMD_RRR_QD_P    (VMUL_P,  "1001", "1", "1"),
-        DECODE_SET_SIMD_RRR_D_BHW   (VPMAXS,  "1010", "0", "0"),
-        DECODE_SET_SIMD_RRR_D_BHW   (VPMAXU,  "1010", "0", "1"),
-        DECODE_SET_SIMD_RRR_D_BHW   (VPMINS,  "1010", "1", "0"),
-        DECODE_SET_SIMD_RRR_D_BHW   (VPMINU,  "1010", "1", "1"),
-        DECODE_SET_SIMD_RRR_QD_HW   (VQDMULH, "1011", "0", "0"),
-        DECODE_SET_SIMD_RRR_QD_HW   (VQRDMULH,"1011", "0", "1"),
-        DECODE_SET_SIMD_RRR_D_BHW   (VPADD,   "1011", "1", "0"),
-        DECODE_SET_SIMD_RRR_QD      (VADD_F,  "1101", "0", "0", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VSUB_F,  "1101", "0", "0", "10"),
-        DECODE_SET_SIMD_RRR         (VPADD_F, "1101", "0", "1", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VABD_F,  "1101", "0", "1", "10"),
-        DECODE_SET_SIMD_RRR_QD      (VMLA_F,  "1101", "1", "0", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VMLS_F,  "1101", "1", "0", "10"),
-        DECODE_SET_SIMD_RRR_QD      (VMUL_F,  "1101", "1", "1", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VCEQ_F,  "1110", "0", "0", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VCGE_F,  "1110", "0", "1", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VCGT_F,  "1110", "0", "1", "10"),
-        DECODE_SET_SIMD_RRR_QD      (VACGE_F, "1110", "1", "1", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VACGT_F, "1110", "1", "1", "10"),
-        DECODE_SET_SIMD_RRR_QD      (VMAX_F,  "1111", "0", "0", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VMIN_F,  "1111", "0", "0", "10"),
-        DECODE_SET_SIMD_RRR         (VPMAX_F, "1111", "0", "1", "00"),
-        DECODE_SET_SIMD_RRR         (VPMIN_F, "1111", "0", "1", "10"),
-        DECODE_SET_SIMD_RRR_QD      (VRECPS,  "1111", "1", "0", "00"),
-        DECODE_SET_SIMD_RRR_QD      (VRSQRTS, "1111", "1", "0", "10"),
-
-        // SIMD data processing instructions - 3 regs different lengths
-        DECODE_SET_SIMD_L_BHW (VADDLS,  "0000", "0"),
-        DECODE_SET_SIMD_L_BHW (VADDLU,  "0000", "1"),
-        DECODE_SET_SIMD_W_BHW (VADDWS,  "0001", "0"),
-        DECODE_SET_SIMD_W_BHW (VADDWU,  "0001", "1"),
-        DECODE_SET_SIMD_L_BHW (VSUBLS,  "0010", "0"),
-        DECODE_SET_SIMD_L_BHW (VSUBLU,  "0010", "1"),
-        DECODE_SET_SIMD_W_BHW (VSUBWS,  "0011", "0"),
-        DECODE_SET_SIMD_W_BHW (VSUBWU,  "0011", "1"),
-        DECODE_SET_SIMD_N_HWD (VADDHN,  "0100", "0"),
-        DECODE_SET_SIMD_N_HWD (VRADDHN, "0100", "1"),
-        DECODE_SET_SIMD_L_BHW (VABALS,  "0101", "0"),
-        DECODE_SET_SIMD_L_BHW (VABALU,  "0101", "1"),
-        DECODE_SET_SIMD_N_HWD (VSUBHN,  "0110", "0"),
-        DECODE_SET_SIMD_N_HWD (VRSUBHN, "0110", "1"),
-        DECODE_SET_SIMD_L_BHW (VABDLS,  "0111", "0"),
-        DECODE_SET_SIMD_L_BHW (VABDLU,  "0111", "1"),
-        DECODE_SET_SIMD_L_BHW (VMLALS,  "1000", "0"),
-        DECODE_SET_SIMD_L_BHW (VMLALU,  "1000", "1"),
-        DECODE_SET_SIMD_L_BHW (VMLSLS,  "1010", "0"),
-        DECODE_SET_SIMD_L_BHW (VMLSLU,  "1010", "1"),
-        DECODE_SET_SIMD_L_HW  (VQDMLAL, "1001", "0"),
-        DECODE_SET_SIMD_L_HW  (VQDMLSL, "1011", "0"),
-        DECODE_SET_SIMD_L_BHW (VMULLS,  "1100", "0"),
-        DECODE_SET_SIMD_L_BHW (VMULLU,  "1100", "1"),
-        DECODE_SET_SIMD_L_HW  (VQDMULL, "1101", "0"),
-        DECODE_SET_SIMD_L_P   (VMULL_P, "1110"),
-
-        // SIMD data processing instructions - 2 regs and a scalar
-        DECODE_SET_SIMD_RRZ_QD_HW (VMLAZ,     "0000"),
-        DECODE_SET_SIMD_RRZ_QD    (VMLAZ_F,   "0001"),
-        DECODE_SET_SIMD_RRZ_QD_HW (VMLSZ,     "0100"),
-        DECODE_SET_SIMD_RRZ_QD    (VMLSZ_F,   "0101"),
-        DECODE_SET_SIMD_LZ_HW     (VMLALZS,   "0010", "0"),
-        DECODE_SET_SIMD_LZ_HW     (VMLALZU,   "0010", "1"),
-        DECODE_SET_SIMD_LZ_HW     (VMLSLZS,   "0110", "0"),
-        DECODE_SET_SIMD_LZ_HW     (VMLSLZU,   "0110", "1"),
-        DECODE_SET_SIMD_LZ_HW     (VQDMLALZ,  "0011", "0"),
-        DECODE_SET_SIMD_LZ_HW     (VQDMLSLZ,  "0111", "0"),
-        DECODE_SET_SIMD_RRZ_QD_HW (VMULZ,     "1000"),
-        DECODE_SET_SIMD_RRZ_QD    (VMULZ_F,   "1001"),
-        DECODE_SET_SIMD_LZ_HW     (VMULLZS,   "1010", "0"),
-        DECODE_SET_SIMD_LZ_HW     (VMULLZU,   "1010", "1"),
-        DECODE_SET_SIMD_LZ_HW     (VQDMULLZ,  "1011", "0"),
-        DECODE_SET_SIMD_RRZ_QD_HW (VQDMULHZ,  "1100"),
-        DECODE_SET_SIMD_RRZ_QD_HW (VQRDMULHZ, "1101"),
-
-        // SIMD data processing instructions - 2 regs and a shift amount
-        DECODE_SET_SIMD_RRI_QD_BHWD(VSHRS,    "0000", "0"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VSHRU,    "0000", "1"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VSRAS,    "0001", "0"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VSRAU,    "0001", "1"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VRSHRS,   "0010", "0"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VRSHRU,   "0010", "1"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VRSRAS,   "0011", "0"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VRSRAU,   "0011", "1"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VSRI,     "0100", "1"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VSHL,     "0101", "0"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VSLI,     "0101", "1"),
-        DECODE_SET_SIMD_VQSHLUS    (VQSHLUS,  "0110", "1"),    //VQSHLU specifies undefined instruction when U=0
-        DECODE_SET_SIMD_RRI_QD_BHWD(VQSHLSS,  "0111", "0"),
-        DECODE_SET_SIMD_RRI_QD_BHWD(VQSHLSU,  "0111", "1"),
-        DECODE_SET_SIMD_NI_HWD     (VSHRN,    "1000", "0", "0"),
-        DECODE_SET_SIMD_NI_HWD     (VRSHRN,   "1000", "0", "1"),
-        DECODE_SET_SIMD_NI_HWD     (VQSHRUNS, "1000", "1", "0"),
-        DECODE_SET_SIMD_NI_HWD     (VQRSHRUNS,"1000", "1", "1"),
-        DECODE_SET_SIMD_NI_HWD     (VQSHRNS,  "1001", "0", "0"),
-        DECODE_SET_SIMD_NI_HWD     (VQRSHRNS, "1001", "0", "1"),
-        DECODE_SET_SIMD_NI_HWD     (VQSHRNU,  "1001", "1", "0"),
-        DECODE_SET_SIMD_NI_HWD     (VQRSHRNU, "1001", "1", "1"),
-        DECODE_SET_SIMD_LI_BHW     (VSHLLS,   "1010", "0"),
-        DECODE_SET_SIMD_LI_BHW     (VSHLLU,   "1010", "1"),
-        DECODE_SET_SIMD_VMOVL      (VMOVLS,   "1010", "0"),
-        DECODE_SET_SIMD_VMOVL      (VMOVLU,   "1010", "1"),
-        DECODE_SET_SIMD_RRI_QD_W   (VCVTFXS,  "1110", "0"),
-        DECODE_SET_SIMD_RRI_QD_W   (VCVTFXU,  "1110", "1"),
-        DECODE_SET_SIMD_RRI_QD_W   (VCVTXFS,  "1111", "0"),
-        DECODE_SET_SIMD_RRI_QD_W   (VCVTXFU,  "1111", "1"),
-
-        // SIMD data processing instructions - Two registers, Miscellaneous
-        //  Note: These use the esize (21:20)='11' space of other instructions and must have priority > 2
-        DECODE_SET_SIMD_VREV       (VREV),
-        DECODE_SET_SIMD_RR_QD_BHW  (VPADDLS,  "00", "0100"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VPADDLU,  "00", "0101"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VCLS,     "00", "1000"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VCLZ,     "00", "1001"),
-        DECODE_SET_SIMD_RR_QD_B    (VCNT,     "00", "1010"),
-        DECODE_SET_SIMD_RR_QD_B    (VMVN,     "00", "1011"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VPADALS,  "00", "1100"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VPADALU,  "00", "1101"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VQABS,    "00", "1110"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VQNEG,    "00", "1111"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VCGT0,    "01", "0000"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VCGE0,    "01", "0001"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VCEQ0,    "01", "0010"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VCLE0,    "01", "0011"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VCLT0,    "01", "0100"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VABS,     "01", "0110"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VNEG,     "01", "0111"),
-        DECODE_SET_SIMD_RR_QD_W    (VCGT0_F,  "01", "1000"),
-        DECODE_SET_SIMD_RR_QD_W    (VCGE0_F,  "01", "1001"),
-        DECODE_SET_SIMD_RR_QD_W    (VCEQ0_F,  "01", "1010"),
-        DECODE_SET_SIMD_RR_QD_W    (VCLE0_F,  "01", "1011"),
-        DECODE_SET_SIMD_RR_QD_W    (VCLT0_F,  "01", "1100"),
-        DECODE_SET_SIMD_RR_QD_W    (VABS_F,   "01", "1110"),
-        DECODE_SET_SIMD_RR_QD_W    (VNEG_F,   "01", "1111"),
-        DECODE_SET_SIMD_RR_QD_B    (VSWP,     "10", "0000"),
-        DECODE_SET_SIMD_RR_QD_BHW  (VTRN,     "10", "0001"),
-        DECODE_SET_SIMD_RR_QBHW_DBH(VUZP,     "10", "0010"),
-        DECODE_SET_SIMD_RR_QBHW_DBH(VZIP,     "10", "0011"),
-        DECODE_SET_SIMD_N2_HWD     (VMOVN,    "10", "01000"),
-        DECODE_SET_SIMD_N2_HWD     (VQMOVUNS, "10", "01001"),
-        DECODE_SET_SIMD_N2_HWD     (VQMOVNS,  "10", "01010"),
-        DECODE_SET_SIMD_N2_HWD     (VQMOVNU,  "10", "01011"),
-        DECODE_SET_SIMD_L2_BHW     (VSHLLM,   "10", "01100"),
-        DECODE_SET_SIMD_N2_H       (VCVTHS,   "10", "11000"),
-        DECODE_SET_SIMD_L2_H       (VCVTSH,   "10", "11100"),
-        DECODE_SET_SIMD_RR_QD_W    (VRECPE,   "11", "1000"),
-        DECODE_SET_SIMD_RR_QD_W    (VRECPE_F, "11", "1010"),
-        DECODE_SET_SIMD_RR_QD_W    (VRSQRTE,  "11", "1001"),
-        DECODE_SET_SIMD_RR_QD_W    (VRSQRTE_F,"11", "1011"),
-        DECODE_SET_SIMD_RR_QD_W    (VCVTFS,   "11", "1100"),
-        DECODE_SET_SIMD_RR_QD_W    (VCVTFU,   "11", "1101"),
-        DECODE_SET_SIMD_RR_QD_W    (VCVTSF,   "11", "1110"),
-        DECODE_SET_SIMD_RR_QD_W    (VCVTUF,   "11", "1111"),
-
-        // SIMD data processing instructions - One register and a modified immediate
-        DECODE_SET_SIMD_RI_QD (VMOVI_W,   "0",  "0..0"),
-        DECODE_SET_SIMD_RI_QD (VORRI_W,   "0",  "0..1"),
-        DECODE_SET_SIMD_RI_QD (VMOVI_H,   "0",  "10.0"),
-        DECODE_SET_SIMD_RI_QD (VORRI_H,   "0",  "10.1"),
-        DECODE_SET_SIMD_RI_QD (VMOVI1_W,  "0",  "110."),
-        DECODE_SET_SIMD_RI_QD (VMOVI_B,   "0",  "1110"),
-        DECODE_SET_SIMD_RI_QD (VMOVI_F_W, "0",  "1111"),
-        DECODE_SET_SIMD_RI_QD (VMVNI_W,   "1",  "0..0"),
-        DECODE_SET_SIMD_RI_QD (VBICI_W,   "1",  "0..1"),
-        DECODE_SET_SIMD_RI_QD (VMVNI_H,   "1",  "10.0"),
-        DECODE_SET_SIMD_RI_QD (VBICI_H,   "1",  "10.1"),
-        DECODE_SET_SIMD_RI_QD (VMVNI1_W,  "1",  "110."),
-        DECODE_SET_SIMD_RI_QD (VMOVI_D,   "1",  "1110"),
-
-        // VFP data processing instructions - 3 regs
-        DECODE_SET_VFP_DS (VMLA_VFP,    "0.00", "....", ".0"),
-        DECODE_SET_VFP_DS (VMLS_VFP,    "0.00", "....", ".1"),
-        DECODE_SET_VFP_DS (VNMLS_VFP,   "0.01", "....", ".0"),
-        DECODE_SET_VFP_DS (VNMLA_VFP,   "0.01", "....", ".1"),
-        DECODE_SET_VFP_DS (VMUL_VFP,    "0.10", "....", ".0"),
-        DECODE_SET_VFP_DS (VNMUL_VFP,   "0.10", "....", ".1"),
-        DECODE_SET_VFP_DS (VADD_VFP,    "0.11", "....", ".0"),
-        DECODE_SET_VFP_DS (VSUB_VFP,    "0.11", "....", ".1"),
-        DECODE_SET_VFP_DS (VDIV_VFP,    "1.00", "....", ".0"),
-
-        // VFP data processing instructions - Other
-        DECODE_SET_VFP_DS (VMOVI_VFP,    "1.11", "....", ".0"),
-        DECODE_SET_VFP_DS (VMOVR_VFP,    "1.11", "0000", "01"),
-        DECODE_SET_VFP_DS (VABS_VFP,     "1.11", "0000", "11"),
-        DECODE_SET_VFP_DS (VNEG_VFP,     "1.11", "0001", "01"),
-        DECODE_SET_VFP_DS (VSQRT_VFP,    "1.11", "0001", "11"),
-        DECODE_SET_VFP_S  (VCVTBFH_VFP,  "1.11", "0010", "01"),
-        DECODE_SET_VFP_S  (VCVTTFH_VFP,  "1.11", "0010", "11"),
-        DECODE_SET_VFP_S  (VCVTBHF_VFP,  "1.11", "0011", "01"),
-        DECODE_SET_VFP_S  (VCVTTHF_VFP,  "1.11", "0011", "11"),
-        DECODE_SET_VFP_DS (VCMP_VFP,     "1.11", "0100", "01"),
-        DECODE_SET_VFP_DS (VCMPE_VFP,    "1.11", "0100", "11"),
-        DECODE_SET_VFP_DS (VCMP0_VFP,    "1.11", "0101", "01"),
-        DECODE_SET_VFP_DS (VCMPE0_VFP,   "1.11", "0101", "11"),
-        DECODE_SET_VFP_DS (VCVT_VFP,     "1.11", "0111", "11"),
-        DECODE_SET_VFP_DS (VCVTFU_VFP,   "1.11", "1000", "01"),
-        DECODE_SET_VFP_DS (VCVTFS_VFP,   "1.11", "1000", "11"),
-        DECODE_SET_VFP_DS (VCVTFXSH_VFP, "1.11", "1010", "01"),
-        DECODE_SET_VFP_DS (VCVTFXSW_VFP, "1.11", "1010", "11"),
-        DECODE_SET_VFP_DS (VCVTFXUH_VFP, "1.11", "1011", "01"),
-        DECODE_SET_VFP_DS (VCVTFXUW_VFP, "1.11", "1011", "11"),
-        DECODE_SET_VFP_DS (VCVTRUF_VFP,  "1.11", "1100", "01"),
-        DECODE_SET_VFP_DS (VCVTUF_VFP,   "1.11", "1100", "11"),
-        DECODE_SET_VFP_DS (VCVTRSF_VFP,  "1.11", "1101", "01"),
-        DECODE_SET_VFP_DS (VCVTSF_VFP,   "1.11", "1101", "11"),
-        DECODE_SET_VFP_DS (VCVTXFSH_VFP, "1.11", "1110", "01"),
-        DECODE_SET_VFP_DS (VCVTXFSW_VFP, "1.11", "1110", "11"),
-        DECODE_SET_VFP_DS (VCVTXFUH_VFP, "1.11", "1111", "01"),
-        DECODE_SET_VFP_DS (VCVTXFUW_VFP, "1.11", "1111", "11"),
-
-        // Extension register load/store instructions
-        DECODE_SET_SDFP_LDST     (VSTMIA,  "01.00"),
-        DECODE_SET_SDFP_LDST     (VSTMIAW, "01.10"),
-        DECODE_SET_SDFP_LDST     (VSTR,    "1..00"),
-        DECODE_SET_SDFP_LDST     (VSTMDBW, "10.10"),
-        DECODE_SET_SDFP_PUSH_POP (VPUSH,   "10.10"),
-        DECODE_SET_SDFP_LDST     (VLDMIA,  "01.01"),
-        DECODE_SET_SDFP_LDST     (VLDMIAW, "01.11"),
-        DECODE_SET_SDFP_PUSH_POP (VPOP,    "01.11"),
-        DECODE_SET_SDFP_LDST     (VLDR,    "1..01"),
-        DECODE_SET_SDFP_LDST     (VLDMDBW, "10.11"),
-
-        // SIMD element or structure load/store instructions
-        DECODE_SET_SIMD_LDSTN_BHWD      (VSTN1_R4,   "0", "0", "0010"),
-        DECODE_SET_SIMD_LDSTN_BHWD_A01  (VSTN1_R3,   "0", "0", "0110"),
-        DECODE_SET_SIMD_LDSTN_BHWD_A012 (VSTN1_R2,   "0", "0", "1010"),
-        DECODE_SET_SIMD_LDSTN_BHWD_A01  (VSTN1_R1,   "0", "0", "0111"),
-        DECODE_SET_SIMD_LDSTN_BHW       (VSTN2_R2I2, "0", "0", "0011"),
-        DECODE_SET_SIMD_LDSTN_BHW_A012  (VSTN2_R1I2, "0", "0", "1001"),
-        DECODE_SET_SIMD_LDSTN_BHW_A012  (VSTN2_R1I1, "0", "0", "1000"),
-        DECODE_SET_SIMD_LDSTN_BHW_A01   (VSTN3_R3I1, "0", "0", "0100"),
-        DECODE_SET_SIMD_LDSTN_BHW_A01   (VSTN3_R3I2, "0", "0", "0101"),
-        DECODE_SET_SIMD_LDSTN_BHW       (VSTN4_R4I1, "0", "0", "0000"),
-        DECODE_SET_SIMD_LDSTN_BHW       (VSTN4_R4I2, "0", "0", "0001"),
-
-        DECODE_SET_SIMD_LDSTN_BHWD      (VLDN1_R4,   "0", "1", "0010"),
-        DECODE_SET_SIMD_LDSTN_BHWD_A01  (VLDN1_R3,   "0", "1", "0110"),
-        DECODE_SET_SIMD_LDSTN_BHWD_A012 (VLDN1_R2,   "0", "1", "1010"),
-        DECODE_SET_SIMD_LDSTN_BHWD_A01  (VLDN1_R1,   "0", "1", "0111"),
-        DECODE_SET_SIMD_LDSTN_BHW       (VLDN2_R2I2, "0", "1", "0011"),
-        DECODE_SET_SIMD_LDSTN_BHW_A012  (VLDN2_R1I2, "0", "1", "1001"),
-        DECODE_SET_SIMD_LDSTN_BHW_A012  (VLDN2_R1I1, "0", "1", "1000"),
-        DECODE_SET_SIMD_LDSTN_BHW_A01   (VLDN3_R3I1, "0", "1", "0100"),
-        DECODE_SET_SIMD_LDSTN_BHW_A01   (VLDN3_R3I2, "0", "1", "0101"),
-        DECODE_SET_SIMD_LDSTN_BHW       (VLDN4_R4I1, "0", "1", "0000"),
-        DECODE_SET_SIMD_LDSTN_BHW       (VLDN4_R4I2, "0", "1", "0001"),
-
-        DECODE_SET_SIMD_LDST1Z1_BHW     (VST1Z1,    "1", "0", "00"),
-        DECODE_SET_SIMD_LDST2Z1_BHW     (VST2Z1,    "1", "0", "01"),
-        DECODE_SET_SIMD_LDST3Z1_BHW     (VST3Z1,    "1", "0", "10"),
-        DECODE_SET_SIMD_LDST4Z1_BHW     (VST4Z1,    "1", "0", "11"),
-
-        DECODE_SET_SIMD_LDST1Z1_BHW     (VLD1Z1,    "1", "1", "00"),
-        DECODE_SET_SIMD_LD1ZA_BHW       (VLD1ZA,    "1", "1", "00"),
-        DECODE_SET_SIMD_LDST2Z1_BHW     (VLD2Z1,    "1", "1", "01"),
-        DECODE_SET_SIMD_LD2ZA_BHW       (VLD2ZA,    "1", "1", "01"),
-        DECODE_SET_SIMD_LDST3Z1_BHW     (VLD3Z1,    "1", "1", "10"),
-        DECODE_SET_SIMD_LD3ZA_BHW       (VLD3ZA,    "1", "1", "10"),
-        DECODE_SET_SIMD_LDST4Z1_BHW     (VLD4Z1,    "1", "1", "11"),
-        DECODE_SET_SIMD_LD4ZA_BHW       (VLD4ZA,    "1", "1", "11"),
-
-        // 8, 16 and 32-bit transfer instructions between ARM core regs and extension regs
-        DECODE_SET_VMRS   (VMRS,   "1", "0", "111", ".."),
-        DECODE_SET_VMRS   (VMSR,   "0", "0", "111", ".."),
-        DECODE_SET_VMRS   (VMOVRS, "1", "0", "000", ".."),
-        DECODE_SET_VMRS   (VMOVSR, "0", "0", "000", ".."),
-        DECODE_SET_VMOVZR (VMOVZR),
-        DECODE_SET_VMOVRZ (VMOVRZ),
-        DECODE_SET_VDUPR  (VDUPR),
-
-        // 64-bit transfer instructions between ARM core regs and extension regs
-        DECODE_SET_VMOVRRD (VMOVRRD,  "1", "1", "00.1"),
-        DECODE_SET_VMOVRRD (VMOVDRR,  "0", "1", "00.1"),
-        DECODE_SET_VMOVRRD (VMOVRRSS, "1", "0", "00.1"),
-        DECODE_SET_VMOVRRD (VMOVSSRR, "0", "0", "00.1"),
-
-        // terminator
-        {0}
-    };
-
     // create the table
     vmidDecodeTableP   table = vmidNewDecodeTable(32, ARM_IT_LAST);
     const decodeEntry *entry;
 
     // add all entries to the decode table
-    for(entry=entries; entry->pattern; entry++) {
+    for(entry=decodeEntriesARM; entry->pattern; entry++) {
         vmidNewEntryFmtBin(
             table,
             entry->name,
@@ -2245,14 +1695,46 @@ armInstructionType armGetARMInstructionType(
 
     Uns32 instr = vmicxtFetch4Byte((vmiProcessorP)arm, thisPC);
 
+    // return instruction using byref argument
+    if(instrP) *instrP = instr;
+
+#ifdef ARM_STATIC_DECODE
+    // decode the instruction using the static decoder if enabled
+    if(arm->staticDecode) {
+
+        armInstructionType type = armDecodeStatic(
+            decodeNodesARM, decodePatternsARM, instr, ARM_IT_LAST
+        );
+
+        // check the static decoder against the decode table if required
+        if(arm->checkDecode) {
+
+            armInstructionType tableType;
+
+            if(!decodeTable) {
+                decodeTable = createDecodeTableARM();
+            }
+
+            tableType = vmidDecode(decodeTable, instr);
+
+            if(type!=tableType) {
+                vmiMessage("E", CPU_PREFIX"_SDM",
+                    "static decoder gives type %u for ARM instruction "
+                    "0x%08x at 0x%08x, decode table gives %u",
+                    type, instr, thisPC, tableType
+                );
+            }
+        }
+
+        return type;
+    }
+#endif
+
     // create instruction decode table if required
     if(!decodeTable) {
         decodeTable = createDecodeTableARM();
     }
 
-    // return instruction using byref argument
-    if(instrP) *instrP = instr;
-
     // decode the instruction using decode table
     return vmidDecode(decodeTable, instr);
 }
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2005-2011 Imperas Software Ltd., www.imperas.com
+ *
+ * YOUR ACCESS TO THE INFORMATION IN THIS MODEL IS CONDITIONAL
+ * UPON YOUR ACCEPTANCE THAT YOU WILL NOT USE OR PERMIT OTHERS
+ * TO USE THE INFORMATION FOR THE PURPOSES OF DETERMINING WHETHER
+ * IMPLEMENTATIONS OF THE ARM ARCHITECTURE INFRINGE ANY THIRD
+ * PARTY PATENTS.
+ *
+ * THE LICENSE BELOW EXTENDS ONLY TO USE OF THE SOFTWARE FOR
+ * MODELING PURPOSES AND SHALL NOT BE CONSTRUED AS GRANTING
+ * A LICENSE TO CREATE A HARDWARE IMPLEMENTATION OF THE
+ * FUNCTIONALITY OF THE SOFTWARE LICENSED HEREUNDER.
+ * YOU MAY USE THE SOFTWARE SUBJECT TO THE LICENSE TERMS BELOW
+ * PROVIDED THAT YOU ENSURE THAT THIS NOTICE IS REPLICATED UNMODIFIED
+ * AND IN ITS ENTIRETY IN ALL DISTRIBUTIONS OF THE SOFTWARE,
+ * MODIFIED OR UNMODIFIED, IN SOURCE CODE OR IN BINARY FORM.
+ *
+ * Licensed under an Imperas Modfied Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.ovpworld.org/licenses/OVP_MODIFIED_1.0_APACHE_OPEN_SOURCE_LICENSE_2.0.pdf
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied.
+ *
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef ARM_DECODE_LIST_THUMB16_H
+#define ARM_DECODE_LIST_THUMB16_H
+
+#include "armDecodeEntriesThumb16.h"
+
+//
+// 16-bit Thumb instruction decode entries (type decodeEntry is defined by
+// the includer)
+//
+const static decodeEntry decodeEntriesThumb16[] = {
+
+    // data processing instructions
+    DECODE_SET_16_ADC  (ADC,    "010000|0101"),
+    DECODE_SET_16_ADD1 (ADD1,   "0001110"),
+    DECODE_SET_16_ADD2 (ADD2,   "00110"),
+    DECODE_SET_16_ADD1 (ADD3,   "0001100"),
+    DECODE_SET_16_ADD4 (ADD4LL, "01000100|0|0"),
+    DECODE_SET_16_ADD4 (ADD4LH, "01000100|0|1"),
+    DECODE_SET_16_ADD4 (ADD4H,  "01000100|1|."),
+    DECODE_SET_16_ADD2 (ADD5,   "10100"),
+    DECODE_SET_16_ADD2 (ADD6,   "10101"),
+    DECODE_SET_16_ADD7 (ADD7,   "101100000"),
+    DECODE_SET_16_ADC  (AND,    "010000|0000"),
+    DECODE_SET_16_ASR1 (ASR1,   "00010"),
+    DECODE_SET_16_ADC  (ASR2,   "010000|0100"),
+    DECODE_SET_16_ADC  (BIC,    "010000|1110"),
+    DECODE_SET_16_ADC  (EOR,    "010000|0001"),
+    DECODE_SET_16_ASR1 (LSL1,   "00000"),
+    DECODE_SET_16_ADC  (LSL2,   "010000|0010"),
+    DECODE_SET_16_ASR1 (LSR1,   "00001"),
+    DECODE_SET_16_ADC  (LSR2,   "010000|0011"),
+    DECODE_SET_16_ADD2 (MOV1,   "00100"),
+    DECODE_SET_16_ADC  (MOV2,   "000000|0000"),
+    DECODE_SET_16_ADD4 (MOV3LL, "01000110|0|0"),
+    DECODE_SET_16_ADD4 (MOV3LH, "01000110|0|1"),
+    DECODE_SET_16_ADD4 (MOV3H,  "01000110|1|."),
+    DECODE_SET_16_ADC  (MVN,    "010000|1111"),
+    DECODE_SET_16_ADC  (NEG,    "010000|1001"),
+    DECODE_SET_16_ADC  (ORR,    "010000|1100"),
+    DECODE_SET_16_ADC  (ROR,    "010000|0111"),
+    DECODE_SET_16_ADC  (SBC,    "010000|0110"),
+    DECODE_SET_16_ADD1 (SUB1,   "0001111"),
+    DECODE_SET_16_ADD2 (SUB2,   "00111"),
+    DECODE_SET_16_ADD1 (SUB3,   "0001101"),
+    DECODE_SET_16_ADD7 (SUB4,   "101100001"),
+
+    // multiply instructions
+    DECODE_SET_16_ADC (MUL,  "010000|1101"),
+
+    // compare instructions
+    DECODE_SET_16_ADC  (CMN,    "010000|1011"),
+    DECODE_SET_16_ADD2 (CMP1,   "00101"),
+    DECODE_SET_16_ADC  (CMP2,   "010000|1010"),
+    DECODE_SET_16_ADD4 (CMP3LH, "01000101|0|1"),
+    DECODE_SET_16_ADD4 (CMP3H,  "01000101|1|."),
+    DECODE_SET_16_ADC  (TST,    "010000|1000"),
+
+    // branch instructions
+    DECODE_SET_16_B1   (B1,   "...."),
+    DECODE_SET_16_B2   (B2,   "00"),
+    DECODE_SET_16_BLX2 (BLX2, "010001111"),
+    DECODE_SET_16_BLX2 (BX,   "010001110"),
+    DECODE_SET_16_SWI  (SWI,  "1111"),
+    DECODE_SET_16_SWI  (BU,   "1110"),
+
+    // miscellaneous instructions
+    DECODE_SET_16_BKPT (SETEND, "0110010"),
+    DECODE_SET_16_BKPT (CPS,    "0110011"),
+    DECODE_SET_16_BKPT (CBNZ,   "10.1..."),
+    DECODE_SET_16_BKPT (CBZ,    "00.1..."),
+    DECODE_SET_16_BKPT (SXTH,   "001000."),
+    DECODE_SET_16_BKPT (SXTB,   "001001."),
+    DECODE_SET_16_BKPT (UXTH,   "001010."),
+    DECODE_SET_16_BKPT (UXTB,   "001011."),
+    DECODE_SET_16_BKPT (REV,    "101000."),
+    DECODE_SET_16_BKPT (REV16,  "101001."),
+    DECODE_SET_16_BKPT (REVSH,  "101011."),
+    DECODE_SET_16_BKPT (BKPT,   "1110..."),
+
+    // load and store instructions
+    DECODE_SET_16_ASR1 (LDR1,  "01101"),
+    DECODE_SET_16_ADD1 (LDR2,  "0101100"),
+    DECODE_SET_16_ADD2 (LDR3,  "01001"),
+    DECODE_SET_16_ADD2 (LDR4,  "10011"),
+    DECODE_SET_16_ASR1 (LDRB1, "01111"),
+    DECODE_SET_16_ADD1 (LDRB2, "0101110"),
+    DECODE_SET_16_ASR1 (LDRH1, "10001"),
+    DECODE_SET_16_ADD1 (LDRH2, "0101101"),
+    DECODE_SET_16_ADD1 (LDRSB, "0101011"),
+    DECODE_SET_16_ADD1 (LDRSH, "0101111"),
+    DECODE_SET_16_ASR1 (STR1,  "01100"),
+    DECODE_SET_16_ADD1 (STR2,  "0101000"),
+    DECODE_SET_16_ADD2 (STR3,  "10010"),
+    DECODE_SET_16_ASR1 (STRB1, "01110"),
+    DECODE_SET_16_ADD1 (STRB2, "0101010"),
+    DECODE_SET_16_ASR1 (STRH1, "10000"),
+    DECODE_SET_16_ADD1 (STRH2, "0101001"),
+
+    // load and store multiple instructions
+    DECODE_SET_16_ADD2 (LDMIA, "11001"),
+    DECODE_SET_16_POP  (POP,   "1011110"),
+    DECODE_SET_16_POP  (PUSH,  "1011010"),
+    DECODE_SET_16_ADD2 (STMIA, "11000"),
+
+    // if-then and hints
+    DECODE_SET_16_IT    (IT,    "....", "...."),
+    DECODE_SET_16_HINT1 (NOP,   "....", "0000"),
+    DECODE_SET_16_HINT2 (YIELD, "0001", "0000"),
+    DECODE_SET_16_HINT2 (WFE,   "0010", "0000"),
+    DECODE_SET_16_HINT2 (WFI,   "0011", "0000"),
+    DECODE_SET_16_HINT2 (SEV,   "0100", "0000"),
+
+    // 16-bit branch instructions
+    DECODE_SET_16_B2 (BL_H10, "10"),
+    DECODE_SET_16_B2 (BL_H11, "11"),
+    DECODE_SET_16_B2 (BL_H01, "01"),
+
+    // terminator
+    {0}
+};
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2005-2011 Imperas Software Ltd., www.imperas.com
+ *
+ * YOUR ACCESS TO THE INFORMATION IN THIS MODEL IS CONDITIONAL
+ * UPON YOUR ACCEPTANCE THAT YOU WILL NOT USE OR PERMIT OTHERS
+ * TO USE THE INFORMATION FOR THE PURPOSES OF DETERMINING WHETHER
+ * IMPLEMENTATIONS OF THE ARM ARCHITECTURE INFRINGE ANY THIRD
+ * PARTY PATENTS.
+ *
+ * THE LICENSE BELOW EXTENDS ONLY TO USE OF THE SOFTWARE FOR
+ * MODELING PURPOSES AND SHALL NOT BE CONSTRUED AS GRANTING
+ * A LICENSE TO CREATE A HARDWARE IMPLEMENTATION OF THE
+ * FUNCTIONALITY OF THE SOFTWARE LICENSED HEREUNDER.
+ * YOU MAY USE THE SOFTWARE SUBJECT TO THE LICENSE TERMS BELOW
+ * PROVIDED THAT YOU ENSURE THAT THIS NOTICE IS REPLICATED UNMODIFIED
+ * AND IN ITS ENTIRETY IN ALL DISTRIBUTIONS OF THE SOFTWARE,
+ * MODIFIED OR UNMODIFIED, IN SOURCE CODE OR IN BINARY FORM.
+ *
+ * Licensed under an Imperas Modfied Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.ovpworld.org/licenses/OVP_MODIFIED_1.0_APACHE_OPEN_SOURCE_LICENSE_2.0.pdf
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied.
+ *
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef ARM_DECODE_LIST_THUMBEE16_H
+#define ARM_DECODE_LIST_THUMBEE16_H
+
+#include "armDecodeEntriesThumb16.h"
+
+//
+// 16-bit ThumbEE instruction decode entries, tried before the 16-bit Thumb
+// entries in ThumbEE state (type decodeEntry is defined by the includer)
+//
+const static decodeEntry decodeEntriesThumbEE16[] = {
+
+    // ThumbEE load and store instructions differing from Thumb instructions
+    DECODE_SET_16_ADD1 (LDR_EE,   "0101100"),
+    DECODE_SET_16_ADD1 (LDRH_EE,  "0101101"),
+    DECODE_SET_16_ADD1 (LDRSH_EE, "0101111"),
+    DECODE_SET_16_ADD1 (STR_EE,   "0101000"),
+    DECODE_SET_16_ADD1 (STRH_EE,  "0101001"),
+
+    // other ThumbEE instructions
+    DECODE_SET_16_THUMBEE (UND_EE, "0001"),
+    DECODE_SET_16_THUMBEE (HBP,    "0000"),
+    DECODE_SET_16_THUMBEE (HB,     "0010"),
+    DECODE_SET_16_THUMBEE (HBL,    "0011"),
+    DECODE_SET_16_THUMBEE (HBLP,   "01.."),
+    DECODE_SET_16_THUMBEE (CHKA,   "1010"),
+    DECODE_SET_16_THUMBEE (LDRF,   "110."),
+    DECODE_SET_16_THUMBEE (LDRLP,  "1011"),
+    DECODE_SET_16_THUMBEE (LDRA,   "100."),
+    DECODE_SET_16_THUMBEE (STRF,   "111."),
+
+    // terminator
+    {0}
+};
+
+#endif
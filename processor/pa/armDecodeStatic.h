@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2005-2011 Imperas Software Ltd., www.imperas.com
+ *
+ * YOUR ACCESS TO THE INFORMATION IN THIS MODEL IS CONDITIONAL
+ * UPON YOUR ACCEPTANCE THAT YOU WILL NOT USE OR PERMIT OTHERS
+ * TO USE THE INFORMATION FOR THE PURPOSES OF DETERMINING WHETHER
+ * IMPLEMENTATIONS OF THE ARM ARCHITECTURE INFRINGE ANY THIRD
+ * PARTY PATENTS.
+ *
+ * THE LICENSE BELOW EXTENDS ONLY TO USE OF THE SOFTWARE FOR
+ * MODELING PURPOSES AND SHALL NOT BE CONSTRUED AS GRANTING
+ * A LICENSE TO CREATE A HARDWARE IMPLEMENTATION OF THE
+ * FUNCTIONALITY OF THE SOFTWARE LICENSED HEREUNDER.
+ * YOU MAY USE THE SOFTWARE SUBJECT TO THE LICENSE TERMS BELOW
+ * PROVIDED THAT YOU ENSURE THAT THIS NOTICE IS REPLICATED UNMODIFIED
+ * AND IN ITS ENTIRETY IN ALL DISTRIBUTIONS OF THE SOFTWARE,
+ * MODIFIED OR UNMODIFIED, IN SOURCE CODE OR IN BINARY FORM.
+ *
+ * Licensed under an Imperas Modfied Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.ovpworld.org/licenses/OVP_MODIFIED_1.0_APACHE_OPEN_SOURCE_LICENSE_2.0.pdf
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied.
+ *
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef ARM_DECODE_STATIC_H
+#define ARM_DECODE_STATIC_H
+
+// basic number types
+#include "hostapi/impTypes.h"
+
+//
+// Static decoders are generated at build time by processor/gen/armDecodeGen
+// from the same decode entry lists used to build the vmid decode tables
+// (armDecodeList*.h), so no decode table needs to be built at run time. A
+// decoder is a tree of nodes: an inner node selects a child using a field of
+// the instruction, a leaf holds a short list of patterns, tried in priority
+// order.
+//
+
+//
+// A pattern in a static decoder leaf
+//
+typedef struct armDecodePatternS {
+    Uns32 mask;             // fixed bits of the pattern
+    Uns32 value;            // value of the fixed bits
+    Uns32 type;             // decoded instruction type
+} armDecodePattern, *armDecodePatternP;
+
+typedef const struct armDecodePatternS *armDecodePatternCP;
+
+//
+// A static decoder node
+//
+typedef struct armDecodeNodeS {
+    Uns8  shift;            // inner node: field shift
+    Uns8  bits;             // inner node: field width (0 for a leaf)
+    Uns16 count;            // leaf: number of patterns
+    Uns32 first;            // index of first child node or leaf pattern
+} armDecodeNode, *armDecodeNodeP;
+
+typedef const struct armDecodeNodeS *armDecodeNodeCP;
+
+//
+// Decode the instruction using a static decoder, returning defaultType if no
+// pattern matches
+//
+inline static Uns32 armDecodeStatic(
+    armDecodeNodeCP    nodes,
+    armDecodePatternCP patterns,
+    Uns32              instr,
+    Uns32              defaultType
+) {
+    armDecodeNodeCP    node = nodes;
+    armDecodePatternCP pattern;
+    Uns32              i;
+
+    // select the leaf for this instruction
+    while(node->bits) {
+        Uns32 field = (instr>>node->shift) & ((1<<node->bits)-1);
+        node = &nodes[node->first+field];
+    }
+
+    // return the first matching pattern in the leaf
+    for(i=0, pattern=&patterns[node->first]; i<node->count; i++, pattern++) {
+        if((instr&pattern->mask)==pattern->value) {
+            return pattern->type;
+        }
+    }
+
+    return defaultType;
+}
+
+#endif
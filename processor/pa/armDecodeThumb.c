@@ -2051,6 +2051,17 @@ typedef struct decodeEntryS {
     const char  *pattern;
 } decodeEntry;
 
+// decode entry lists, shared with the build-time decoder generator
+#include "armDecodeListThumb16.h"
+#include "armDecodeListThumbEE16.h"
+#include "armDecodeListThumb32.h"
+
+// static decoders generated from the entry lists
+#ifdef ARM_STATIC_DECODE
+#include "armDecodeStatic.h"
+#include "armDecodeTablesThumb.h"
+#endif
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // 16-BIT INSTRUCTION DECODE TABLE
@@ -2061,124 +2072,12 @@ typedef struct decodeEntryS {
 //
 static vmidDecodeTableP createDecodeTableThumb16(void) {
 
-    const static decodeEntry entries[] = {
-
-        // data processing instructions
-        DECODE_SET_16_ADC  (ADC,    "010000|0101"),
-        DECODE_SET_16_ADD1 (ADD1,   "0001110"),
-        DECODE_SET_16_ADD2 (ADD2,   "00110"),
-        DECODE_SET_16_ADD1 (ADD3,   "0001100"),
-        DECODE_SET_16_ADD4 (ADD4LL, "01000100|0|0"),
-        DECODE_SET_16_ADD4 (ADD4LH, "01000100|0|1"),
-        DECODE_SET_16_ADD4 (ADD4H,  "01000100|1|."),
-        DECODE_SET_16_ADD2 (ADD5,   "10100"),
-        DECODE_SET_16_ADD2 (ADD6,   "10101"),
-        DECODE_SET_16_ADD7 (ADD7,   "101100000"),
-        DECODE_SET_16_ADC  (AND,    "010000|0000"),
-        DECODE_SET_16_ASR1 (ASR1,   "00010"),
-        DECODE_SET_16_ADC  (ASR2,   "010000|0100"),
-        DECODE_SET_16_ADC  (BIC,    "010000|1110"),
-        DECODE_SET_16_ADC  (EOR,    "010000|0001"),
-        DECODE_SET_16_ASR1 (LSL1,   "00000"),
-        DECODE_SET_16_ADC  (LSL2,   "010000|0010"),
-        DECODE_SET_16_ASR1 (LSR1,   "00001"),
-        DECODE_SET_16_ADC  (LSR2,   "010000|0011"),
-        DECODE_SET_16_ADD2 (MOV1,   "00100"),
-        DECODE_SET_16_ADC  (MOV2,   "000000|0000"),
-        DECODE_SET_16_ADD4 (MOV3LL, "01000110|0|0"),
-        DECODE_SET_16_ADD4 (MOV3LH, "01000110|0|1"),
-        DECODE_SET_16_ADD4 (MOV3H,  "01000110|1|."),
-        DECODE_SET_16_ADC  (MVN,    "010000|1111"),
-        DECODE_SET_16_ADC  (NEG,    "010000|1001"),
-        DECODE_SET_16_ADC  (ORR,    "010000|1100"),
-        DECODE_SET_16_ADC  (ROR,    "010000|0111"),
-        DECODE_SET_16_ADC  (SBC,    "010000|0110"),
-        DECODE_SET_16_ADD1 (SUB1,   "0001111"),
-        DECODE_SET_16_ADD2 (SUB2,   "00111"),
-        DECODE_SET_16_ADD1 (SUB3,   "0001101"),
-        DECODE_SET_16_ADD7 (SUB4,   "101100001"),
-
-        // multiply instructions
-        DECODE_SET_16_ADC (MUL,  "010000|1101"),
-
-        // compare instructions
-        DECODE_SET_16_ADC  (CMN,    "010000|1011"),
-        DECODE_SET_16_ADD2 (CMP1,   "00101"),
-        DECODE_SET_16_ADC  (CMP2,   "010000|1010"),
-        DECODE_SET_16_ADD4 (CMP3LH, "01000101|0|1"),
-        DECODE_SET_16_ADD4 (CMP3H,  "01000101|1|."),
-        DECODE_SET_16_ADC  (TST,    "010000|1000"),
-
-        // branch instructions
-        DECODE_SET_16_B1   (B1,   "...."),
-        DECODE_SET_16_B2   (B2,   "00"),
-        DECODE_SET_16_BLX2 (BLX2, "010001111"),
-        DECODE_SET_16_BLX2 (BX,   "010001110"),
-        DECODE_SET_16_SWI  (SWI,  "1111"),
-        DECODE_SET_16_SWI  (BU,   "1110"),
-
-        // miscellaneous instructions
-        DECODE_SET_16_BKPT (SETEND, "0110010"),
-        DECODE_SET_16_BKPT (CPS,    "0110011"),
-        DECODE_SET_16_BKPT (CBNZ,   "10.1..."),
-        DECODE_SET_16_BKPT (CBZ,    "00.1..."),
-        DECODE_SET_16_BKPT (SXTH,   "001000."),
-        DECODE_SET_16_BKPT (SXTB,   "001001."),
-        DECODE_SET_16_BKPT (UXTH,   "001010."),
-        DECODE_SET_16_BKPT (UXTB,   "001011."),
-        DECODE_SET_16_BKPT (REV,    "101000."),
-        DECODE_SET_16_BKPT (REV16,  "101001."),
-        DECODE_SET_16_BKPT (REVSH,  "101011."),
-        DECODE_SET_16_BKPT (BKPT,   "1110..."),
-
-        // load and store instructions
-        DECODE_SET_16_ASR1 (LDR1,  "01101"),
-        DECODE_SET_16_ADD1 (LDR2,  "0101100"),
-        DECODE_SET_16_ADD2 (LDR3,  "01001"),
-        DECODE_SET_16_ADD2 (LDR4,  "10011"),
-        DECODE_SET_16_ASR1 (LDRB1, "01111"),
-        DECODE_SET_16_ADD1 (LDRB2, "0101110"),
-        DECODE_SET_16_ASR1 (LDRH1, "10001"),
-        DECODE_SET_16_ADD1 (LDRH2, "0101101"),
-        DECODE_SET_16_ADD1 (LDRSB, "0101011"),
-        DECODE_SET_16_ADD1 (LDRSH, "0101111"),
-        DECODE_SET_16_ASR1 (STR1,  "01100"),
-        DECODE_SET_16_ADD1 (STR2,  "0101000"),
-        DECODE_SET_16_ADD2 (STR3,  "10010"),
-        DECODE_SET_16_ASR1 (STRB1, "01110"),
-        DECODE_SET_16_ADD1 (STRB2, "0101010"),
-        DECODE_SET_16_ASR1 (STRH1, "10000"),
-        DECODE_SET_16_ADD1 (STRH2, "0101001"),
-
-        // load and store multiple instructions
-        DECODE_SET_16_ADD2 (LDMIA, "11001"),
-        DECODE_SET_16_POP  (POP,   "1011110"),
-        DECODE_SET_16_POP  (PUSH,  "1011010"),
-        DECODE_SET_16_ADD2 (STMIA, "11000"),
-
-        // if-then and hints
-        DECODE_SET_16_IT    (IT,    "....", "...."),
-        DECODE_SET_16_HINT1 (NOP,   "....", "0000"),
-        DECODE_SET_16_HINT2 (YIELD, "0001", "0000"),
-        DECODE_SET_16_HINT2 (WFE,   "0010", "0000"),
-        DECODE_SET_16_HINT2 (WFI,   "0011", "0000"),
-        DECODE_SET_16_HINT2 (SEV,   "0100", "0000"),
-
-        // 16-bit branch instructions
-        DECODE_SET_16_B2 (BL_H10, "10"),
-        DECODE_SET_16_B2 (BL_H11, "11"),
-        DECODE_SET_16_B2 (BL_H01, "01"),
-
-        // terminator
-        {0}
-    };
-
     // create the table
     vmidDecodeTableP   table = vmidNewDecodeTable(16, TT_LAST);
     const decodeEntry *entry;
 
     // add all entries to the decode table
-    for(entry=entries; entry->pattern; entry++) {
+    for(entry=decodeEntriesThumb16; entry->pattern; entry++) {
         vmidNewEntryFmtBin(
             table,
             entry->name,
@@ -2196,37 +2095,12 @@ static vmidDecodeTableP createDecodeTableThumb16(void) {
 //
 static vmidDecodeTableP createDecodeTableThumbEE16(void) {
 
-    const static decodeEntry entries[] = {
-
-        // ThumbEE load and store instructions differing from Thumb instructions
-        DECODE_SET_16_ADD1 (LDR_EE,   "0101100"),
-        DECODE_SET_16_ADD1 (LDRH_EE,  "0101101"),
-        DECODE_SET_16_ADD1 (LDRSH_EE, "0101111"),
-        DECODE_SET_16_ADD1 (STR_EE,   "0101000"),
-        DECODE_SET_16_ADD1 (STRH_EE,  "0101001"),
-
-        // other ThumbEE instructions
-        DECODE_SET_16_THUMBEE (UND_EE, "0001"),
-        DECODE_SET_16_THUMBEE (HBP,    "0000"),
-        DECODE_SET_16_THUMBEE (HB,     "0010"),
-        DECODE_SET_16_THUMBEE (HBL,    "0011"),
-        DECODE_SET_16_THUMBEE (HBLP,   "01.."),
-        DECODE_SET_16_THUMBEE (CHKA,   "1010"),
-        DECODE_SET_16_THUMBEE (LDRF,   "110."),
-        DECODE_SET_16_THUMBEE (LDRLP,  "1011"),
-        DECODE_SET_16_THUMBEE (LDRA,   "100."),
-        DECODE_SET_16_THUMBEE (STRF,   "111."),
-
-        // terminator
-        {0}
-    };
-
     // create the table
     vmidDecodeTableP   table = vmidNewDecodeTable(16, TT_LAST);
     const decodeEntry *entry;
 
     // add all entries to the decode table
-    for(entry=entries; entry->pattern; entry++) {
+    for(entry=decodeEntriesThumbEE16; entry->pattern; entry++) {
         vmidNewEntryFmtBin(
             table,
             entry->name,
@@ -2244,542 +2118,12 @@ static vmidDecodeTableP createDecodeTableThumbEE16(void) {
 //
 static vmidDecodeTableP createDecodeTableThumb32(void) {
 
-    const static decodeEntry entries[] = {
-
-        // data processing
-        DECODE_SET_32_AND (AND, "0000"),
-        DECODE_SET_32_TST (TST, "0000"),
-        DECODE_SET_32_AND (BIC, "0001"),
-        DECODE_SET_32_AND (ORR, "0010"),
-        DECODE_SET_32_MOV (MOV, "0010"),
-        DECODE_SET_32_AND (ORN, "0011"),
-        DECODE_SET_32_MOV (MVN, "0011"),
-        DECODE_SET_32_AND (EOR, "0100"),
-        DECODE_SET_32_TST (TEQ, "0100"),
-        DECODE_SET_32_AND (ADD, "1000"),
-        DECODE_SET_32_TST (CMN, "1000"),
-        DECODE_SET_32_AND (ADC, "1010"),
-        DECODE_SET_32_AND (SBC, "1011"),
-        DECODE_SET_32_AND (SUB, "1101"),
-        DECODE_SET_32_TST (CMP, "1101"),
-        DECODE_SET_32_AND (RSB, "1110"),
-
-        // pack halfword
-        DECODE_SET_32_PKHBT (PKHBT, "0"),
-        DECODE_SET_32_PKHBT (PKHTB, "1"),
-
-        // data processing (plain binary immediate)
-        DECODE_SET_32_ADD_PI (ADD_PI,     "00000"),
-        DECODE_SET_32_ADR_PI (ADD_ADR_PI, "00000"),
-        DECODE_SET_32_ADD_PI (SUB_PI,     "01010"),
-        DECODE_SET_32_ADR_PI (SUB_ADR_PI, "01010"),
-        DECODE_SET_32_ADD_PI (MOV_PI,     "00100"),
-        DECODE_SET_32_ADD_PI (MOVT_PI,    "01100"),
-        DECODE_SET_32_ADD_PI (SSAT,       "100.0"),
-        DECODE_SET_32_SSAT16 (SSAT16,     "10010"),
-        DECODE_SET_32_ADD_PI (SBFX,       "10100"),
-        DECODE_SET_32_ADD_PI (BFI,        "10110"),
-        DECODE_SET_32_BFC    (BFC,        "10110"),
-        DECODE_SET_32_ADD_PI (UBFX,       "11100"),
-        DECODE_SET_32_ADD_PI (USAT,       "110.0"),
-        DECODE_SET_32_SSAT16 (USAT16,     "11010"),
-
-        // data processing (register)
-        DECODE_SET_32_LSL  (LSL,     "000.", "0000", "...."),
-        DECODE_SET_32_LSL  (LSR,     "001.", "0000", "...."),
-        DECODE_SET_32_LSL  (ASR,     "010.", "0000", "...."),
-        DECODE_SET_32_LSL  (ROR,     "011.", "0000", "...."),
-        DECODE_SET_32_LSL  (SXTAH,   "0000", "1...", "...."),
-        DECODE_SET_32_SXTH (SXTH,    "0000", "1...", "1111"),
-        DECODE_SET_32_LSL  (UXTAH,   "0001", "1...", "...."),
-        DECODE_SET_32_SXTH (UXTH,    "0001", "1...", "1111"),
-        DECODE_SET_32_LSL  (SXTAB16, "0010", "1...", "...."),
-        DECODE_SET_32_SXTH (SXTB16,  "0010", "1...", "1111"),
-        DECODE_SET_32_LSL  (UXTAB16, "0011", "1...", "...."),
-        DECODE_SET_32_SXTH (UXTB16,  "0011", "1...", "1111"),
-        DECODE_SET_32_LSL  (SXTAB,   "0100", "1...", "...."),
-        DECODE_SET_32_SXTH (SXTB,    "0100", "1...", "1111"),
-        DECODE_SET_32_LSL  (UXTAB,   "0101", "1...", "...."),
-        DECODE_SET_32_SXTH (UXTB,    "0101", "1...", "1111"),
-
-        // parallel add/subtract instructions
-        DECODE_SET_32_PAS (ADD16, "001"),
-        DECODE_SET_32_PAS (ASX,   "010"),
-        DECODE_SET_32_PAS (SAX,   "110"),
-        DECODE_SET_32_PAS (SUB16, "101"),
-        DECODE_SET_32_PAS (ADD8,  "000"),
-        DECODE_SET_32_PAS (SUB8,  "100"),
-
-        // miscellaneous operation instructions
-        DECODE_SET_32_LSL (QADD,  "1000", "1000", "...."),
-        DECODE_SET_32_LSL (QDADD, "1000", "1001", "...."),
-        DECODE_SET_32_LSL (QSUB,  "1000", "1010", "...."),
-        DECODE_SET_32_LSL (QDSUB, "1000", "1011", "...."),
-        DECODE_SET_32_LSL (REV,   "1001", "1000", "...."),
-        DECODE_SET_32_LSL (REV16, "1001", "1001", "...."),
-        DECODE_SET_32_LSL (RBIT,  "1001", "1010", "...."),
-        DECODE_SET_32_LSL (REVSH, "1001", "1011", "...."),
-        DECODE_SET_32_LSL (SEL,   "1010", "1000", "...."),
-        DECODE_SET_32_LSL (CLZ,   "1011", "1000", "...."),
-
-        // multiply, multiply accumulate and absolute difference instructions
-        DECODE_SET_32_MLA     (MLA,    "0000", "0000"),
-        DECODE_SET_32_MUL     (MUL,    "0000", "0000"),
-        DECODE_SET_32_MLA     (MLS,    "0000", "0001"),
-        DECODE_SET_32_MLA     (SDIV,   "1001", "1111"),
-        DECODE_SET_32_MLA     (UDIV,   "1011", "1111"),
-        DECODE_SET_32_SMLA_XY (SMLA,   "0001", "00"  ),
-        DECODE_SET_32_SMUL_XY (SMUL,   "0001", "00"  ),
-        DECODE_SET_32_SMLAD   (SMLAD,  "0010", "000" ),
-        DECODE_SET_32_SMUAD   (SMUAD,  "0010", "000" ),
-        DECODE_SET_32_SMLAW   (SMLAW,  "0011", "000" ),
-        DECODE_SET_32_SMULW   (SMULW,  "0011", "000" ),
-        DECODE_SET_32_SMLAD   (SMLSD,  "0100", "000" ),
-        DECODE_SET_32_SMUAD   (SMUSD,  "0100", "000" ),
-        DECODE_SET_32_SMMLA   (SMMLA,  "0101", "000" ),
-        DECODE_SET_32_SMMUL   (SMMUL,  "0101", "000" ),
-        DECODE_SET_32_SMMLA   (SMMLS,  "0110", "000" ),
-        DECODE_SET_32_MUL     (USAD8,  "0111", "0000"),
-        DECODE_SET_32_MLA     (USADA8, "0111", "0000"),
-        DECODE_SET_32_MLA     (SMLAL,  "1100", "0000"),
-        DECODE_SET_32_MLA     (SMULL,  "1000", "0000"),
-        DECODE_SET_32_MLA     (UMAAL,  "1110", "0110"),
-        DECODE_SET_32_MLA     (UMLAL,  "1110", "0000"),
-        DECODE_SET_32_MLA     (UMULL,  "1010", "0000"),
-        DECODE_SET_32_SMLA_XY (SMLAL,  "1100", "10"  ),
-        DECODE_SET_32_SMLAD   (SMLALD, "1100", "110" ),
-        DECODE_SET_32_SMLAD   (SMLSLD, "1101", "110" ),
-
-        // branch and miscellaneous control instructions
-        DECODE_SET_32_B1    (B1,         "0.0", "."),
-        DECODE_SET_32_B1    (B2,         "0.1", "."),
-        DECODE_SET_32_B1    (BL,         "1.1", "."),
-        DECODE_SET_32_B1    (BLX,        "1.0", "0"),
-        DECODE_SET_32_MSR   (MSRC_RM,    "0.0", "0111000"),
-        DECODE_SET_32_MSR   (MSRS_RM,    "0.0", "0111001"),
-        DECODE_SET_32_MSR   (CPS,        "0.0", "0111010"),
-        DECODE_SET_32_HINT1 (NOP,        "0.0", "0111010", "........"),
-        DECODE_SET_32_HINT2 (YIELD,      "0.0", "0111010", "00000001"),
-        DECODE_SET_32_HINT2 (WFE,        "0.0", "0111010", "00000010"),
-        DECODE_SET_32_HINT2 (WFI,        "0.0", "0111010", "00000011"),
-        DECODE_SET_32_HINT2 (SEV,        "0.0", "0111010", "00000100"),
-        DECODE_SET_32_HINT2 (DBG,        "0.0", "0111010", "1111...."),
-        DECODE_SET_32_MSR   (BXJ,        "0.0", "0111100"),
-        DECODE_SET_32_MSR   (SUBS_PC_LR, "0.0", "0111101"),
-        DECODE_SET_32_MSR   (MRSC,       "0.0", "0111110"),
-        DECODE_SET_32_MSR   (MRSS,       "0.0", "0111111"),
-        DECODE_SET_32_UNDEF (UNDEF,      "0.0", ".111..."),
-        DECODE_SET_32_CLREX (CLREX,      "0010"),
-
-        // load and store multiple instructions
-        DECODE_SET_32_SRS  (SRSDB, "00", ".0...."),
-        DECODE_SET_32_SRS  (SRSIA, "11", ".0...."),
-        DECODE_SET_32_SRS  (RFEDB, "00", ".1...."),
-        DECODE_SET_32_SRS  (RFEIA, "11", ".1...."),
-        DECODE_SET_32_SRS  (STMDB, "10", ".0...."),
-        DECODE_SET_32_SRS  (STMIA, "01", ".0...."),
-        DECODE_SET_32_SRS  (LDMDB, "10", ".1...."),
-        DECODE_SET_32_SRS  (LDMIA, "01", ".1...."),
-        DECODE_SET_32_POPM (POPM,  "01", "111101"),
-        DECODE_SET_32_POPM (PUSHM, "10", "101101"),
-
-        // dual and exclusive instructions
-        DECODE_SET_32_LDRD_IMM (LDRD_IMM, "0.", "11", "...."),
-        DECODE_SET_32_LDRD_IMM (LDRD_IMM, "1.", ".1", "...."),
-        DECODE_SET_32_LDRD_IMM (STRD_IMM, "0.", "10", "...."),
-        DECODE_SET_32_LDRD_IMM (STRD_IMM, "1.", ".0", "...."),
-        DECODE_SET_32_LDREX    (LDREX,    "00", "01", "...."),
-        DECODE_SET_32_LDREX    (LDREXB,   "01", "01", "0100"),
-        DECODE_SET_32_LDREX    (LDREXH,   "01", "01", "0101"),
-        DECODE_SET_32_LDREX    (LDREXD,   "01", "01", "0111"),
-        DECODE_SET_32_LDREX    (STREX,    "00", "00", "...."),
-        DECODE_SET_32_LDREX    (STREXB,   "01", "00", "0100"),
-        DECODE_SET_32_LDREX    (STREXH,   "01", "00", "0101"),
-        DECODE_SET_32_LDREX    (STREXD,   "01", "00", "0111"),
-        DECODE_SET_32_LDREX    (TBB,      "01", "01", "0000"),
-        DECODE_SET_32_LDREX    (TBH,      "01", "01", "0001"),
-
-        // load instructions
-        DECODE_SET_32_LDR   (LDR,   "0", "10"),
-        DECODE_SET_32_LDR   (LDRH,  "0", "01"),
-        DECODE_SET_32_LDR   (LDRB,  "0", "00"),
-        DECODE_SET_32_LDR   (LDRSH, "1", "01"),
-        DECODE_SET_32_LDR   (LDRSB, "1", "00"),
-        DECODE_SET_32_STR   (STR,   "0", "10"),
-        DECODE_SET_32_STR   (STRH,  "0", "01"),
-        DECODE_SET_32_STR   (STRB,  "0", "00"),
-
-        // memory hint instructions
-        DECODE_SET_32_PLD   (PLD,   "0", "00"),
-        DECODE_SET_32_PLD   (PLDW,  "0", "01"),
-        DECODE_SET_32_PLD   (PLI,   "1", "00"),
-        DECODE_SET_32_CLREX (DSB,   "0100"   ),
-        DECODE_SET_32_CLREX (DMB,   "0101"   ),
-        DECODE_SET_32_CLREX (ISB,   "0110"   ),
-        DECODE_SET_32_UHINT (UHINT, "01"     ),
-        DECODE_SET_32_UHINT (UHINT, "00"     ),
-
-        // coprocessor instructions
-        DECODE_SET_32_CDP   (CDP       ),
-        DECODE_SET_32_CDP2  (CDP2      ),
-        DECODE_SET_32_LDC   (LDC,   "1"),
-        DECODE_SET_32_LDC2  (LDC2,  "1"),
-        DECODE_SET_32_MCR   (MCR,   "0"),
-        DECODE_SET_32_MCR2  (MCR2,  "0"),
-        DECODE_SET_32_MCR   (MRC,   "1"),
-        DECODE_SET_32_MCR2  (MRC2,  "1"),
-        DECODE_SET_32_LDC   (STC,   "0"),
-        DECODE_SET_32_LDC2  (STC2,  "0"),
-        DECODE_SET_32_MCRR  (MCRR,  "0"),
-        DECODE_SET_32_MCRR2 (MCRR2, "0"),
-        DECODE_SET_32_MCRR  (MRRC,  "1"),
-        DECODE_SET_32_MCRR2 (MRRC2, "1"),
-
-        // ThumbEE instructions
-        DECODE_SET_32_ENTERX (ENTERX, "1"),
-        DECODE_SET_32_ENTERX (LEAVEX, "0"),
-
-        ////////////////////////////////////////////////////////////////////////////
-        // SIMD/VFP INSTRUCTIONS
-        ////////////////////////////////////////////////////////////////////////////
-
-        // SIMD data processing instructions - Miscellaneous
-        DECODE_SET_32_VEXT  (VEXT),
-        DECODE_SET_32_VTBL  (VTBL, "0"),
-        DECODE_SET_32_VTBL  (VTBX, "1"),
-        DECODE_SET_32_VDUPZ (VDUPZ),
-
-        // SIMD data processing instructions - 3 regs same length
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VHADDU,  "0000", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VHADDS,  "0000", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VQADDU,  "0000", "1", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VQADDS,  "0000", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VRHADDU, "0001", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VRHADDS, "0001", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD      (VAND,    "0001", "1", "0", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VBIC,    "0001", "1", "0", "01"),
-        DECODE_SET_32_SIMD_RRR_QD      (VORR,    "0001", "1", "0", "10"),
-        DECODE_SET_32_SIMD_RRR_QD      (VORN,    "0001", "1", "0", "11"),
-        DECODE_SET_32_SIMD_RRR_QD      (VEOR,    "0001", "1", "1", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VBSL,    "0001", "1", "1", "01"),
-        DECODE_SET_32_SIMD_RRR_QD      (VBIT,    "0001", "1", "1", "10"),
-        DECODE_SET_32_SIMD_RRR_QD      (VBIF,    "0001", "1", "1", "11"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VHSUBU,  "0010", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VHSUBS,  "0010", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VQSUBU,  "0010", "1", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VQSUBS,  "0010", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VCGTU,   "0011", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VCGTS,   "0011", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VCGEU,   "0011", "1", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VCGES,   "0011", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VSHLU,   "0100", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VSHLS,   "0100", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VQSHLU,  "0100", "1", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VQSHLS,  "0100", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VRSHLU,  "0101", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VRSHLS,  "0101", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VQRSHLU, "0101", "1", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VQRSHLS, "0101", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VMAXU,   "0110", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VMAXS,   "0110", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VMINU,   "0110", "1", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VMINS,   "0110", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VABDU,   "0111", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VABDS,   "0111", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VABAU,   "0111", "1", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VABAS,   "0111", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VADD,    "1000", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHWD (VSUB,    "1000", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VTST,    "1000", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VCEQ,    "1000", "1", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VMLA,    "1001", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VMLS,    "1001", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_BHW  (VMUL,    "1001", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_P    (VMUL_P,  "1001", "1", "1"),
-        DECODE_SET_32_SIMD_RRR_D_BHW   (VPMAXS,  "1010", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_D_BHW   (VPMAXU,  "1010", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_D_BHW   (VPMINS,  "1010", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_D_BHW   (VPMINU,  "1010", "1", "1"),
-        DECODE_SET_32_SIMD_RRR_QD_HW   (VQDMULH, "1011", "0", "0"),
-        DECODE_SET_32_SIMD_RRR_QD_HW   (VQRDMULH,"1011", "0", "1"),
-        DECODE_SET_32_SIMD_RRR_D_BHW   (VPADD,   "1011", "1", "0"),
-        DECODE_SET_32_SIMD_RRR_QD      (VADD_F,  "1101", "0", "0", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VSUB_F,  "1101", "0", "0", "10"),
-        DECODE_SET_32_SIMD_RRR         (VPADD_F, "1101", "0", "1", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VABD_F,  "1101", "0", "1", "10"),
-        DECODE_SET_32_SIMD_RRR_QD      (VMLA_F,  "1101", "1", "0", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VMLS_F,  "1101", "1", "0", "10"),
-        DECODE_SET_32_SIMD_RRR_QD      (VMUL_F,  "1101", "1", "1", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VCEQ_F,  "1110", "0", "0", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VCGE_F,  "1110", "0", "1", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VCGT_F,  "1110", "0", "1", "10"),
-        DECODE_SET_32_SIMD_RRR_QD      (VACGE_F, "1110", "1", "1", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VACGT_F, "1110", "1", "1", "10"),
-        DECODE_SET_32_SIMD_RRR_QD      (VMAX_F,  "1111", "0", "0", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VMIN_F,  "1111", "0", "0", "10"),
-        DECODE_SET_32_SIMD_RRR         (VPMAX_F, "1111", "0", "1", "00"),
-        DECODE_SET_32_SIMD_RRR         (VPMIN_F, "1111", "0", "1", "10"),
-        DECODE_SET_32_SIMD_RRR_QD      (VRECPS,  "1111", "1", "0", "00"),
-        DECODE_SET_32_SIMD_RRR_QD      (VRSQRTS, "1111", "1", "0", "10"),
-
-        // SIMD data processing instructions - 3 regs different lengths
-        DECODE_SET_32_SIMD_L_BHW (VADDLS,  "0000", "0"),
-        DECODE_SET_32_SIMD_L_BHW (VADDLU,  "0000", "1"),
-        DECODE_SET_32_SIMD_W_BHW (VADDWS,  "0001", "0"),
-        DECODE_SET_32_SIMD_W_BHW (VADDWU,  "0001", "1"),
-        DECODE_SET_32_SIMD_L_BHW (VSUBLS,  "0010", "0"),
-        DECODE_SET_32_SIMD_L_BHW (VSUBLU,  "0010", "1"),
-        DECODE_SET_32_SIMD_W_BHW (VSUBWS,  "0011", "0"),
-        DECODE_SET_32_SIMD_W_BHW (VSUBWU,  "0011", "1"),
-        DECODE_SET_32_SIMD_N_HWD (VADDHN,  "0100", "0"),
-        DECODE_SET_32_SIMD_N_HWD (VRADDHN, "0100", "1"),
-        DECODE_SET_32_SIMD_L_BHW (VABALS,  "0101", "0"),
-        DECODE_SET_32_SIMD_L_BHW (VABALU,  "0101", "1"),
-        DECODE_SET_32_SIMD_N_HWD (VSUBHN,  "0110", "0"),
-        DECODE_SET_32_SIMD_N_HWD (VRSUBHN, "0110", "1"),
-        DECODE_SET_32_SIMD_L_BHW (VABDLS,  "0111", "0"),
-        DECODE_SET_32_SIMD_L_BHW (VABDLU,  "0111", "1"),
-        DECODE_SET_32_SIMD_L_BHW (VMLALS,  "1000", "0"),
-        DECODE_SET_32_SIMD_L_BHW (VMLALU,  "1000", "1"),
-        DECODE_SET_32_SIMD_L_BHW (VMLSLS,  "1010", "0"),
-        DECODE_SET_32_SIMD_L_BHW (VMLSLU,  "1010", "1"),
-        DECODE_SET_32_SIMD_L_HW  (VQDMLAL, "1001", "0"),
-        DECODE_SET_32_SIMD_L_HW  (VQDMLSL, "1011", "0"),
-        DECODE_SET_32_SIMD_L_BHW (VMULLS,  "1100", "0"),
-        DECODE_SET_32_SIMD_L_BHW (VMULLU,  "1100", "1"),
-        DECODE_SET_32_SIMD_L_HW  (VQDMULL, "1101", "0"),
-        DECODE_SET_32_SIMD_L_P   (VMULL_P, "1110"),
-
-        // SIMD data processing instructions - 2 regs and a scalar
-        DECODE_SET_32_SIMD_RRZ_QD_HW (VMLAZ,     "0000"),
-        DECODE_SET_32_SIMD_RRZ_QD    (VMLAZ_F,   "0001"),
-        DECODE_SET_32_SIMD_RRZ_QD_HW (VMLSZ,     "0100"),
-        DECODE_SET_32_SIMD_RRZ_QD    (VMLSZ_F,   "0101"),
-        DECODE_SET_32_SIMD_LZ_HW     (VMLALZS,   "0010", "0"),
-        DECODE_SET_32_SIMD_LZ_HW     (VMLALZU,   "0010", "1"),
-        DECODE_SET_32_SIMD_LZ_HW     (VMLSLZS,   "0110", "0"),
-        DECODE_SET_32_SIMD_LZ_HW     (VMLSLZU,   "0110", "1"),
-        DECODE_SET_32_SIMD_LZ_HW     (VQDMLALZ,  "0011", "0"),
-        DECODE_SET_32_SIMD_LZ_HW     (VQDMLSLZ,  "0111", "0"),
-        DECODE_SET_32_SIMD_RRZ_QD_HW (VMULZ,     "1000"),
-        DECODE_SET_32_SIMD_RRZ_QD    (VMULZ_F,   "1001"),
-        DECODE_SET_32_SIMD_LZ_HW     (VMULLZS,   "1010", "0"),
-        DECODE_SET_32_SIMD_LZ_HW     (VMULLZU,   "1010", "1"),
-        DECODE_SET_32_SIMD_LZ_HW     (VQDMULLZ,  "1011", "0"),
-        DECODE_SET_32_SIMD_RRZ_QD_HW (VQDMULHZ,  "1100"),
-        DECODE_SET_32_SIMD_RRZ_QD_HW (VQRDMULHZ, "1101"),
-
-        // SIMD data processing instructions - 2 regs and a shift amount
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VSHRS,    "0000", "0"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VSHRU,    "0000", "1"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VSRAS,    "0001", "0"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VSRAU,    "0001", "1"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VRSHRS,   "0010", "0"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VRSHRU,   "0010", "1"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VRSRAS,   "0011", "0"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VRSRAU,   "0011", "1"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VSRI,     "0100", "1"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VSHL,     "0101", "0"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VSLI,     "0101", "1"),
-        DECODE_SET_32_SIMD_VQSHLUS    (VQSHLUS,  "0110", "1"),    //VQSHLU specifies undefined instruction when U=0
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VQSHLSS,  "0111", "0"),
-        DECODE_SET_32_SIMD_RRI_QD_BHWD(VQSHLSU,  "0111", "1"),
-        DECODE_SET_32_SIMD_NI_HWD     (VSHRN,    "1000", "0", "0"),
-        DECODE_SET_32_SIMD_NI_HWD     (VRSHRN,   "1000", "0", "1"),
-        DECODE_SET_32_SIMD_NI_HWD     (VQSHRUNS, "1000", "1", "0"),
-        DECODE_SET_32_SIMD_NI_HWD     (VQRSHRUNS,"1000", "1", "1"),
-        DECODE_SET_32_SIMD_NI_HWD     (VQSHRNS,  "1001", "0", "0"),
-        DECODE_SET_32_SIMD_NI_HWD     (VQRSHRNS, "1001", "0", "1"),
-        DECODE_SET_32_SIMD_NI_HWD     (VQSHRNU,  "1001", "1", "0"),
-        DECODE_SET_32_SIMD_NI_HWD     (VQRSHRNU, "1001", "1", "1"),
-        DECODE_SET_32_SIMD_LI_BHW     (VSHLLS,   "1010", "0"),
-        DECODE_SET_32_SIMD_LI_BHW     (VSHLLU,   "1010", "1"),
-        DECODE_SET_32_SIMD_VMOVL      (VMOVLS,   "1010", "0"),
-        DECODE_SET_32_SIMD_VMOVL      (VMOVLU,   "1010", "1"),
-        DECODE_SET_32_SIMD_RRI_QD_W   (VCVTFXS,  "1110", "0"),
-        DECODE_SET_32_SIMD_RRI_QD_W   (VCVTFXU,  "1110", "1"),
-        DECODE_SET_32_SIMD_RRI_QD_W   (VCVTXFS,  "1111", "0"),
-        DECODE_SET_32_SIMD_RRI_QD_W   (VCVTXFU,  "1111", "1"),
-
-        // SIMD data processing instructions - Two registers, Miscellaneous
-        //  Note: These use the esize (21:20)='11' space of other instructions and must have priority > 2
-        DECODE_SET_32_SIMD_VREV       (VREV),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VPADDLS,  "00", "0100"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VPADDLU,  "00", "0101"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VCLS,     "00", "1000"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VCLZ,     "00", "1001"),
-        DECODE_SET_32_SIMD_RR_QD_B    (VCNT,     "00", "1010"),
-        DECODE_SET_32_SIMD_RR_QD_B    (VMVN,     "00", "1011"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VPADALS,  "00", "1100"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VPADALU,  "00", "1101"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VQABS,    "00", "1110"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VQNEG,    "00", "1111"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VCGT0,    "01", "0000"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VCGE0,    "01", "0001"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VCEQ0,    "01", "0010"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VCLE0,    "01", "0011"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VCLT0,    "01", "0100"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VABS,     "01", "0110"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VNEG,     "01", "0111"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VCGT0_F,  "01", "1000"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VCGE0_F,  "01", "1001"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VCEQ0_F,  "01", "1010"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VCLE0_F,  "01", "1011"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VCLT0_F,  "01", "1100"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VABS_F,   "01", "1110"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VNEG_F,   "01", "1111"),
-        DECODE_SET_32_SIMD_RR_QD_B    (VSWP,     "10", "0000"),
-        DECODE_SET_32_SIMD_RR_QD_BHW  (VTRN,     "10", "0001"),
-        DECODE_SET_32_SIMD_RR_QBHW_DBH(VUZP,     "10", "0010"),
-        DECODE_SET_32_SIMD_RR_QBHW_DBH(VZIP,     "10", "0011"),
-        DECODE_SET_32_SIMD_N2_HWD     (VMOVN,    "10", "01000"),
-        DECODE_SET_32_SIMD_N2_HWD     (VQMOVUNS, "10", "01001"),
-        DECODE_SET_32_SIMD_N2_HWD     (VQMOVNS,  "10", "01010"),
-        DECODE_SET_32_SIMD_N2_HWD     (VQMOVNU,  "10", "01011"),
-        DECODE_SET_32_SIMD_L2_BHW     (VSHLLM,   "10", "01100"),
-        DECODE_SET_32_SIMD_N2_H       (VCVTHS,   "10", "11000"),
-        DECODE_SET_32_SIMD_L2_H       (VCVTSH,   "10", "11100"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VRECPE,   "11", "1000"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VRECPE_F, "11", "1010"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VRSQRTE,  "11", "1001"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VRSQRTE_F,"11", "1011"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VCVTFS,   "11", "1100"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VCVTFU,   "11", "1101"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VCVTSF,   "11", "1110"),
-        DECODE_SET_32_SIMD_RR_QD_W    (VCVTUF,   "11", "1111"),
-
-        // SIMD data processing instructions - One register and a modified immediate
-        DECODE_SET_32_SIMD_RI_QD (VMOVI_W,   "0",  "0..0"),
-        DECODE_SET_32_SIMD_RI_QD (VORRI_W,   "0",  "0..1"),
-        DECODE_SET_32_SIMD_RI_QD (VMOVI_H,   "0",  "10.0"),
-        DECODE_SET_32_SIMD_RI_QD (VORRI_H,   "0",  "10.1"),
-        DECODE_SET_32_SIMD_RI_QD (VMOVI1_W,  "0",  "110."),
-        DECODE_SET_32_SIMD_RI_QD (VMOVI_B,   "0",  "1110"),
-        DECODE_SET_32_SIMD_RI_QD (VMOVI_F_W, "0",  "1111"),
-        DECODE_SET_32_SIMD_RI_QD (VMVNI_W,   "1",  "0..0"),
-        DECODE_SET_32_SIMD_RI_QD (VBICI_W,   "1",  "0..1"),
-        DECODE_SET_32_SIMD_RI_QD (VMVNI_H,   "1",  "10.0"),
-        DECODE_SET_32_SIMD_RI_QD (VBICI_H,   "1",  "10.1"),
-        DECODE_SET_32_SIMD_RI_QD (VMVNI1_W,  "1",  "110."),
-        DECODE_SET_32_SIMD_RI_QD (VMOVI_D,   "1",  "1110"),
-
-        // VFP data processing instructions - 3 regs
-        DECODE_SET_32_VFP_DS (VMLA_VFP,    "0.00", "....", ".0"),
-        DECODE_SET_32_VFP_DS (VMLS_VFP,    "0.00", "....", ".1"),
-        DECODE_SET_32_VFP_DS (VNMLS_VFP,   "0.01", "....", ".0"),
-        DECODE_SET_32_VFP_DS (VNMLA_VFP,   "0.01", "....", ".1"),
-        DECODE_SET_32_VFP_DS (VMUL_VFP,    "0.10", "....", ".0"),
-        DECODE_SET_32_VFP_DS (VNMUL_VFP,   "0.10", "....", ".1"),
-        DECODE_SET_32_VFP_DS (VADD_VFP,    "0.11", "....", ".0"),
-        DECODE_SET_32_VFP_DS (VSUB_VFP,    "0.11", "....", ".1"),
-        DECODE_SET_32_VFP_DS (VDIV_VFP,    "1.00", "....", ".0"),
-
-        // VFP data processing instructions - Other
-        DECODE_SET_32_VFP_DS (VMOVI_VFP,    "1.11", "....", ".0"),
-        DECODE_SET_32_VFP_DS (VMOVR_VFP,    "1.11", "0000", "01"),
-        DECODE_SET_32_VFP_DS (VABS_VFP,     "1.11", "0000", "11"),
-        DECODE_SET_32_VFP_DS (VNEG_VFP,     "1.11", "0001", "01"),
-        DECODE_SET_32_VFP_DS (VSQRT_VFP,    "1.11", "0001", "11"),
-        DECODE_SET_32_VFP_S  (VCVTBFH_VFP,  "1.11", "0010", "01"),
-        DECODE_SET_32_VFP_S  (VCVTTFH_VFP,  "1.11", "0010", "11"),
-        DECODE_SET_32_VFP_S  (VCVTBHF_VFP,  "1.11", "0011", "01"),
-        DECODE_SET_32_VFP_S  (VCVTTHF_VFP,  "1.11", "0011", "11"),
-        DECODE_SET_32_VFP_DS (VCMP_VFP,     "1.11", "0100", "01"),
-        DECODE_SET_32_VFP_DS (VCMPE_VFP,    "1.11", "0100", "11"),
-        DECODE_SET_32_VFP_DS (VCMP0_VFP,    "1.11", "0101", "01"),
-        DECODE_SET_32_VFP_DS (VCMPE0_VFP,   "1.11", "0101", "11"),
-        DECODE_SET_32_VFP_DS (VCVT_VFP,     "1.11", "0111", "11"),
-        DECODE_SET_32_VFP_DS (VCVTFU_VFP,   "1.11", "1000", "01"),
-        DECODE_SET_32_VFP_DS (VCVTFS_VFP,   "1.11", "1000", "11"),
-        DECODE_SET_32_VFP_DS (VCVTFXSH_VFP, "1.11", "1010", "01"),
-        DECODE_SET_32_VFP_DS (VCVTFXSW_VFP, "1.11", "1010", "11"),
-        DECODE_SET_32_VFP_DS (VCVTFXUH_VFP, "1.11", "1011", "01"),
-        DECODE_SET_32_VFP_DS (VCVTFXUW_VFP, "1.11", "1011", "11"),
-        DECODE_SET_32_VFP_DS (VCVTRUF_VFP,  "1.11", "1100", "01"),
-        DECODE_SET_32_VFP_DS (VCVTUF_VFP,   "1.11", "1100", "11"),
-        DECODE_SET_32_VFP_DS (VCVTRSF_VFP,  "1.11", "1101", "01"),
-        DECODE_SET_32_VFP_DS (VCVTSF_VFP,   "1.11", "1101", "11"),
-        DECODE_SET_32_VFP_DS (VCVTXFSH_VFP, "1.11", "1110", "01"),
-        DECODE_SET_32_VFP_DS (VCVTXFSW_VFP, "1.11", "1110", "11"),
-        DECODE_SET_32_VFP_DS (VCVTXFUH_VFP, "1.11", "1111", "01"),
-        DECODE_SET_32_VFP_DS (VCVTXFUW_VFP, "1.11", "1111", "11"),
-
-        // Extension register load/store instructions
-        DECODE_SET_32_SDFP_LDST     (VSTMIA,  "01.00"),
-        DECODE_SET_32_SDFP_LDST     (VSTMIAW, "01.10"),
-        DECODE_SET_32_SDFP_LDST     (VSTR,    "1..00"),
-        DECODE_SET_32_SDFP_LDST     (VSTMDBW, "10.10"),
-        DECODE_SET_32_SDFP_PUSH_POP (VPUSH,   "10.10"),
-        DECODE_SET_32_SDFP_LDST     (VLDMIA,  "01.01"),
-        DECODE_SET_32_SDFP_LDST     (VLDMIAW, "01.11"),
-        DECODE_SET_32_SDFP_PUSH_POP (VPOP,    "01.11"),
-        DECODE_SET_32_SDFP_LDST     (VLDR,    "1..01"),
-        DECODE_SET_32_SDFP_LDST     (VLDMDBW, "10.11"),
-
-        // SIMD element or structure load/store instructions
-        DECODE_SET_32_SIMD_LDSTN_BHWD      (VSTN1_R4,   "0", "0", "0010"),
-        DECODE_SET_32_SIMD_LDSTN_BHWD_A01  (VSTN1_R3,   "0", "0", "0110"),
-        DECODE_SET_32_SIMD_LDSTN_BHWD_A012 (VSTN1_R2,   "0", "0", "1010"),
-        DECODE_SET_32_SIMD_LDSTN_BHWD_A01  (VSTN1_R1,   "0", "0", "0111"),
-        DECODE_SET_32_SIMD_LDSTN_BHW       (VSTN2_R2I2, "0", "0", "0011"),
-        DECODE_SET_32_SIMD_LDSTN_BHW_A012  (VSTN2_R1I2, "0", "0", "1001"),
-        DECODE_SET_32_SIMD_LDSTN_BHW_A012  (VSTN2_R1I1, "0", "0", "1000"),
-        DECODE_SET_32_SIMD_LDSTN_BHW_A01   (VSTN3_R3I1, "0", "0", "0100"),
-        DECODE_SET_32_SIMD_LDSTN_BHW_A01   (VSTN3_R3I2, "0", "0", "0101"),
-        DECODE_SET_32_SIMD_LDSTN_BHW       (VSTN4_R4I1, "0", "0", "0000"),
-        DECODE_SET_32_SIMD_LDSTN_BHW       (VSTN4_R4I2, "0", "0", "0001"),
-
-        DECODE_SET_32_SIMD_LDSTN_BHWD      (VLDN1_R4,   "0", "1", "0010"),
-        DECODE_SET_32_SIMD_LDSTN_BHWD_A01  (VLDN1_R3,   "0", "1", "0110"),
-        DECODE_SET_32_SIMD_LDSTN_BHWD_A012 (VLDN1_R2,   "0", "1", "1010"),
-        DECODE_SET_32_SIMD_LDSTN_BHWD_A01  (VLDN1_R1,   "0", "1", "0111"),
-        DECODE_SET_32_SIMD_LDSTN_BHW       (VLDN2_R2I2, "0", "1", "0011"),
-        DECODE_SET_32_SIMD_LDSTN_BHW_A012  (VLDN2_R1I2, "0", "1", "1001"),
-        DECODE_SET_32_SIMD_LDSTN_BHW_A012  (VLDN2_R1I1, "0", "1", "1000"),
-        DECODE_SET_32_SIMD_LDSTN_BHW_A01   (VLDN3_R3I1, "0", "1", "0100"),
-        DECODE_SET_32_SIMD_LDSTN_BHW_A01   (VLDN3_R3I2, "0", "1", "0101"),
-        DECODE_SET_32_SIMD_LDSTN_BHW       (VLDN4_R4I1, "0", "1", "0000"),
-        DECODE_SET_32_SIMD_LDSTN_BHW       (VLDN4_R4I2, "0", "1", "0001"),
-
-        DECODE_SET_32_SIMD_LDST1Z1_BHW     (VST1Z1,    "1", "0", "00"),
-        DECODE_SET_32_SIMD_LDST2Z1_BHW     (VST2Z1,    "1", "0", "01"),
-        DECODE_SET_32_SIMD_LDST3Z1_BHW     (VST3Z1,    "1", "0", "10"),
-        DECODE_SET_32_SIMD_LDST4Z1_BHW     (VST4Z1,    "1", "0", "11"),
-
-        DECODE_SET_32_SIMD_LDST1Z1_BHW     (VLD1Z1,    "1", "1", "00"),
-        DECODE_SET_32_SIMD_LD1ZA_BHW       (VLD1ZA,    "1", "1", "00"),
-        DECODE_SET_32_SIMD_LDST2Z1_BHW     (VLD2Z1,    "1", "1", "01"),
-        DECODE_SET_32_SIMD_LD2ZA_BHW       (VLD2ZA,    "1", "1", "01"),
-        DECODE_SET_32_SIMD_LDST3Z1_BHW     (VLD3Z1,    "1", "1", "10"),
-        DECODE_SET_32_SIMD_LD3ZA_BHW       (VLD3ZA,    "1", "1", "10"),
-        DECODE_SET_32_SIMD_LDST4Z1_BHW     (VLD4Z1,    "1", "1", "11"),
-        DECODE_SET_32_SIMD_LD4ZA_BHW       (VLD4ZA,    "1", "1", "11"),
-
-        // 8, 16 and 32-bit transfer instructions between ARM core regs and extension regs
-        DECODE_SET_32_VMRS   (VMRS,   "1", "0", "111", ".."),
-        DECODE_SET_32_VMRS   (VMSR,   "0", "0", "111", ".."),
-        DECODE_SET_32_VMRS   (VMOVRS, "1", "0", "000", ".."),
-        DECODE_SET_32_VMRS   (VMOVSR, "0", "0", "000", ".."),
-        DECODE_SET_32_VMOVZR (VMOVZR),
-        DECODE_SET_32_VMOVRZ (VMOVRZ),
-        DECODE_SET_32_VDUPR  (VDUPR),
-
-        // 64-bit transfer instructions between ARM core regs and extension regs
-        DECODE_SET_32_VMOVRRD (VMOVRRD,  "1", "1", "00.1"),
-        DECODE_SET_32_VMOVRRD (VMOVDRR,  "0", "1", "00.1"),
-        DECODE_SET_32_VMOVRRD (VMOVRRSS, "1", "0", "00.1"),
-        DECODE_SET_32_VMOVRRD (VMOVSSRR, "0", "0", "00.1"),
-
-        // terminator
-        {0}
-    };
-
     // create the table
     vmidDecodeTableP   table = vmidNewDecodeTable(32, TT_LAST);
     const decodeEntry *entry;
 
     // add all entries to the decode table
-    for(entry=entries; entry->pattern; entry++) {
+    for(entry=decodeEntriesThumb32; entry->pattern; entry++) {
         vmidNewEntryFmtBin(
             table,
             entry->name,
@@ -2834,6 +2178,87 @@ static vmidDecodeTableP getDecodeTableThumb32(void) {
     return table;
 }
 
+#ifdef ARM_STATIC_DECODE
+
+//
+// Check a static decode against the decode table, if checkDecode is set
+//
+static armThumbType checkStaticDecode(
+    armP             arm,
+    vmidDecodeTableP table,
+    const char      *set,
+    Uns32            instr,
+    armThumbType     type
+) {
+    if(arm->checkDecode) {
+
+        armThumbType tableType = vmidDecode(table, instr);
+
+        if(type!=tableType) {
+            vmiMessage("E", CPU_PREFIX"_SDM",
+                "static decoder gives type %u for %s instruction 0x%08x, "
+                "decode table gives %u",
+                type, set, instr, tableType
+            );
+        }
+    }
+
+    return type;
+}
+
+#endif
+
+//
+// Decode a 16-bit Thumb instruction
+//
+static armThumbType decodeThumb16(armP arm, Uns32 instr) {
+
+#ifdef ARM_STATIC_DECODE
+    if(arm->staticDecode) {
+        return checkStaticDecode(
+            arm, arm->checkDecode ? getDecodeTableThumb16() : 0, "Thumb16", instr,
+            armDecodeStatic(decodeNodesThumb16, decodePatternsThumb16, instr, TT_LAST)
+        );
+    }
+#endif
+
+    return vmidDecode(getDecodeTableThumb16(), instr);
+}
+
+//
+// Decode a 16-bit ThumbEE instruction
+//
+static armThumbType decodeThumbEE16(armP arm, Uns32 instr) {
+
+#ifdef ARM_STATIC_DECODE
+    if(arm->staticDecode) {
+        return checkStaticDecode(
+            arm, arm->checkDecode ? getDecodeTableThumbEE16() : 0, "ThumbEE16", instr,
+            armDecodeStatic(decodeNodesThumbEE16, decodePatternsThumbEE16, instr, TT_LAST)
+        );
+    }
+#endif
+
+    return vmidDecode(getDecodeTableThumbEE16(), instr);
+}
+
+//
+// Decode a 32-bit Thumb instruction
+//
+static armThumbType decodeThumb32(armP arm, Uns32 instr) {
+
+#ifdef ARM_STATIC_DECODE
+    if(arm->staticDecode) {
+        return checkStaticDecode(
+            arm, arm->checkDecode ? getDecodeTableThumb32() : 0, "Thumb32", instr,
+            armDecodeStatic(decodeNodesThumb32, decodePatternsThumb32, instr, TT_LAST)
+        );
+    }
+#endif
+
+    return vmidDecode(getDecodeTableThumb32(), instr);
+}
+
 //
 // Return effect that the instruction has on the flags (note that this may
 // depend on whether the instruction is in an if-then block)
@@ -4096,19 +3521,19 @@ void armDecodeThumb(armP arm, Uns32 thisPC, armInstructionInfoP info, Bool EE) {
 
         // if in ThumbEE mode, initially try ThumbEE16 table
         if(EE) {
-            type = vmidDecode(getDecodeTableThumbEE16(), instr);
+            type = decodeThumbEE16(arm, instr);
         }
 
         // decode using Thumb16 table if not a ThumbEE instruction
         if(type==TT_LAST) {
-            type = vmidDecode(getDecodeTableThumb16(), instr);
+            type = decodeThumb16(arm, instr);
         }
 
     } else {
 
         // decode using Thumb32 table
         instr = (instr<<16) | vmicxtFetch2Byte(processor, thisPC+2);
-        type  = vmidDecode(getDecodeTableThumb32(), instr);
+        type  = decodeThumb32(arm, instr);
     }
 
     // save instruction
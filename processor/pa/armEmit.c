@@ -1310,22 +1310,23 @@ void armEmitValidateBlockMask(armBlockMask blockMask) {
     vmimtValidateBlockMask(blockMask);
 }
 
-void armEmitBrArch(void) {
+void armEmitBrArch(armP arm) {
+
+    // Each core signals through its own mailbox. Code dictionaries may be
+    // shared between the cores of an MPCore, so the mailbox address is read
+    // from the executing core at run time rather than baked into the code
+    vmimtMoveRR(32, ARM_REG(3), ARM_MURAC_MAILBOX);
 
     // Write the PC value to shared memory
     vmimtMoveRSimPC(32, ARM_REG(2));
     vmimtBinopRC(32, vmi_ADD, ARM_REG(2), 4, 0);
-
-    vmimtMoveRC(32, ARM_REG(3), MURAC_PC_ADDRESS);
     vmimtStoreRRO(32, 0, ARM_REG(3), ARM_REG(2), MEM_ENDIAN_LITTLE, True);
 
     // Write the AA instruction block size to shared memory
-    vmimtMoveRC(32, ARM_REG(3), MURAC_PC_ADDRESS + 4);
-    vmimtStoreRRO(32, 0, ARM_REG(3), ARM_REG(1), MEM_ENDIAN_LITTLE, True);
+    vmimtStoreRRO(32, 4, ARM_REG(3), ARM_REG(1), MEM_ENDIAN_LITTLE, True);
 
     // Write the stack poitner passed to AA to shared memory
-    vmimtMoveRC(32, ARM_REG(3), MURAC_PC_ADDRESS + 8);
-    vmimtStoreRRO(32, 0, ARM_REG(3), ARM_REG(0), MEM_ENDIAN_LITTLE, True);
+    vmimtStoreRRO(32, 8, ARM_REG(3), ARM_REG(0), MEM_ENDIAN_LITTLE, True);
 
     // Halt the processor
     vmimtMoveRC(8, ARM_DISABLE, AD_WFI);
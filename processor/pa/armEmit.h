@@ -614,6 +614,6 @@ void armEmitValidateBlockMask(armBlockMask blockMask);
 //
 // Emit code to signal MURAC BrArch 
 //
-void armEmitBrArch(void);
+void armEmitBrArch(armP arm);
 
 #endif
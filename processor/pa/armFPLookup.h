@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2005-2011 Imperas Software Ltd., www.imperas.com
+ *
+ * YOUR ACCESS TO THE INFORMATION IN THIS MODEL IS CONDITIONAL
+ * UPON YOUR ACCEPTANCE THAT YOU WILL NOT USE OR PERMIT OTHERS
+ * TO USE THE INFORMATION FOR THE PURPOSES OF DETERMINING WHETHER
+ * IMPLEMENTATIONS OF THE ARM ARCHITECTURE INFRINGE ANY THIRD
+ * PARTY PATENTS.
+ *
+ * THE LICENSE BELOW EXTENDS ONLY TO USE OF THE SOFTWARE FOR
+ * MODELING PURPOSES AND SHALL NOT BE CONSTRUED AS GRANTING
+ * A LICENSE TO CREATE A HARDWARE IMPLEMENTATION OF THE
+ * FUNCTIONALITY OF THE SOFTWARE LICENSED HEREUNDER.
+ * YOU MAY USE THE SOFTWARE SUBJECT TO THE LICENSE TERMS BELOW
+ * PROVIDED THAT YOU ENSURE THAT THIS NOTICE IS REPLICATED UNMODIFIED
+ * AND IN ITS ENTIRETY IN ALL DISTRIBUTIONS OF THE SOFTWARE,
+ * MODIFIED OR UNMODIFIED, IN SOURCE CODE OR IN BINARY FORM.
+ *
+ * Licensed under an Imperas Modfied Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.ovpworld.org/licenses/OVP_MODIFIED_1.0_APACHE_OPEN_SOURCE_LICENSE_2.0.pdf
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied.
+ *
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef ARM_FP_LOOKUP_H
+#define ARM_FP_LOOKUP_H
+
+// model header files
+#include "armFPConstants.h"
+
+//
+// The reciprocal and reciprocal square root estimates and the half to single
+// precision conversion use tables generated at build time by
+// processor/gen/armFPTableGen from the estimate pseudo code of the ARM
+// Architecture Reference Manual (armFPTables.h). These macros define how the
+// tables are indexed and how an entry forms a result; the generator checks
+// them against the pseudo code for every input before writing the tables.
+//
+
+//
+// Estimate tables have 256 entries. An entry holds the 8-bit fraction of an
+// estimate in [1.0, 2.0)
+//
+#define ARM_ESTIMATE_TABLE_SIZE         256
+
+// fraction of a single-precision result from an estimate table entry
+#define ARM_ESTIMATE_FP32_FRACTION(_E)  ((Uns32)(_E) << 15)
+
+// unsigned fixed-point result from an estimate table entry
+#define ARM_ESTIMATE_U32(_E)            (0x80000000 | ((Uns32)(_E) << 23))
+
+//
+// Reciprocal estimate index: the top 8 fraction bits of an operand scaled
+// into [0.5, 1.0)
+//
+#define ARM_RECIP_INDEX_FP32(_F)        (ARM_FP32_FRACTION(_F) >> 15)
+#define ARM_RECIP_INDEX_U32(_U)         (((_U) >> 23) & 0xff)
+
+//
+// Reciprocal square root estimate index: bit 7 is set for an operand scaled
+// into [0.5, 1.0) and clear for one scaled into [0.25, 0.5), bits 6:0 are
+// the top 7 fraction bits of the scaled operand
+//
+#define ARM_RSQRT_INDEX_FP32(_F) ( \
+    ((ARM_FP32_EXPONENT(_F) & 1) ? 0 : 0x80) | \
+    ((ARM_FP32_FRACTION(_F) >> 16) & 0x7f)      \
+)
+#define ARM_RSQRT_INDEX_U32(_U) ( \
+    ((_U) & 0x80000000)                 \
+        ? (0x80 | (((_U) >> 24) & 0x7f)) \
+        : (((_U) >> 23) & 0x7f)          \
+)
+
+//
+// The half to single precision table is indexed by the half-precision value
+// without its sign. Exponent 0x1f is converted as a normal number, as in the
+// alternative half-precision format; IEEE infinities and NaNs are handled
+// before the table is used.
+//
+#define ARM_HALF_TABLE_SIZE             0x8000
+#define ARM_HALF_INDEX(_H)              ((_H) & 0x7fff)
+
+#endif
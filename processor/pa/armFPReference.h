@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2005-2011 Imperas Software Ltd., www.imperas.com
+ *
+ * YOUR ACCESS TO THE INFORMATION IN THIS MODEL IS CONDITIONAL
+ * UPON YOUR ACCEPTANCE THAT YOU WILL NOT USE OR PERMIT OTHERS
+ * TO USE THE INFORMATION FOR THE PURPOSES OF DETERMINING WHETHER
+ * IMPLEMENTATIONS OF THE ARM ARCHITECTURE INFRINGE ANY THIRD
+ * PARTY PATENTS.
+ *
+ * THE LICENSE BELOW EXTENDS ONLY TO USE OF THE SOFTWARE FOR
+ * MODELING PURPOSES AND SHALL NOT BE CONSTRUED AS GRANTING
+ * A LICENSE TO CREATE A HARDWARE IMPLEMENTATION OF THE
+ * FUNCTIONALITY OF THE SOFTWARE LICENSED HEREUNDER.
+ * YOU MAY USE THE SOFTWARE SUBJECT TO THE LICENSE TERMS BELOW
+ * PROVIDED THAT YOU ENSURE THAT THIS NOTICE IS REPLICATED UNMODIFIED
+ * AND IN ITS ENTIRETY IN ALL DISTRIBUTIONS OF THE SOFTWARE,
+ * MODIFIED OR UNMODIFIED, IN SOURCE CODE OR IN BINARY FORM.
+ *
+ * Licensed under an Imperas Modfied Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.ovpworld.org/licenses/OVP_MODIFIED_1.0_APACHE_OPEN_SOURCE_LICENSE_2.0.pdf
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied.
+ *
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#ifndef ARM_FP_REFERENCE_H
+#define ARM_FP_REFERENCE_H
+
+#include <math.h>
+
+// basic number types
+#include "hostapi/impTypes.h"
+
+// model header files
+#include "armFPConstants.h"
+
+//
+// Per-element implementations of the reciprocal and reciprocal square root
+// estimates and of half to single precision conversion, as used by the model
+// before they were replaced by the tables of armFPTables.h. They are kept
+// here, for the operands the tables cover, as the reference that
+// processor/gen/armFPTableGen checks the table lookups against.
+//
+
+//
+// This is from recip_estimate Psuedo code in ARM Architecture Reference Manual
+//
+static double armRefRecipEstimate(Flt64 a) {
+
+    Int32 q, s;
+    Flt64 r;
+
+    q = (Int32)(a * 512.0);
+    r = 1.0 / (((Flt64) q + 0.5) / 512.0);
+    s = (Int32)(256.0 * r + 0.5);
+
+    return ((Flt64) s / 256.0);
+}
+
+//
+// This is from recip_sqrt_estimate Psuedo code in ARM Architecture Reference
+// Manual
+//
+static double armRefRecipSqrtEstimate(Flt64 a) {
+
+    Int32 q0, q1, s;
+    Flt64 r;
+
+    if (a < 0.5) {
+        q0 = (Int32)(a * 512.0);
+        r  = 1.0 / sqrt(((Flt64)q0 + 0.5) / 512.0);
+    } else {
+        q1 = (Int32)(a * 256.0);
+        r  = 1.0 / sqrt(((Flt64)q1 + 0.5) / 256.0);
+    }
+    s = (Int32)(256.0 * r + 0.5);
+    return (Flt64)s / 256.0;
+}
+
+//
+// armFPRecipEstimate for a normal operand with exponent below 253
+//
+static Uns32 armRefFPRecipEstimate(Uns32 op) {
+
+    Bool  sign     = ARM_FP32_SIGN(op);
+    Uns32 exponent = ARM_FP32_EXPONENT(op);
+    Uns32 fraction;
+    Uns32 result;
+
+    // See FPRecipEstimate Psuedo code in Arm Architecture manual for details
+    Uns64 frac64    = op & 0x007fffff;
+    Uns32 resultExp = 253 - exponent;
+    union {Uns64 u; Flt64 f;} scaled, estimate;
+
+    scaled.u = (0x3feULL << 52) | (frac64 << 29);
+
+    estimate.f = armRefRecipEstimate(scaled.f);
+    fraction   = (estimate.u >> 29) & 0x007fffff;
+    result     = resultExp << 23 | fraction;
+
+    // Reference simulator version: sign bit from op
+    if (sign) result |= (1 << 31);
+
+    return result;
+}
+
+//
+// armFPUnsignedRecipEstimate for an operand with bit 31 set
+//
+static Uns32 armRefFPUnsignedRecipEstimate(Uns32 op) {
+
+    Uns64 fraction  = op & 0x7fffffff;
+    union {Uns64 u; Flt64 f;} scaled, estimate;
+
+    scaled.u   = (0x3feULL << 52) | (fraction << 21);
+    estimate.f = armRefRecipEstimate(scaled.f);
+    fraction   = (estimate.u >> 21);
+
+    return fraction | 0x80000000;
+}
+
+//
+// armFPRSqrtEstimate for a positive normal operand
+//
+static Uns32 armRefFPRSqrtEstimate(Uns32 op) {
+
+    Bool  sign     = ARM_FP32_SIGN(op);
+    Uns32 exponent = ARM_FP32_EXPONENT(op);
+    Uns32 fraction = ARM_FP32_FRACTION(op);
+    Uns32 result;
+
+    // See FPSqrtEstimate Psuedo code in Arm Architecture manual for details
+    Uns64 frac64    = fraction;
+    Uns32 resultExp = (380 - exponent) / 2;
+
+    union {Uns64 u; Flt64 f;} scaled, estimate;
+
+    if (exponent & 0x01) {
+        scaled.u = (0x3fdULL << 52) | (frac64 << 29);
+    } else {
+        scaled.u = (0x3feULL << 52) | (frac64 << 29);
+    }
+
+    // Set sign bit in scaled if set in op
+    if (sign) scaled.u |= (1ULL << 63);
+
+    estimate.f = armRefRecipSqrtEstimate(scaled.f);
+    fraction   = (estimate.u >> 29) & 0x007fffff;
+    result     = resultExp << 23 | fraction;
+
+    // Set sign bit if estimate sign bit is set
+    if (estimate.u & (1ULL << 63)) result |= (1 << 31);
+
+    return result;
+}
+
+//
+// armFPUnsignedRsqrtEstimate for an operand with bit 31 or bit 30 set
+//
+static Uns32 armRefFPUnsignedRsqrtEstimate(Uns32 op) {
+
+    Uns64 fraction;
+    union {Uns64 u; double f;} scaled, estimate;
+
+    if (op & 0x80000000) {
+        // operand<31:30> = 11 or 10
+        fraction = op & 0x7fffffff;
+        scaled.u = (0x3feULL << 52) | (fraction << 21);
+    } else {
+        // operand<31:30> = 01
+        fraction = op & 0x3fffffff;
+        scaled.u = (0x3fdULL << 52) | (fraction << 22);
+    }
+
+    estimate.f = armRefRecipSqrtEstimate(scaled.f);
+    fraction   = (estimate.u >> 21);
+
+    return fraction | 0x80000000;
+}
+
+//
+// armFPHalfToSingle for a zero or number without sign, including an
+// alternative half-precision number with exponent 0x1f
+//
+static Uns32 armRefFPHalfToSingle(Uns16 half) {
+
+    Int32 exponent   = ARM_FP16_EXPONENT(half);
+    Uns32 fraction   = ARM_FP16_FRACTION(half);
+    Bool  isZero     = (!exponent && !fraction);
+
+    if(isZero) {
+
+        // zero values require no special processing
+
+    } else {
+
+        // normalize a denormal value if required
+        if(!exponent) {
+
+            // shift up until implicit MSB is 1
+            do {
+                fraction <<= 1;
+                exponent--;
+            } while(!(fraction & (1<<ARM_FP16_EXP_SHIFT)));
+
+            // correct exponent and mask off implicit MSB
+            exponent++;
+            fraction &= ~(1<<ARM_FP16_EXP_SHIFT);
+        }
+
+        // rebase exponent and fraction
+        exponent +=  (ARM_FP32_EXP_BIAS  - ARM_FP16_EXP_BIAS );
+        fraction <<= (ARM_FP32_EXP_SHIFT - ARM_FP16_EXP_SHIFT);
+    }
+
+    return (exponent << ARM_FP32_EXP_SHIFT) | fraction;
+}
+
+#endif
@@ -180,7 +180,7 @@ typedef struct armLTimerS {
     Bool           reset;       // is reset active?
     // simulation artifacts
     const char    *name;        // timer name
-    vmiModelTimerP vmiTimer;    // equivalent VMI timer
+    Uns64          due;         // instruction count at next expiry
     Uns32          partial;     // instruction count through current cycle
     Uns32          scale;       // scale factor
     Uns32          intMask;     // mask to use when timer generates interrupt
@@ -212,7 +212,7 @@ typedef struct armGTimerS {
     Uns32          autoinc;     // auto-increment register
     Bool           event;       // interrupt status event
     // simulation artifacts
-    vmiModelTimerP vmiTimer;    // equivalent VMI timer
+    Uns64          due;         // instruction count at next expiry
     Uns32          partial;     // instruction count through current cycle
     Uns32          intMask;     // mask to use when timer generates interrupt
     Uns64          base;        // instruction count when timer explicitly set
@@ -273,6 +273,9 @@ typedef struct armMPLocalsS {
     // timers
     armLTimer  localTimers[LT_LAST];            // local timers
     armGTimer  globalTimer;                     // global timer (local section)
+    vmiModelTimerP vmiTimer;                    // VMI timer for next expiry
+    Uns64      timerDue;                        // instruction count of vmiTimer
+    Bool       inTimerEvent;                    // are expiries being handled?
 } armMPLocals;
 
 
@@ -1871,30 +1874,77 @@ void armMPRefreshBypass(armP arm) {
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+// TIMER SCHEDULING
+////////////////////////////////////////////////////////////////////////////////
+
+//
+// Value of the due field of a timer with no expiry scheduled
+//
+#define NO_TIMER_EVENT ((Uns64)-1)
+
+//
+// Return the instruction count delta instructions from now, or NO_TIMER_EVENT
+// if that is beyond the range of the instruction count
+//
+inline static Uns64 getDue(armP arm, Uns64 delta) {
+
+    Uns64 due = getThisICount(arm) + delta;
+
+    return (due<delta) ? NO_TIMER_EVENT : due;
+}
+
+//
+// Set the single VMI timer of a processor for the earliest expiry of its
+// private, watchdog and global timers. Timer counters are derived when read,
+// so there are no callbacks between expiries.
+//
+static void refreshTimerEvent(armP arm) {
+
+    armMPLocalsP  mpLocals = arm->mpLocals;
+    Uns64         due      = getGT(arm)->due;
+    armLTimerType type;
+
+    // expiries being handled are rescheduled together when all are done
+    if(mpLocals->inTimerEvent) {
+        return;
+    }
+
+    for(type=0; type<LT_LAST; type++) {
+        if(getLT(arm, type)->due<due) {
+            due = getLT(arm, type)->due;
+        }
+    }
+
+    // VMI timer is only updated if the earliest expiry has changed
+    if(due==mpLocals->timerDue) {
+        // no action
+    } else if(due==NO_TIMER_EVENT) {
+        vmirtClearModelTimer(mpLocals->vmiTimer);
+    } else {
+        Uns64 thisICount = getThisICount(arm);
+        vmirtSetModelTimer(mpLocals->vmiTimer, (due>thisICount) ? due-thisICount : 1);
+    }
+
+    mpLocals->timerDue = due;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 // LOCAL TIMERS
 ////////////////////////////////////////////////////////////////////////////////
 
 //
-// Create a local timer object
+// Initialize a local timer object
 //
 static void newLT(
-    armP        arm,
     armLTimerP  timer,
     const char *name,
-    Uns32       intMask,
-    vmiICountFn icountCB
+    Uns32       intMask
 ) {
-    timer->name     = name;
-    timer->intMask  = intMask;
-    timer->vmiTimer = vmirtCreateModelTimer((vmiProcessorP)arm, icountCB, timer);
-}
-
-//
-// Free a local timer object
-//
-static void freeLT(armLTimerP timer) {
-    vmirtDeleteModelTimer(timer->vmiTimer);
+    timer->name    = name;
+    timer->intMask = intMask;
+    timer->due     = NO_TIMER_EVENT;
 }
 
 //
@@ -1952,6 +2002,20 @@ static Uns64 instructionsToWrapLT(armP arm, armLTimerP timer) {
     return (counter64*timer->scale) + remainder;
 }
 
+//
+// Is expiry of the local timer invisible? This is so for an auto-reloading
+// timer with its interrupt status already set: the counter is derived when
+// read, so the next expiry need not be scheduled until the status is cleared
+//
+static Bool isSilentLT(armLTimerP timer) {
+    return (
+        timer->event              &&
+        !timer->control.WDMode    &&
+        timer->control.AutoReload &&
+        timer->load
+    );
+}
+
 //
 // Schedule a local timer interrupt
 //
@@ -1960,35 +2024,56 @@ static void scheduleIntLT(armP arm, armLTimerP timer, const char *reason) {
     // sanity check timer is running
     VMI_ASSERT(timer->running, "%s timer not running", timer->name);
 
-    Int64 delta = instructionsToWrapLT(arm, timer);
+    if(isSilentLT(timer)) {
 
-    // delta for timeout should be on transition *to* zero, so reduce it by
-    // one decrement of the timer
-    delta -= timer->scale;
+        // derive the counter from the current base when read
+        timer->due = NO_TIMER_EVENT;
+
+    } else {
 
-    // handle the case where the counter is currently zero - in this case,
-    // the interrupt should not occur for another full cycle
-    if(delta<=0) {
-        delta += timer->period;
+        Int64 delta = instructionsToWrapLT(arm, timer);
+
+        // delta for timeout should be on transition *to* zero, so reduce it by
+        // one decrement of the timer
+        delta -= timer->scale;
+
+        // handle the case where the counter is currently zero - in this case,
+        // the interrupt should not occur for another full cycle
+        if(delta<=0) {
+            delta += timer->period;
+        }
+
+        timer->due = getDue(arm, delta);
     }
 
     // set VMI timer
-    vmirtSetModelTimer(timer->vmiTimer, delta);
+    refreshTimerEvent(arm);
 
     // emit debug output if required
     if(ARM_DEBUG_MP(arm)) {
 
         Uns64 thisICount = getThisICount(arm);
 
-        vmiMessage("I", CPU_PREFIX"_STI",
-            NO_SRCREF_FMT
-            "%s - icount="FMT_64u" schedule %s timer interrupt at "FMT_64u,
-            NO_SRCREF_ARGS(arm),
-            reason,
-            thisICount,
-            timer->name,
-            thisICount + delta
-        );
+        if(timer->due==NO_TIMER_EVENT) {
+            vmiMessage("I", CPU_PREFIX"_STI",
+                NO_SRCREF_FMT
+                "%s - icount="FMT_64u" %s timer interrupt pending, no expiry scheduled",
+                NO_SRCREF_ARGS(arm),
+                reason,
+                thisICount,
+                timer->name
+            );
+        } else {
+            vmiMessage("I", CPU_PREFIX"_STI",
+                NO_SRCREF_FMT
+                "%s - icount="FMT_64u" schedule %s timer interrupt at "FMT_64u,
+                NO_SRCREF_ARGS(arm),
+                reason,
+                thisICount,
+                timer->name,
+                timer->due
+            );
+        }
     }
 }
 
@@ -2001,7 +2086,8 @@ static void clearIntLT(armP arm, armLTimerP timer, const char *reason) {
     VMI_ASSERT(!timer->running, "%s timer running", timer->name);
 
     // clear VMI timer
-    vmirtClearModelTimer(timer->vmiTimer);
+    timer->due = NO_TIMER_EVENT;
+    refreshTimerEvent(arm);
 
     // emit debug output if required
     if(ARM_DEBUG_MP(arm)) {
@@ -2045,12 +2131,9 @@ static Bool isRunningLT(armLTimerP timer) {
 }
 
 //
-// This is called when a local timer has expired
+// Handle expiry of a local timer
 //
-static VMI_ICOUNT_FN(expiredLT) {
-
-    armP       arm      = (armP)processor;
-    armLTimerP armTimer = userData;
+static void expireLT(armP arm, armLTimerP armTimer) {
 
     // emit debug output if required
     if(ARM_DEBUG_MP(arm)) {
@@ -2070,8 +2153,7 @@ static VMI_ICOUNT_FN(expiredLT) {
     ) {
         armTimer->running = False;
         armTimer->counter = 0;
-    } else {
-        scheduleIntLT(arm, armTimer, "Timer expiry");
+        armTimer->due     = NO_TIMER_EVENT;
     }
 
     if(armTimer->control.WDMode) {
@@ -2090,6 +2172,12 @@ static VMI_ICOUNT_FN(expiredLT) {
 
         refreshEventLT(arm, armTimer);
     }
+
+    // schedule the next expiry of an auto-reloading timer (after the
+    // interrupt status is updated, which may make the expiry invisible)
+    if(armTimer->running) {
+        scheduleIntLT(arm, armTimer, "Timer expiry");
+    }
 }
 
 //
@@ -2270,8 +2358,16 @@ static ARM_MP_WRITEFN(writeStatusLT) {
     armLTimerP timer = getLT(arm, id-MPL_ID(PTInterruptStatus));
 
     // event is cleared if written with a non-zero value
-    if(newValue&1) {
+    if((newValue&1) && timer->event) {
+
+        Bool wasSilent = isSilentLT(timer);
+
         timer->event = 0;
+
+        // expiries of a running auto-reloading timer are visible again
+        if(wasSilent && timer->running) {
+            scheduleIntLT(arm, timer, "Status cleared");
+        }
     }
 }
 
@@ -2335,23 +2431,11 @@ static ARM_MP_WRITEFN(writeDisableLT) {
 ////////////////////////////////////////////////////////////////////////////////
 
 //
-// Create global timer object
-//
-static void newGT(
-    armP        arm,
-    armGTimerP  timer,
-    Uns32       intMask,
-    vmiICountFn icountCB
-) {
-    timer->intMask  = intMask;
-    timer->vmiTimer = vmirtCreateModelTimer((vmiProcessorP)arm, icountCB, timer);
-}
-
-//
-// Free global timer object
+// Initialize global timer object
 //
-static void freeGT(armGTimerP timer) {
-    vmirtDeleteModelTimer(timer->vmiTimer);
+static void newGT(armGTimerP timer, Uns32 intMask) {
+    timer->intMask = intMask;
+    timer->due     = NO_TIMER_EVENT;
 }
 
 //
@@ -2425,49 +2509,70 @@ static void scheduleIntGT(armP arm, const char *reason) {
     // sanity check timer is running
     VMI_ASSERT(timerG->TimerEnable, "global timer not running");
 
-    // get cycles and instructions until the comparator expires
-    Uns32 iRemaining;
-    Uns64 cRemaining = countsToExpiryGT(arm, &iRemaining);
+    if(!timer->control.CompEnable) {
 
-    // attempt to convert to an instruction delay - this may overflow
-    Uns32 scale       = timerG->scale;
-    Uns64 iCountCycle = cRemaining*scale;
-    Uns64 delta       = iCountCycle + iRemaining;
+        // the counter is derived when read, and there is no comparator event
+        timer->reschedule = False;
+        timer->due        = NO_TIMER_EVENT;
 
-    if(((iCountCycle/scale)!=cRemaining) || (delta<iCountCycle)) {
+    } else {
 
-        // enable rescheduling after a long period on overflow
-        timer->reschedule = True;
-        delta             = cRemaining;
+        // get cycles and instructions until the comparator expires
+        Uns32 iRemaining;
+        Uns64 cRemaining = countsToExpiryGT(arm, &iRemaining);
 
-    } else if(!delta) {
+        // attempt to convert to an instruction delay - this may overflow
+        Uns32 scale       = timerG->scale;
+        Uns64 iCountCycle = cRemaining*scale;
+        Uns64 delta       = iCountCycle + iRemaining;
 
-        // handle the case where the delta is currently zero - in this case,
-        // the timer should not expire for another full cycle
-        timer->reschedule = True;
-        delta             = -1;
+        if(((iCountCycle/scale)!=cRemaining) || (delta<iCountCycle)) {
 
-    } else {
+            // enable rescheduling after a long period on overflow
+            timer->reschedule = True;
+            delta             = cRemaining;
 
-        timer->reschedule = False;
+        } else if(!delta) {
+
+            // handle the case where the delta is currently zero - in this case,
+            // the timer should not expire for another full cycle
+            timer->reschedule = True;
+            delta             = -1;
+
+        } else {
+
+            timer->reschedule = False;
+        }
+
+        timer->due = getDue(arm, delta);
     }
 
     // set VMI timer
-    vmirtSetModelTimer(timer->vmiTimer, delta);
+    refreshTimerEvent(arm);
 
     // emit debug output if required
     if(ARM_DEBUG_MP(arm)) {
 
         Uns64 thisICount = getThisICount(arm);
 
-        vmiMessage("I", CPU_PREFIX"_STI",
-            NO_SRCREF_FMT
-            "%s - icount="FMT_64u" schedule global timer interrupt at "FMT_64u,
-            NO_SRCREF_ARGS(arm),
-            reason,
-            thisICount,
-            thisICount + delta
-        );
+        if(timer->due==NO_TIMER_EVENT) {
+            vmiMessage("I", CPU_PREFIX"_STI",
+                NO_SRCREF_FMT
+                "%s - icount="FMT_64u" no global timer interrupt scheduled",
+                NO_SRCREF_ARGS(arm),
+                reason,
+                thisICount
+            );
+        } else {
+            vmiMessage("I", CPU_PREFIX"_STI",
+                NO_SRCREF_FMT
+                "%s - icount="FMT_64u" schedule global timer interrupt at "FMT_64u,
+                NO_SRCREF_ARGS(arm),
+                reason,
+                thisICount,
+                timer->due
+            );
+        }
     }
 }
 
@@ -2492,7 +2597,8 @@ static void clearIntGT(armP arm, const char *reason) {
     VMI_ASSERT(!timerG->TimerEnable, "global timer running");
 
     // clear VMI timer
-    vmirtClearModelTimer(timer->vmiTimer);
+    timer->due = NO_TIMER_EVENT;
+    refreshTimerEvent(arm);
 
     // emit debug output if required
     if(ARM_DEBUG_MP(arm)) {
@@ -2528,14 +2634,13 @@ inline static void refreshEventGT(armP arm) {
 }
 
 //
-// This is called when the global timer has expired
+// Handle expiry of the global timer
 //
-static VMI_ICOUNT_FN(expiredGT) {
+static void expireGT(armP arm) {
 
-    armP        arm      = (armP)processor;
-    armGTimerP armTimer = userData;
+    armGTimerP armTimer = getGT(arm);
 
-    if(armTimer->reschedule || !armTimer->control.CompEnable) {
+    if(armTimer->reschedule) {
 
         // schedule the next iteration
         scheduleIntGT(arm, "Timer iteration");
@@ -2822,6 +2927,68 @@ static ARM_MP_WRITEFN(writeAutoIncGT) {
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+// TIMER EVENTS
+////////////////////////////////////////////////////////////////////////////////
+
+//
+// This is called when the earliest private, watchdog or global timer expiry
+// is reached: all timers due are handled and the VMI timer is set once for
+// the next expiry. A processor halted in WFI is therefore only called back
+// when a timer expiry may wake it.
+//
+static VMI_ICOUNT_FN(expiredTimers) {
+
+    armP          arm        = (armP)processor;
+    armMPLocalsP  mpLocals   = arm->mpLocals;
+    Uns64         thisICount = getThisICount(arm);
+    armLTimerType type;
+
+    // the VMI timer is no longer set
+    mpLocals->timerDue     = NO_TIMER_EVENT;
+    mpLocals->inTimerEvent = True;
+
+    for(type=0; type<LT_LAST; type++) {
+        if(getLT(arm, type)->due<=thisICount) {
+            expireLT(arm, getLT(arm, type));
+        }
+    }
+
+    if(getGT(arm)->due<=thisICount) {
+        expireGT(arm);
+    }
+
+    mpLocals->inTimerEvent = False;
+
+    // set VMI timer for the next expiry
+    refreshTimerEvent(arm);
+}
+
+//
+// Create the timer objects of a processor
+//
+static void newTimers(armP arm) {
+
+    armMPLocalsP mpLocals = arm->mpLocals;
+
+    newLT(getLT(arm, LT_PRIVATE),  "private",  MP_MASK_PT);
+    newLT(getLT(arm, LT_WATCHDOG), "watchdog", MP_MASK_WT);
+    newGT(getGT(arm), MP_MASK_GT);
+
+    mpLocals->timerDue = NO_TIMER_EVENT;
+    mpLocals->vmiTimer = vmirtCreateModelTimer(
+        (vmiProcessorP)arm, expiredTimers, 0
+    );
+}
+
+//
+// Free the timer objects of a processor
+//
+static void freeTimers(armP arm) {
+    vmirtDeleteModelTimer(arm->mpLocals->vmiTimer);
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 // MP REGISTER DEFINITIONS
 ////////////////////////////////////////////////////////////////////////////////
@@ -3825,12 +3992,8 @@ void armMPAllocLocal(armP arm) {
         *getICDICFR(arm, 0) = MP_INITIAL_ICDICFR0;
         *getICDICFR(arm, 1) = MP_INITIAL_ICDICFR1;
 
-        // initialize local timers
-        newLT(arm, getLT(arm, LT_PRIVATE),  "private",  MP_MASK_PT, expiredLT);
-        newLT(arm, getLT(arm, LT_WATCHDOG), "watchdog", MP_MASK_WT, expiredLT);
-
-        // initialize global timer
-        newGT(arm, getGT(arm), MP_MASK_GT, expiredGT);
+        // initialize local and global timers
+        newTimers(arm);
 
         // connect nets
         armAddNetOutputPort(arm, "wdResetReq", &arm->wdResetReq, "Watchdog interrupt request");
@@ -3864,12 +4027,8 @@ void armMPFreeLocal(armP arm) {
 
     if(mpLocals) {
 
-        // free local timers
-        freeLT(getLT(arm, LT_PRIVATE));
-        freeLT(getLT(arm, LT_WATCHDOG));
-
-        // free global timer
-        freeGT(getGT(arm));
+        // free local and global timers
+        freeTimers(arm);
 
         STYPE_FREE(mpLocals);
 
@@ -54,6 +54,7 @@
 #include "armMode.h"
 #include "armMPCore.h"
 #include "armMPCoreRegisters.h"
+#include "armMurac.h"
 #include "armStructure.h"
 #include "armSIMDVFP.h"
 #include "armUtils.h"
@@ -216,6 +217,9 @@ VMI_CONSTRUCTOR_FN(armConstructor) {
         arm->compatMode     = parent->compatMode;
         arm->showHiddenRegs = parent->showHiddenRegs;
         arm->UAL            = parent->UAL;
+        arm->staticDecode   = parent->staticDecode;
+        arm->checkDecode    = parent->checkDecode;
+        arm->wideSIMD       = parent->wideSIMD;
         arm->configInfo     = parent->configInfo;
 
         // set the name
@@ -232,6 +236,9 @@ VMI_CONSTRUCTOR_FN(armConstructor) {
         arm->compatMode     = params->compatibility;
         arm->showHiddenRegs = params->showHiddenRegs;
         arm->UAL            = params->UAL;
+        arm->staticDecode   = params->staticDecode;
+        arm->checkDecode    = params->checkDecode;
+        arm->wideSIMD       = params->wideSIMD;
 
         // get default variant information
         arm->configInfo = *getConfigVariantArg(arm, params);
@@ -384,6 +391,9 @@ VMI_CONSTRUCTOR_FN(armConstructor) {
         armCpInitialize(arm, smpContext->index);
         armFPInitialize(arm);
 
+        // MURAC BAA mailbox, indexed by MPIDR affinity level 0
+        arm->muracMailbox = armMuracMailbox(arm);
+
         // allocate MPCore global structures
         armMPAllocLocal(arm);
 
@@ -434,6 +444,9 @@ static VMI_SMP_ITER_FN(destructorCB) {
         armVMFree(arm);
     }
 
+    // free any decoded instruction cache
+    armDecodeCacheFree(arm);
+
     // free local MPCCore structures
     armMPFreeLocal(arm);
 }
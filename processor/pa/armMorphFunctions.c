@@ -32,6 +32,9 @@
  *
  */
 
+// standard header files
+#include <string.h>
+
 // VMI header files
 #include "vmi/vmiMessage.h"
 
@@ -1584,7 +1587,7 @@ ARM_MORPH_FN(armEmitBLX) {
 //
 ARM_MORPH_FN(armEmitBAA) {
     // emit the BrArch instruction
-    armEmitBrArch();
+    armEmitBrArch(state->arm);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -6350,6 +6353,366 @@ static void emitSIMDPairwisePerEl(armMorphStateP state, simdOpFunc perEl, void *
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// SIMD whole-register operations
+////////////////////////////////////////////////////////////////////////////////
+
+//
+// Run time function implementing a SIMD operation on all elements of D or Q
+// registers (bytes is 8 or 16)
+//
+#define SIMD_WIDE_FN(_NAME) void _NAME( \
+    armP  arm,                          \
+    Uns32 rd,                           \
+    Uns32 rn,                           \
+    Uns32 rm,                           \
+    Uns32 bytes                         \
+)
+typedef SIMD_WIDE_FN((*simdWideFn));
+
+//
+// Define a whole-register operation on elements of type _T. _EXPR gives the
+// result element from x (Vn), y (Vm) and d (Vd) and sets qc on saturation.
+// Operands are copied first, so Vd may overlap Vn or Vm.
+//
+#define SIMD_WIDE_OP(_NAME, _T, _EXPR)                          \
+    static SIMD_WIDE_FN(_NAME) {                                \
+        _T    a[16/sizeof(_T)];                                 \
+        _T    b[16/sizeof(_T)];                                 \
+        _T    r[16/sizeof(_T)];                                 \
+        Uns32 n  = bytes/sizeof(_T);                            \
+        Bool  qc = False;                                       \
+        Uns32 i;                                                \
+        memcpy(a, &arm->vregs.b[rn*ARM_SIMD_REG_BYTES], bytes); \
+        memcpy(b, &arm->vregs.b[rm*ARM_SIMD_REG_BYTES], bytes); \
+        memcpy(r, &arm->vregs.b[rd*ARM_SIMD_REG_BYTES], bytes); \
+        for(i=0; i<n; i++) {                                    \
+            _T x = a[i];                                        \
+            _T y = b[i];                                        \
+            _T d = r[i];                                        \
+            (void)d;                                            \
+            r[i] = (_T)(_EXPR);                                 \
+        }                                                       \
+        memcpy(&arm->vregs.b[rd*ARM_SIMD_REG_BYTES], r, bytes); \
+        if(qc) {                                                \
+            arm->simdQC = 1;                                    \
+        }                                                       \
+    }
+
+//
+// Define byte, halfword and word versions of a whole-register operation, with
+// elements of type _TYPE8, _TYPE16 and _TYPE32
+//
+#define SIMD_WIDE_OP_BHW(_NAME, _TYPE, _EXPR)  \
+    SIMD_WIDE_OP(_NAME##8,  _TYPE##8,  _EXPR)  \
+    SIMD_WIDE_OP(_NAME##16, _TYPE##16, _EXPR)  \
+    SIMD_WIDE_OP(_NAME##32, _TYPE##32, _EXPR)
+
+//
+// Select the byte, halfword, word (or doubleword) version of an operation
+//
+#define SIMD_WIDE_BHW(_NAME, _EBYTES) (             \
+    ((_EBYTES)==1) ? _NAME##8  :                    \
+    ((_EBYTES)==2) ? _NAME##16 :                    \
+    ((_EBYTES)==4) ? _NAME##32 : 0                  \
+)
+#define SIMD_WIDE_BHWD(_NAME, _EBYTES) (            \
+    ((_EBYTES)==8) ? _NAME##64 : SIMD_WIDE_BHW(_NAME, _EBYTES) \
+)
+
+//
+// Number of bits in element x
+//
+#define SIMD_WIDE_EBITS (8*sizeof(x))
+
+//
+// Saturate a signed result to the passed number of bits, setting qc if it saturates
+//
+inline static Int64 satSigned(Int64 value, Uns32 bits, Bool *qc) {
+
+    Int64 max = (1LL<<(bits-1))-1;
+    Int64 min = -max-1;
+
+    if(value>max) {
+        *qc = True;
+        return max;
+    } else if(value<min) {
+        *qc = True;
+        return min;
+    } else {
+        return value;
+    }
+}
+
+//
+// Saturate an unsigned result to the passed number of bits, setting qc if it saturates
+//
+inline static Uns64 satUnsigned(Int64 value, Uns32 bits, Bool *qc) {
+
+    Int64 max = (1LL<<bits)-1;
+
+    if(value>max) {
+        *qc = True;
+        return max;
+    } else if(value<0) {
+        *qc = True;
+        return 0;
+    } else {
+        return value;
+    }
+}
+
+//
+// Saturating doubleword operations
+//
+inline static Int64 addSatSigned64(Int64 x, Int64 y, Bool *qc) {
+
+    Int64 result = (Int64)((Uns64)x + (Uns64)y);
+
+    if(((x^result) & (y^result)) < 0) {
+        *qc = True;
+        return (x<0) ? (Int64)(1ULL<<63) : (Int64)((1ULL<<63)-1);
+    } else {
+        return result;
+    }
+}
+
+inline static Int64 subSatSigned64(Int64 x, Int64 y, Bool *qc) {
+
+    Int64 result = (Int64)((Uns64)x - (Uns64)y);
+
+    if(((x^y) & (x^result)) < 0) {
+        *qc = True;
+        return (x<0) ? (Int64)(1ULL<<63) : (Int64)((1ULL<<63)-1);
+    } else {
+        return result;
+    }
+}
+
+inline static Uns64 addSatUnsigned64(Uns64 x, Uns64 y, Bool *qc) {
+
+    Uns64 result = x + y;
+
+    if(result<x) {
+        *qc = True;
+        return ~0ULL;
+    } else {
+        return result;
+    }
+}
+
+inline static Uns64 subSatUnsigned64(Uns64 x, Uns64 y, Bool *qc) {
+
+    if(x<y) {
+        *qc = True;
+        return 0;
+    } else {
+        return x - y;
+    }
+}
+
+// modular and bitwise operations
+SIMD_WIDE_OP_BHW(simdWideADD, Uns, x + y)
+SIMD_WIDE_OP_BHW(simdWideSUB, Uns, x - y)
+SIMD_WIDE_OP_BHW(simdWideMUL, Uns, (Uns32)x * (Uns32)y)
+SIMD_WIDE_OP_BHW(simdWideMLA, Uns, d + (Uns32)x * (Uns32)y)
+SIMD_WIDE_OP_BHW(simdWideMLS, Uns, d - (Uns32)x * (Uns32)y)
+SIMD_WIDE_OP(simdWideADD64,  Uns64, x + y)
+SIMD_WIDE_OP(simdWideSUB64,  Uns64, x - y)
+SIMD_WIDE_OP(simdWideAND,    Uns64, x & y)
+SIMD_WIDE_OP(simdWideANDN,   Uns64, x & ~y)
+SIMD_WIDE_OP(simdWideOR,     Uns64, x | y)
+SIMD_WIDE_OP(simdWideORN,    Uns64, x | ~y)
+SIMD_WIDE_OP(simdWideXOR,    Uns64, x ^ y)
+
+// halving operations
+SIMD_WIDE_OP_BHW(simdWideADDSH,  Int, ((Int64)x + y) >> 1)
+SIMD_WIDE_OP_BHW(simdWideADDUH,  Uns, ((Int64)x + y) >> 1)
+SIMD_WIDE_OP_BHW(simdWideADDSHR, Int, ((Int64)x + y + 1) >> 1)
+SIMD_WIDE_OP_BHW(simdWideADDUHR, Uns, ((Int64)x + y + 1) >> 1)
+SIMD_WIDE_OP_BHW(simdWideSUBSH,  Int, ((Int64)x - y) >> 1)
+SIMD_WIDE_OP_BHW(simdWideSUBUH,  Uns, ((Int64)x - y) >> 1)
+
+// saturating operations
+SIMD_WIDE_OP_BHW(simdWideADDSQ, Int, satSigned  ((Int64)x + y, SIMD_WIDE_EBITS, &qc))
+SIMD_WIDE_OP_BHW(simdWideADDUQ, Uns, satUnsigned((Int64)x + y, SIMD_WIDE_EBITS, &qc))
+SIMD_WIDE_OP_BHW(simdWideSUBSQ, Int, satSigned  ((Int64)x - y, SIMD_WIDE_EBITS, &qc))
+SIMD_WIDE_OP_BHW(simdWideSUBUQ, Uns, satUnsigned((Int64)x - y, SIMD_WIDE_EBITS, &qc))
+SIMD_WIDE_OP(simdWideADDSQ64, Int64, addSatSigned64  (x, y, &qc))
+SIMD_WIDE_OP(simdWideADDUQ64, Uns64, addSatUnsigned64(x, y, &qc))
+SIMD_WIDE_OP(simdWideSUBSQ64, Int64, subSatSigned64  (x, y, &qc))
+SIMD_WIDE_OP(simdWideSUBUQ64, Uns64, subSatUnsigned64(x, y, &qc))
+
+// comparisons, giving all ones or zero
+SIMD_WIDE_OP_BHW(simdWideCEQ,  Uns, (x == y) ? -1 : 0)
+SIMD_WIDE_OP_BHW(simdWideCGTU, Uns, (x >  y) ? -1 : 0)
+SIMD_WIDE_OP_BHW(simdWideCGEU, Uns, (x >= y) ? -1 : 0)
+SIMD_WIDE_OP_BHW(simdWideCGTS, Int, (x >  y) ? -1 : 0)
+SIMD_WIDE_OP_BHW(simdWideCGES, Int, (x >= y) ? -1 : 0)
+SIMD_WIDE_OP_BHW(simdWideTST,  Uns, (x &  y) ? -1 : 0)
+
+// maximum and minimum
+SIMD_WIDE_OP_BHW(simdWideMAXU, Uns, (x >= y) ? x : y)
+SIMD_WIDE_OP_BHW(simdWideMAXS, Int, (x >= y) ? x : y)
+SIMD_WIDE_OP_BHW(simdWideMINU, Uns, (x <  y) ? x : y)
+SIMD_WIDE_OP_BHW(simdWideMINS, Int, (x <  y) ? x : y)
+
+//
+// Return the whole-register function for a SIMD binop, or 0 if there is none
+//
+static simdWideFn getSIMDWideBinop(armMorphStateP state) {
+
+    armMorphAttrCP attrs  = state->attrs;
+    Uns32          ebytes = attrs->ebytes;
+
+    if(attrs->accumulate || attrs->round || attrs->highhalf) {
+        return 0;
+    }
+
+    switch(attrs->binop) {
+        case vmi_ADD:    return SIMD_WIDE_BHWD(simdWideADD,   ebytes);
+        case vmi_SUB:    return SIMD_WIDE_BHWD(simdWideSUB,   ebytes);
+        case vmi_IMUL:   return SIMD_WIDE_BHW (simdWideMUL,   ebytes);
+        case vmi_AND:    return simdWideAND;
+        case vmi_ANDN:   return simdWideANDN;
+        case vmi_OR:     return simdWideOR;
+        case vmi_ORN:    return simdWideORN;
+        case vmi_XOR:    return simdWideXOR;
+        case vmi_ADDSH:  return SIMD_WIDE_BHW (simdWideADDSH,  ebytes);
+        case vmi_ADDUH:  return SIMD_WIDE_BHW (simdWideADDUH,  ebytes);
+        case vmi_ADDSHR: return SIMD_WIDE_BHW (simdWideADDSHR, ebytes);
+        case vmi_ADDUHR: return SIMD_WIDE_BHW (simdWideADDUHR, ebytes);
+        case vmi_SUBSH:  return SIMD_WIDE_BHW (simdWideSUBSH,  ebytes);
+        case vmi_SUBUH:  return SIMD_WIDE_BHW (simdWideSUBUH,  ebytes);
+        case vmi_ADDSQ:  return SIMD_WIDE_BHWD(simdWideADDSQ,  ebytes);
+        case vmi_ADDUQ:  return SIMD_WIDE_BHWD(simdWideADDUQ,  ebytes);
+        case vmi_SUBSQ:  return SIMD_WIDE_BHWD(simdWideSUBSQ,  ebytes);
+        case vmi_SUBUQ:  return SIMD_WIDE_BHWD(simdWideSUBUQ,  ebytes);
+        default:         return 0;
+    }
+}
+
+//
+// Return the whole-register function for a SIMD multiply accumulate or
+// subtract, or 0 if there is none
+//
+static simdWideFn getSIMDWideMulAcc(armMorphStateP state) {
+
+    armMorphAttrCP attrs  = state->attrs;
+    Uns32          ebytes = attrs->ebytes;
+
+    switch(attrs->binop) {
+        case vmi_ADD: return SIMD_WIDE_BHW(simdWideMLA, ebytes);
+        case vmi_SUB: return SIMD_WIDE_BHW(simdWideMLS, ebytes);
+        default:      return 0;
+    }
+}
+
+//
+// Return the whole-register function for a SIMD comparison giving all ones
+// or zero, or 0 if there is none
+//
+static simdWideFn getSIMDWideCmpBool(armMorphStateP state) {
+
+    armMorphAttrCP attrs  = state->attrs;
+    Uns32          ebytes = attrs->ebytes;
+
+    switch(attrs->cond) {
+        case vmi_COND_EQ:  return SIMD_WIDE_BHW(simdWideCEQ,  ebytes);
+        case vmi_COND_NBE: return SIMD_WIDE_BHW(simdWideCGTU, ebytes);
+        case vmi_COND_NB:  return SIMD_WIDE_BHW(simdWideCGEU, ebytes);
+        case vmi_COND_NLE: return SIMD_WIDE_BHW(simdWideCGTS, ebytes);
+        case vmi_COND_NL:  return SIMD_WIDE_BHW(simdWideCGES, ebytes);
+        default:           return 0;
+    }
+}
+
+//
+// Return the whole-register function for a SIMD comparison selecting Vn or
+// Vm, or 0 if there is none
+//
+static simdWideFn getSIMDWideCmpReg(armMorphStateP state) {
+
+    armMorphAttrCP attrs  = state->attrs;
+    Uns32          ebytes = attrs->ebytes;
+
+    switch(attrs->cond) {
+        case vmi_COND_NB: return SIMD_WIDE_BHW(simdWideMAXU, ebytes);
+        case vmi_COND_NL: return SIMD_WIDE_BHW(simdWideMAXS, ebytes);
+        case vmi_COND_B:  return SIMD_WIDE_BHW(simdWideMINU, ebytes);
+        case vmi_COND_L:  return SIMD_WIDE_BHW(simdWideMINS, ebytes);
+        default:          return 0;
+    }
+}
+
+//
+// Emit a call to a whole-register function for a 3 register SIMD instruction
+// with normal shape. Returns False if the instruction must be translated per
+// element instead.
+//
+static Bool emitSIMDWide(armMorphStateP state, simdWideFn fn) {
+
+    if(!fn || !state->arm->wideSIMD || (state->attrs->shape!=ASDS_NORMAL)) {
+        return False;
+    }
+
+    if(checkAdvSIMDEnabled(state)) {
+
+        Uns32 regs = state->attrs->regs;
+
+        // don't need these here but this catches any registers out of range
+        (void) GET_SIMD_EL(state, r1, regs-1, 0, ARM_SIMD_REG_BYTES);
+        (void) GET_SIMD_EL(state, r2, regs-1, 0, ARM_SIMD_REG_BYTES);
+        (void) GET_SIMD_EL(state, r3, regs-1, 0, ARM_SIMD_REG_BYTES);
+
+        armEmitArgProcessor(state);
+        armEmitArgUns32(state, state->info.r1);            // Destination register
+        armEmitArgUns32(state, state->info.r2);            // First operand register
+        armEmitArgUns32(state, state->info.r3);            // Second operand register
+        armEmitArgUns32(state, regs*ARM_SIMD_REG_BYTES);   // 8 for D, 16 for Q
+        armEmitCall(state, (vmiCallFn)fn);
+    }
+
+    return True;
+}
+
+//
+// Run time function implementing a 2-register SIMD operation on all lanes of
+// D or Q registers
+//
+typedef void (*simdWideRRFn)(armP arm, Uns32 rd, Uns32 rm, Uns32 lanes);
+
+//
+// Emit a call to a whole-register function for a 2-register SIMD instruction
+// with normal or long shape. Returns False if the instruction must be
+// translated per element instead.
+//
+static Bool emitSIMDWideRR(armMorphStateP state, simdWideRRFn fn) {
+
+    if(!state->arm->wideSIMD) {
+        return False;
+    }
+
+    if(checkAdvSIMDEnabled(state)) {
+
+        Uns32 regs   = state->attrs->regs;
+        Uns32 lanes  = regs*state->attrs->elements;
+        Uns32 r1Regs = (state->attrs->shape==ASDS_LONG) ? regs*2 : regs;
+
+        // don't need these here but this catches any registers out of range
+        (void) GET_SIMD_EL(state, r1, r1Regs-1, 0, ARM_SIMD_REG_BYTES);
+        (void) GET_SIMD_EL(state, r2, regs-1,   0, ARM_SIMD_REG_BYTES);
+
+        armEmitArgProcessor(state);
+        armEmitArgUns32(state, state->info.r1);            // Destination register
+        armEmitArgUns32(state, state->info.r2);            // Operand register
+        armEmitArgUns32(state, lanes);                     // Lanes in all registers
+        armEmitCall(state, (vmiCallFn)fn);
+    }
+
+    return True;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // SIMD Data processing instructions
 ////////////////////////////////////////////////////////////////////////////////
@@ -6410,7 +6773,9 @@ static SIMD_EL_OP_FN(simdBinopEl) {
 // Emit code for a standard SIMD binary operation on 3 regs
 //
 ARM_MORPH_FN(armEmitVBinop) {
-    emitSIMDPerEl(state, simdBinopEl, SDOP_ELEMENT, True, 0);
+    if(!emitSIMDWide(state, getSIMDWideBinop(state))) {
+        emitSIMDPerEl(state, simdBinopEl, SDOP_ELEMENT, True, 0);
+    }
 }
 
 //
@@ -6757,7 +7122,9 @@ static SIMD_EL_OP_FN(simdMulAccEl) {
 // Emit code for Mulitiply Accumlate/Subtract VMLA/VMLS/VMLAL/VMLSL Vd, Vn, Vm
 //
 ARM_MORPH_FN(armEmitVMulAcc) {
-    emitSIMDPerEl(state, simdMulAccEl, SDOP_ELEMENT, True, 0);
+    if(!emitSIMDWide(state, getSIMDWideMulAcc(state))) {
+        emitSIMDPerEl(state, simdMulAccEl, SDOP_ELEMENT, True, 0);
+    }
 }
 
 //
@@ -7155,7 +7522,9 @@ static SIMD_EL_OP_FN(simdVCvtFHEl) {
 // Emit code for SIMD VCVT instructions from Half to Single precision Floating point
 //
 ARM_MORPH_FN(armEmitVCVT_FH_SIMD) {
-    emitSIMDPerEl(state, simdVCvtFHEl, SDOP_NONE, False, 0);
+    if(!emitSIMDWideRR(state, armFPHalfToSingleN)) {
+        emitSIMDPerEl(state, simdVCvtFHEl, SDOP_NONE, False, 0);
+    }
 }
 
 //
@@ -7205,7 +7574,9 @@ static SIMD_EL_OP_FN(simdVTst) {
 // Emit code for Vector Comparison Ops that set result to 0/1 depending on comparison
 //
 ARM_MORPH_FN(armEmitVTst) {
-    emitSIMDPerEl(state, simdVTst, SDOP_ELEMENT, True, 0);
+    if(!emitSIMDWide(state, SIMD_WIDE_BHW(simdWideTST, state->attrs->ebytes))) {
+        emitSIMDPerEl(state, simdVTst, SDOP_ELEMENT, True, 0);
+    }
 }
 
 //
@@ -7231,7 +7602,9 @@ static SIMD_EL_OP_FN(simdVCmpSelBool) {
 // Emit code for Vector Comparison Ops that set result to 0/1 depending on comarison
 //
 ARM_MORPH_FN(armEmitVCmpBool) {
-    emitSIMDPerEl(state, simdVCmpSelBool, SDOP_ELEMENT, True, 0);
+    if(!emitSIMDWide(state, getSIMDWideCmpBool(state))) {
+        emitSIMDPerEl(state, simdVCmpSelBool, SDOP_ELEMENT, True, 0);
+    }
 }
 
 //
@@ -7282,7 +7655,9 @@ static SIMD_EL_OP_FN(simdVCmpSelReg) {
 // Emit code for Vector Compare instructions that select Rn/Rm based on comparison
 //
 ARM_MORPH_FN(armEmitVCmpReg) {
-    emitSIMDPerEl(state, simdVCmpSelReg, SDOP_ELEMENT, True, 0);
+    if(!emitSIMDWide(state, getSIMDWideCmpReg(state))) {
+        emitSIMDPerEl(state, simdVCmpSelReg, SDOP_ELEMENT, True, 0);
+    }
 }
 
 //
@@ -8000,28 +8375,36 @@ static SIMD_EL_OP_FN(simdVRecpeEl) {
 // Emit code for the floating point VRECPE instruction
 //
 ARM_MORPH_FN(armEmitVRECPE_F) {
-    emitSIMDPerEl(state, simdVRecpeEl, SDOP_NONE, True, armFPRecipEstimate);
+    if(!emitSIMDWideRR(state, armFPRecipEstimateN)) {
+        emitSIMDPerEl(state, simdVRecpeEl, SDOP_NONE, True, armFPRecipEstimate);
+    }
 }
 
 //
 // Emit code for the unsigned VRECPE instruction
 //
 ARM_MORPH_FN(armEmitVRECPE_U) {
-    emitSIMDPerEl(state, simdVRecpeEl, SDOP_NONE, True, armFPUnsignedRecipEstimate);
+    if(!emitSIMDWideRR(state, armFPUnsignedRecipEstimateN)) {
+        emitSIMDPerEl(state, simdVRecpeEl, SDOP_NONE, True, armFPUnsignedRecipEstimate);
+    }
 }
 
 //
 // Emit code for the floating point VRSQRTE instruction
 //
 ARM_MORPH_FN(armEmitVRSQRTE_F) {
-    emitSIMDPerEl(state, simdVRecpeEl, SDOP_NONE, True, armFPRSqrtEstimate);
+    if(!emitSIMDWideRR(state, armFPRSqrtEstimateN)) {
+        emitSIMDPerEl(state, simdVRecpeEl, SDOP_NONE, True, armFPRSqrtEstimate);
+    }
 }
 
 //
 // Emit code for the unsigned VRSQRTE instruction
 //
 ARM_MORPH_FN(armEmitVRSQRTE_U) {
-    emitSIMDPerEl(state, simdVRecpeEl, SDOP_NONE, True, armFPUnsignedRsqrtEstimate);
+    if(!emitSIMDWideRR(state, armFPUnsignedRsqrtEstimateN)) {
+        emitSIMDPerEl(state, simdVRecpeEl, SDOP_NONE, True, armFPUnsignedRsqrtEstimate);
+    }
 }
 
 //
@@ -8911,7 +9294,7 @@ VMI_MORPH_FN(armMorphInstruction) {
     }
 
     // get instruction and instruction type
-    armDecode(arm, thisPC, &state.info);
+    armDecodeMorph(arm, thisPC, &state.info);
 
     // get morpher attributes for the decoded instruction and initialize other
     // state fields
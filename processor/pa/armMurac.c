@@ -6,9 +6,19 @@
 #include "vmi/vmiMessage.h"
 #include "vmi/vmiRt.h"
 
+#include "armCP.h"
+#include "armCPRegisters.h"
 #include "armMurac.h"
 #include "stdio.h"
 
+Uns32 armMuracMailbox(armP arm) {
+    Uns32 cpu = 0;
+    if(armGetCpRegSupported(CP_ID(MPIDR), arm)) {
+        cpu = CP_FIELD(arm, MPIDR, AffinityLevel0);
+    }
+    return MURAC_MAILBOX_ADDRESS(cpu);
+}
+
 void vmic_branchAuxiliaryArchitecture(armP arm, Uns32 aa_block_size) {
     /* Set the PC */
     Uns32 simPC = vmirtGetPC((vmiProcessorP)arm);
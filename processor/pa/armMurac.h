@@ -10,6 +10,16 @@
 
 #define MURAC_PC_ADDRESS 0xCF000000
 
+// Each PA core has its own BAA mailbox (PC, block size, pointer), indexed
+// by MPIDR affinity level 0
+#define MURAC_MAILBOX_SIZE          0x10
+#define MURAC_MAILBOX_ADDRESS(_CPU) (MURAC_PC_ADDRESS + (_CPU)*MURAC_MAILBOX_SIZE)
+
 void vmic_branchAuxiliaryArchitecture(armP arm, Uns32 aa_block_size);
 
+//
+// Return the address of the BAA mailbox for the passed core
+//
+Uns32 armMuracMailbox(armP arm);
+
 #endif
@@ -65,6 +65,9 @@ static vmiParameter formals[] = {
     VMI_BOOL_PARAM_SPEC(  armParamValues, verbose,          1, "Specify verbosity of output" ),
     VMI_BOOL_PARAM_SPEC(  armParamValues, showHiddenRegs,   0, "Show hidden registers during register tracing" ),
     VMI_BOOL_PARAM_SPEC(  armParamValues, UAL,              1, "Disassemble using UAL syntax" ),
+    VMI_BOOL_PARAM_SPEC(  armParamValues, staticDecode,     1, "Decode using the decoders generated at build time, if present (if 0, decode tables are built at startup)" ),
+    VMI_BOOL_PARAM_SPEC(  armParamValues, checkDecode,      0, "Check every static decode against the startup-built decode tables, reporting differences" ),
+    VMI_BOOL_PARAM_SPEC(  armParamValues, wideSIMD,         1, "Implement common SIMD integer operations, estimates and half-precision conversions on whole registers (if 0, they are translated per element)" ),
     VMI_BOOL_PARAM_SPEC(  armParamValues, enableVFPAtReset, 0, "Enable vector floating point (SIMD and VFP) instructions at reset. (Enables cp10/11 in CPACR and sets FPEXC.EN)" ),
 
     VMI_UNS32_PARAM_SPEC( armParamValues, override_MainId                , 0, 0, VMI_MAXU32, "Coprocessor 15 MainId register"),
@@ -48,6 +48,9 @@ typedef struct armParamValuesS {
     VMI_BOOL_PARAM(verbose);
     VMI_BOOL_PARAM(showHiddenRegs);
     VMI_BOOL_PARAM(UAL);
+    VMI_BOOL_PARAM(staticDecode);
+    VMI_BOOL_PARAM(checkDecode);
+    VMI_BOOL_PARAM(wideSIMD);
     VMI_BOOL_PARAM(enableVFPAtReset);
     VMI_ENDIAN_PARAM(endian);
     VMI_ENUM_PARAM(variant);
@@ -100,6 +100,10 @@
 #define ARM_DISABLE             ARM_CPU_REG(disable)
 #define ARM_EVENT               ARM_CPU_REG(event)
 
+// morph-time macro to calculate offset to the MURAC BAA mailbox address in an
+// arm structure
+#define ARM_MURAC_MAILBOX       ARM_CPU_REG(muracMailbox)
+
 // morph-time macro to calculate offset to ITSTATE in an arm structure
 #define ARM_IT_STATE            ARM_CPU_REG(itStateRT)
 
@@ -32,7 +32,7 @@
  *
  */
 
-#include <math.h>
+#include <string.h>
 
 // VMI header files
 #include "vmi/vmiRt.h"
@@ -40,6 +40,8 @@
 
 // model header files
 #include "armFPConstants.h"
+#include "armFPLookup.h"
+#include "armFPTables.h"
 #include "armMessage.h"
 #include "armSIMDVFP.h"
 #include "armSIMDVFPRegisters.h"
@@ -401,30 +403,21 @@ static void raiseInexact(armP arm) {
 ////////////////////////////////////////////////////////////////////////////////
 
 //
-// Convert from half-precision to single-precision
+// Convert a half-precision infinity or NaN to single-precision
 //
-Uns32 armFPHalfToSingle(armP arm, Uns16 half) {
+static Uns32 halfToSingleInfNaN(armP arm, Uns16 half) {
 
-    Int32 exponent   = ARM_FP16_EXPONENT(half);
-    Uns32 fraction   = ARM_FP16_FRACTION(half);
-    Bool  sign       = ARM_FP16_SIGN(half);
-    Bool  expAll1    = (exponent==ARM_FP16_EXP_ONES);
-    Bool  isZero     = (!exponent && !fraction);
-    Bool  isInfinity = (expAll1 && !fraction);
-    Bool  isNaN      = (expAll1 && !isInfinity);
-    Bool  useAHP     = inAHPMode(arm);
+    Uns32 exponent = ARM_FP32_EXP_ONES;
+    Uns32 fraction = ARM_FP16_FRACTION(half);
+    Bool  sign     = ARM_FP16_SIGN(half);
 
-    if(isInfinity && !useAHP) {
+    if(!fraction) {
 
         // infinities require exponent correction
         exponent = ARM_FP32_EXPONENT(ARM_FP32_PLUS_INFINITY);
         fraction = ARM_FP32_FRACTION(ARM_FP32_PLUS_INFINITY);
 
-    } else if(isZero) {
-
-        // zero values require no special processing
-
-    } else if(isNaN && !useAHP) {
+    } else {
 
         // argument is an SNaN if MSB of fraction is clear
         Bool isSNaN = !(fraction & (1 << (ARM_FP16_EXP_SHIFT-1)));
@@ -443,33 +436,10 @@ Uns32 armFPHalfToSingle(armP arm, Uns16 half) {
 
         } else {
 
-            // NaNs require exponent correction
-            exponent = ARM_FP32_EXP_ONES;
-
             // NaNs require fraction correction
             fraction  = fraction << (ARM_FP32_EXP_SHIFT - ARM_FP16_EXP_SHIFT);
             fraction |= ARM_QNAN_MASK_32;
         }
-
-    } else {
-
-        // normalize a denormal value if required
-        if(!exponent) {
-
-            // shift up until implicit MSB is 1
-            do {
-                fraction <<= 1;
-                exponent--;
-            } while(!(fraction & (1<<ARM_FP16_EXP_SHIFT)));
-
-            // correct exponent and mask off implicit MSB
-            exponent++;
-            fraction &= ~(1<<ARM_FP16_EXP_SHIFT);
-        }
-
-        // rebase exponent and fraction
-        exponent +=  (ARM_FP32_EXP_BIAS  - ARM_FP16_EXP_BIAS );
-        fraction <<= (ARM_FP32_EXP_SHIFT - ARM_FP16_EXP_SHIFT);
     }
 
     // compose single-precision result
@@ -480,6 +450,29 @@ Uns32 armFPHalfToSingle(armP arm, Uns16 half) {
     );
 }
 
+//
+// Convert from half-precision to single-precision
+//
+Uns32 armFPHalfToSingle(armP arm, Uns16 half) {
+
+    if((ARM_FP16_EXPONENT(half)==ARM_FP16_EXP_ONES) && !inAHPMode(arm)) {
+
+        // IEEE infinities and NaNs
+        return halfToSingleInfNaN(arm, half);
+
+    } else {
+
+        // zeros and numbers (including AHP numbers with exponent 0x1f) are
+        // converted by table, which holds the result without sign
+        Uns32 sign = ARM_FP16_SIGN(half);
+
+        return (
+            (sign << ARM_FP32_SIGN_SHIFT) |
+            armHalfToSingleTable[ARM_HALF_INDEX(half)]
+        );
+    }
+}
+
 //
 // Convert from single-precision to half-precision
 //
@@ -691,21 +684,6 @@ Uns16 armFPSingleToHalf(armP arm, Uns32 single) {
 // RECIPROCAL ESTIMATE
 ////////////////////////////////////////////////////////////////////////////////
 
-//
-// This is from recip_estimate Psuedo code in ARM Architecture Reference Manual
-//
-static double recipEstimate (Flt64 a) {
-
-    Int32 q, s;
-    Flt64 r;
-
-    q = (Int32)(a * 512.0);
-    r = 1.0 / (((Flt64) q + 0.5) / 512.0);
-    s = (Int32)(256.0 * r + 0.5);
-
-    return ((Flt64) s / 256.0);
-}
-
 //
 // Do reciprocal estimate
 // This is from FPRecipEstimate Psuedo code in ARM Architecture Reference Manual
@@ -754,11 +732,9 @@ Uns32 armFPRecipEstimate(armP arm, Uns32 op) {
     } else {
 
         // See FPRecipEstimate Psuedo code in Arm Architecture manual for details
-        Uns64 frac64    = op & 0x007fffff;
+        // (the estimate of the scaled operand is looked up in a table)
         Uns32 resultExp = 253 - exponent;
-        union {Uns64 u; Flt64 f;} scaled, estimate;
-
-        scaled.u = (0x3feULL << 52) | (frac64 << 29);
+        Uns8  estimate  = armRecipEstimateTable[ARM_RECIP_INDEX_FP32(op)];
 
         // Note: Reference simulator differs from psuedo code for op=0x8080000
         // (Smallest normal value) or 0xc2fa0000 (-128) and probably other neg numbers
@@ -766,15 +742,10 @@ Uns32 armFPRecipEstimate(armP arm, Uns32 op) {
         // positive scaled and set sign bit on result to match sign of op.
         // Currently implementd to match reference simulator
 
-        // Set sign bit in scaled if set in op
-//        if (sign) scaled.u |= (1ULL << 63);   // Psuredo code version
+        fraction = ARM_ESTIMATE_FP32_FRACTION(estimate);
+        result   = resultExp << 23 | fraction;
 
-        estimate.f = recipEstimate(scaled.f);
-        fraction   = (estimate.u >> 29) & 0x007fffff;
-        result     = resultExp << 23 | fraction;
-
-        // Set sign bit if estimate sign bit is set
-//        if (estimate.u & (1ULL << 63)) result |= (1 << 31);  // Psuredo code version
+        // Set sign bit from op
         if (sign) result |= (1 << 31);  // Reference simulator version
     }
 
@@ -797,13 +768,8 @@ Uns32 armFPUnsignedRecipEstimate(armP arm, Uns32 op) {
 
     } else {
 
-        Uns64 fraction  = op & 0x7fffffff;
-        union {Uns64 u; Flt64 f;} scaled, estimate;
-
-        scaled.u   = (0x3feULL << 52) | (fraction << 21);
-        estimate.f = recipEstimate(scaled.f);
-        fraction   = (estimate.u >> 21);
-        result     = fraction | 0x80000000;
+        // estimate of the operand scaled into [0.5, 1.0)
+        result = ARM_ESTIMATE_U32(armRecipEstimateTable[ARM_RECIP_INDEX_U32(op)]);
 
     }
 
@@ -815,26 +781,6 @@ Uns32 armFPUnsignedRecipEstimate(armP arm, Uns32 op) {
 // RECIPROCAL SQUARE ROOT ESTIMATE
 ////////////////////////////////////////////////////////////////////////////////
 
-//
-// This is from recip_sqrt_estimate Psuedo code in ARM Architecture Reference
-// Manual
-//
-static double recipSqrtEstimate(Flt64 a) {
-
-    Int32 q0, q1, s;
-    Flt64 r;
-
-    if (a < 0.5) {
-        q0 = (Int32)(a * 512.0);
-        r  = 1.0 / sqrt(((Flt64)q0 + 0.5) / 512.0);
-    } else {
-        q1 = (Int32)(a * 256.0);
-        r  = 1.0 / sqrt(((Flt64)q1 + 0.5) / 256.0);
-    }
-    s = (Int32)(256.0 * r + 0.5);
-    return (Flt64)s / 256.0;
-}
-
 //
 // Do reciprocal square root estimate
 // This is from FPRSqrtEstimate Psuedo code in ARM Architecture Reference Manual
@@ -880,26 +826,13 @@ Uns32 armFPRSqrtEstimate(armP arm, Uns32 op) {
     } else {
 
         // See FPSqrtEstimate Psuedo code in Arm Architecture manual for details
-        Uns64 frac64    = fraction;
+        // (the operand is positive here, and the estimate of the operand
+        // scaled by its exponent parity is looked up in a table)
         Uns32 resultExp = (380 - exponent) / 2;
+        Uns8  estimate  = armRSqrtEstimateTable[ARM_RSQRT_INDEX_FP32(op)];
 
-        union {Uns64 u; Flt64 f;} scaled, estimate;
-
-        if (exponent & 0x01) {
-            scaled.u = (0x3fdULL << 52) | (frac64 << 29);
-        } else {
-            scaled.u = (0x3feULL << 52) | (frac64 << 29);
-        }
-
-        // Set sign bit in scaled if set in op
-        if (sign) scaled.u |= (1ULL << 63);
-
-        estimate.f = recipSqrtEstimate(scaled.f);
-        fraction   = (estimate.u >> 29) & 0x007fffff;
-        result     = resultExp << 23 | fraction;
-
-        // Set sign bit if estimate sign bit is set
-        if (estimate.u & (1ULL << 63)) result |= (1 << 31);
+        fraction = ARM_ESTIMATE_FP32_FRACTION(estimate);
+        result   = resultExp << 23 | fraction;
     }
 
     return result;
@@ -921,26 +854,55 @@ Uns32 armFPUnsignedRsqrtEstimate(armP arm, Uns32 op) {
 
     } else {
 
-        Uns64 fraction;
-        union {Uns64 u; double f;} scaled, estimate;
+        // estimate of the operand scaled into [0.5, 1.0) if operand<31:30>
+        // is 11 or 10, or into [0.25, 0.5) if it is 01
+        result = ARM_ESTIMATE_U32(armRSqrtEstimateTable[ARM_RSQRT_INDEX_U32(op)]);
 
-        if (op & 0x80000000) {
-            // operand<31:30> = 11 or 10
-            fraction = op & 0x7fffffff;
-            scaled.u = (0x3feULL << 52) | (fraction << 21);
-        } else {
-            // operand<31:30> = 01
-            fraction = op & 0x3fffffff;
-            scaled.u = (0x3fdULL << 52) | (fraction << 22);
-        }
+    }
+
+    return result;
+}
 
-        estimate.f = recipSqrtEstimate(scaled.f);
-        fraction   = (estimate.u >> 21);
-        result     = fraction | 0x80000000;
 
+////////////////////////////////////////////////////////////////////////////////
+// WHOLE-REGISTER OPERATIONS
+////////////////////////////////////////////////////////////////////////////////
+
+//
+// Define a function applying the single-precision operation _FN to the first
+// lanes 32-bit lanes of the SIMD registers from Dm, writing the results to
+// the registers from Dd (lanes is 2 for D and 4 for Q registers). Operands
+// are copied first, so Dd may overlap Dm.
+//
+#define ARM_FP_OP_N(_NAME, _FN)                                 \
+    void _NAME(armP arm, Uns32 rd, Uns32 rm, Uns32 lanes) {     \
+        Uns32 op[4];                                            \
+        Uns32 i;                                                \
+        memcpy(op, &arm->vregs.w[rm*2], lanes*sizeof(Uns32));   \
+        for(i=0; i<lanes; i++) {                                \
+            arm->vregs.w[rd*2+i] = _FN(arm, op[i]);             \
+        }                                                       \
     }
 
-    return result;
+ARM_FP_OP_N(armFPRecipEstimateN,         armFPRecipEstimate)
+ARM_FP_OP_N(armFPUnsignedRecipEstimateN, armFPUnsignedRecipEstimate)
+ARM_FP_OP_N(armFPRSqrtEstimateN,         armFPRSqrtEstimate)
+ARM_FP_OP_N(armFPUnsignedRsqrtEstimateN, armFPUnsignedRsqrtEstimate)
+
+//
+// Convert the first lanes halfwords of SIMD register Dm to single-precision
+// in the registers from Dd (lanes is 4). Dd may overlap Dm.
+//
+void armFPHalfToSingleN(armP arm, Uns32 rd, Uns32 rm, Uns32 lanes) {
+
+    Uns16 op[4];
+    Uns32 i;
+
+    memcpy(op, &arm->vregs.h[rm*4], lanes*sizeof(Uns16));
+
+    for(i=0; i<lanes; i++) {
+        arm->vregs.w[rd*2+i] = armFPHalfToSingle(arm, op[i]);
+    }
 }
 
 
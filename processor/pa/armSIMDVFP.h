@@ -117,6 +117,36 @@ Uns32 armFPRSqrtEstimate(armP arm, Uns32 op);
 //
 Uns32 armFPUnsignedRsqrtEstimate(armP arm, Uns32 op);
 
+//
+// Do reciprocal estimates of each 32-bit lane of SIMD registers from Dm,
+// writing registers from Dd
+//
+void armFPRecipEstimateN(armP arm, Uns32 rd, Uns32 rm, Uns32 lanes);
+
+//
+// Do unsigned reciprocal estimates of each 32-bit lane of SIMD registers from
+// Dm, writing registers from Dd
+//
+void armFPUnsignedRecipEstimateN(armP arm, Uns32 rd, Uns32 rm, Uns32 lanes);
+
+//
+// Do reciprocal square root estimates of each 32-bit lane of SIMD registers
+// from Dm, writing registers from Dd
+//
+void armFPRSqrtEstimateN(armP arm, Uns32 rd, Uns32 rm, Uns32 lanes);
+
+//
+// Do unsigned reciprocal square root estimates of each 32-bit lane of SIMD
+// registers from Dm, writing registers from Dd
+//
+void armFPUnsignedRsqrtEstimateN(armP arm, Uns32 rd, Uns32 rm, Uns32 lanes);
+
+//
+// Convert halfwords of SIMD register Dm from half-precision to
+// single-precision, writing registers from Dd
+//
+void armFPHalfToSingleN(armP arm, Uns32 rd, Uns32 rm, Uns32 lanes);
+
 //
 // Return True if the single-rrecision floating point values op1 and op2 are 0
 // and infinity (in either order), setting the denormal sticky bit if so
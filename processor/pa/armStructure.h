@@ -219,6 +219,12 @@ typedef struct protRegionS *protRegionP;
 // opaque type for TLB structure
 typedef struct armTLBS *armTLBP;
 
+// opaque type for page table walk cache structure
+typedef struct armWalkCacheS *armWalkCacheP;
+
+// opaque type for decoded instruction cache structure
+typedef struct armDecodeCacheS *armDecodeCacheP;
+
 // opaque type for DMA unit structure
 typedef struct armDMAUnitS *armDMAUnitP;
 
@@ -270,6 +276,7 @@ typedef struct armS {
     Uns8           disable;             // reason for disable
     Uns8           event;               // event register
     armP           parent;              // parent (in multiprocessor cluster)
+    armDecodeCacheP decodeCache;        // cache of decoded instructions
     Uns32          teeNZMask      :16;  // mask of registers already zero-checked
     armMode        mode           : 8;  // current processor mode
     armException   exception      : 8;  // current processor exception
@@ -320,6 +327,9 @@ typedef struct armS {
     armCompatMode  compatMode     :2;   // compatibility mode
     Bool           showHiddenRegs :1;   // show hidden registers in reg dump
     Bool           UAL            :1;   // disassemble using UAL syntax
+    Bool           staticDecode   :1;   // use build-time generated decoders?
+    Bool           checkDecode    :1;   // check them against decode tables?
+    Bool           wideSIMD       :1;   // whole-register SIMD integer operations?
     Bool           useARMv5FSR    :1;   // use ARMv5-format FSR?
     Bool           useARMv5TTBR   :1;   // use ARMv5-format TTBR?
     Bool           useARMv5PAC    :1;   // use ARMv5-format PAC registers?
@@ -341,6 +351,7 @@ typedef struct armS {
         armTLBP     dtlb;               // data TLB (if not unified)
         protRegionP dmpu;               // data MPU (if not unified)
     };
+    armWalkCacheP  walkCache;           // page table walk cache (MMU only)
     armDomainSet   ids;                 // instruction domain set
     armDomainSet   dds;                 // data domain set
     Uns8           pids[APS_LAST];      // assumed PID for each domain set
@@ -364,6 +375,7 @@ typedef struct armS {
 
     // MURAC IRQ
     Uns32          brarch;
+    Uns32          muracMailbox;        // BAA mailbox of this core
 
     // PORT LIST
     armNetPortP    firstPort;           // first port in port list
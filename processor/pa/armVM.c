@@ -110,8 +110,17 @@ typedef struct tlbEntryS {
         vmiRangeEntryP    lutEntry; // equivalent range entry
     };
 
+    // ASID list links (non-global entries in the range LUT only)
+    struct tlbEntryS *nextASID;     // next entry with the same ASID
+    struct tlbEntryS *prevASID;     // previous entry with the same ASID
+
 } tlbEntry, *tlbEntryP;
 
+//
+// Number of distinct ASID values
+//
+#define ARM_ASID_NUM 256
+
 //
 // Structure representing a TLB
 //
@@ -123,6 +132,9 @@ typedef struct armTLBS {
     // list of free TLB entries available for reuse
     tlbEntryP      free;
 
+    // lists of non-global entries in the range LUT, indexed by ASID
+    tlbEntryP      asidEntries[ARM_ASID_NUM];
+
     // TLBLockdown support
     Uns32          ldSize;
     Uns32          ldEntryBits;
@@ -1573,6 +1585,181 @@ static Uns32 getMMUEntryFineV5(
     }
 }
 
+
+////////////////////////////////////////////////////////////////////////////////
+// PAGE TABLE WALK CACHE
+////////////////////////////////////////////////////////////////////////////////
+
+//
+// Number of level 1 descriptors held in the walk cache (a power of 2)
+//
+#define WALK_CACHE_SIZE 256
+
+//
+// Structure representing a cached level 1 descriptor. Entries are found by
+// descriptor address, which is derived from the TTBR used for the walk, so
+// they survive TTBR switches. They are tagged with the ASID of the walk for
+// ASID-based invalidation.
+//
+typedef struct walkEntryS {
+    Uns32 level1Address;        // address of the level 1 descriptor
+    Uns32 desc;                 // level 1 descriptor value
+    Uns16 section;              // MVA bits 31:20, for invalidation by MVA
+    Uns8  ASID;                 // ASID of the walk
+    Bool  super;                // descriptor is a supersection (16 sections)
+    Bool  valid;                // is the entry valid?
+} walkEntry, *walkEntryP;
+
+//
+// Structure representing the walk cache
+//
+typedef struct armWalkCacheS {
+    walkEntry entries[WALK_CACHE_SIZE];
+    Uns64     hits;             // level 1 reads satisfied by the cache
+    Uns64     misses;           // level 1 reads from the translation table
+    Uns64     invalidated;      // entries removed by TLB maintenance
+} armWalkCache;
+
+//
+// Return the walk cache slot for a level 1 descriptor address and ASID
+//
+inline static walkEntryP getWalkEntry(
+    armWalkCacheP wc,
+    Uns32         level1Address,
+    Uns8          ASID
+) {
+    Uns32 index = (level1Address>>2) ^ (ASID*0x9d);
+
+    return &wc->entries[index & (WALK_CACHE_SIZE-1)];
+}
+
+//
+// Return the level 1 descriptor at the passed address, from the walk cache if
+// possible. Fault descriptors are never cached, as they need no TLB
+// maintenance when they are made valid.
+//
+static Uns32 readLevel1Desc(
+    armP       arm,
+    memDomainP memDomain,
+    Uns32      level1Address,
+    Uns32      MVA
+) {
+    armWalkCacheP wc   = arm->walkCache;
+    Uns8          ASID = getASID(arm);
+    walkEntryP    we   = getWalkEntry(wc, level1Address, ASID);
+
+    if(we->valid && (we->level1Address==level1Address) && (we->ASID==ASID)) {
+        wc->hits++;
+        return we->desc;
+    }
+
+    level1Desc l1Desc = {transTableRead(arm, memDomain, level1Address)};
+    Uns32      type   = l1Desc.fault.type;
+
+    wc->misses++;
+
+    if((type==1) || (type==2) || ((type==3) && supportFine(arm))) {
+
+        // a supersection descriptor is repeated for all 16 sections it maps,
+        // so tag it with the first section of the group
+        Bool super = (type==2) && (l1Desc.raw & (1<<18));
+
+        we->level1Address = level1Address;
+        we->desc          = l1Desc.raw;
+        we->section       = super ? ((MVA>>20) & ~0xf) : (MVA>>20);
+        we->ASID          = ASID;
+        we->super         = super;
+        we->valid         = True;
+    }
+
+    return l1Desc.raw;
+}
+
+//
+// Invalidate walk cache entries for MVA (or all MVAs if allMVA), and ASID (or
+// all ASIDs if allASID). A supersection entry matches any MVA in its 16 MB
+// group, as it may be cached from the descriptor of any section in the group.
+//
+static void invalidateWalkCache(
+    armP  arm,
+    Uns32 MVA,
+    Bool  allMVA,
+    Uns8  ASID,
+    Bool  allASID
+) {
+    armWalkCacheP wc      = arm->walkCache;
+    Uns16         section = MVA>>20;
+    Uns32         i;
+
+    if(wc) {
+
+        for(i=0; i<WALK_CACHE_SIZE; i++) {
+
+            walkEntryP we = &wc->entries[i];
+
+            if(
+                we->valid &&
+                (allMVA  || (we->section==(we->super ? (section & ~0xf) : section))) &&
+                (allASID || (we->ASID==ASID))
+            ) {
+                we->valid = False;
+                wc->invalidated++;
+            }
+        }
+    }
+}
+
+//
+// Allocate the walk cache for the passed processor
+//
+static void newWalkCache(armP arm) {
+    arm->walkCache = STYPE_CALLOC(armWalkCache);
+}
+
+//
+// Free the walk cache for the passed processor
+//
+static void freeWalkCache(armP arm) {
+
+    armWalkCacheP wc = arm->walkCache;
+
+    if(wc) {
+
+        // report walk cache activity in verbose mode
+        if(arm->verbose && (wc->hits || wc->misses)) {
+            vmiMessage("I", CPU_PREFIX"_WCS",
+                "page table walk cache: "FMT_64u" hits, "FMT_64u" misses, "
+                FMT_64u" invalidated",
+                wc->hits, wc->misses, wc->invalidated
+            );
+        }
+
+        STYPE_FREE(wc);
+        arm->walkCache = 0;
+    }
+}
+
+//
+// Dump walk cache counters
+//
+static void dumpWalkCache(armP arm) {
+
+    armWalkCacheP wc = arm->walkCache;
+
+    if(wc) {
+
+        Uns64 reads = wc->hits + wc->misses;
+
+        vmiPrintf(
+            "PAGE TABLE WALK CACHE: "FMT_64u" hits, "FMT_64u" misses "
+            "(%.1f%% hit rate), "FMT_64u" invalidated\n",
+            wc->hits, wc->misses,
+            reads ? 100.0*wc->hits/reads : 0.0,
+            wc->invalidated
+        );
+    }
+}
+
 //
 // Look up and TLB entry for the passed address and fill byref argument 'entry'
 // with the details.
@@ -1581,7 +1768,9 @@ static Uns32 tlbLookup(armP arm, tlbEntryP entry) {
 
     memDomainP memDomain     = getDomainSetD(arm)->external;
     Uns32      level1Address = getLevel1Address(arm, entry->lowVA);
-    level1Desc l1Desc        = {transTableRead(arm, memDomain, level1Address)};
+    level1Desc l1Desc        = {
+        readLevel1Desc(arm, memDomain, level1Address, entry->lowVA)
+    };
 
     switch(l1Desc.fault.type) {
 
@@ -1846,6 +2035,48 @@ static void deleteTLBEntryMappings(
     }
 }
 
+//
+// Add a non-global TLB entry to the list for its ASID
+//
+static void linkTLBEntryASID(armTLBP tlb, tlbEntryP entry) {
+
+    if(!entry->G) {
+
+        tlbEntryP *head = &tlb->asidEntries[entry->ASID];
+
+        entry->prevASID = 0;
+        entry->nextASID = *head;
+
+        if(*head) {
+            (*head)->prevASID = entry;
+        }
+
+        *head = entry;
+    }
+}
+
+//
+// Remove a non-global TLB entry from the list for its ASID
+//
+static void unlinkTLBEntryASID(armTLBP tlb, tlbEntryP entry) {
+
+    if(!entry->G) {
+
+        if(entry->prevASID) {
+            entry->prevASID->nextASID = entry->nextASID;
+        } else {
+            tlb->asidEntries[entry->ASID] = entry->nextASID;
+        }
+
+        if(entry->nextASID) {
+            entry->nextASID->prevASID = entry->prevASID;
+        }
+
+        entry->nextASID = 0;
+        entry->prevASID = 0;
+    }
+}
+
 //
 // Delete a TLB entry
 //
@@ -1894,9 +2125,10 @@ static void deleteTLBEntry(armP arm, armTLBP tlb, tlbEntryP entry) {
                 dumpTLBEntry(entry);
             }
 
-            // remove the TLB entry from the range LUT
+            // remove the TLB entry from the range LUT and its ASID list
             vmirtRemoveRangeEntry(&tlb->lut, entry->lutEntry);
             entry->lutEntry = 0;
+            unlinkTLBEntryASID(tlb, entry);
 
             // add the TLB entry to the free list
             entry->nextFree = tlb->free;
@@ -2037,10 +2269,31 @@ static void invalidateTLBEntriesRange(
     matchMode mode,
     Uns8      ASID
 ) {
-    ITER_TLB_ENTRY_RANGE(
-        tlb, lowVA, highVA, entry,
-        deleteTLBEntryMode(arm, tlb, entry, mode, ASID)
-    );
+    if((mode==MM_ASID) && !lowVA && (highVA==ARM_MAX_ADDR)) {
+
+        // all non-global entries with this ASID: only the lockdown entries
+        // and the ASID list need be visited, not the whole range LUT
+        tlbEntryP entry;
+        Uns32     i;
+
+        for(i=0; i<tlb->ldSize; i++) {
+            if(tlb->ldEntries[i].LDV) {
+                deleteTLBEntryMode(arm, tlb, tlb->ldEntries+i, mode, ASID);
+            }
+        }
+
+        // deleting an entry removes it from the head of the list
+        while((entry=tlb->asidEntries[ASID])) {
+            deleteTLBEntry(arm, tlb, entry);
+        }
+
+    } else {
+
+        ITER_TLB_ENTRY_RANGE(
+            tlb, lowVA, highVA, entry,
+            deleteTLBEntryMode(arm, tlb, entry, mode, ASID)
+        );
+    }
 }
 
 //
@@ -2206,6 +2459,9 @@ static void insertTLBEntry(armP arm, armTLBP tlb, tlbEntryP entry) {
         entry->lutEntry = vmirtInsertRangeEntry(
             &tlb->lut, entry->lowVA, entry->highVA, (Uns32)entry
         );
+
+        // add entry to the list for its ASID for fast invalidation by ASID
+        linkTLBEntryASID(tlb, entry);
     }
 }
 
@@ -2789,6 +3045,9 @@ static void newTLBs(armP arm) {
     if(!TLB_UNIFIED(arm)) {
         arm->itlb = newTLB(TLDI_SIZE(arm));
     }
+
+    // create the page table walk cache shared by both TLBs
+    newWalkCache(arm);
 }
 
 //
@@ -2811,6 +3070,9 @@ static void freeTLBs(armP arm) {
     if(!TLB_UNIFIED(arm)) {
         freeTLB(arm, getITLB(arm));
     }
+
+    // free the page table walk cache
+    freeWalkCache(arm);
 }
 
 
@@ -3768,7 +4030,8 @@ static Bool addressInTCM(
     armDMAUnitP unit,
     Uns32       address,
     memRegionPP cachedRegion,
-    memPriv     priv
+    memPriv     priv,
+    Bool        complete
 ) {
     memPriv       privTCM       = unit->DMAControl.TR ? MEM_PRIV_X : MEM_PRIV_R;
     armDomainSetP set           = getDomainSetPriv(arm, privTCM);
@@ -3780,7 +4043,7 @@ static Bool addressInTCM(
 
     // no currently-established mapping: try establishing the mapping
     if(!physicalDomain) {
-        armVMMiss(arm, priv, address, 1, True);
+        armVMMiss(arm, priv, address, 1, complete);
         vmirtMapVAToPA(virtualDomain, address, &physicalDomain, cachedRegion);
     }
 
@@ -3803,7 +4066,7 @@ static Bool validateAddressDMA(
 ) {
     memDomainP virtualDomain = getVirtualDataDomain(arm);
     Bool       isExternal    = unit->isExternal;
-    Bool       inTCM         = addressInTCM(arm, unit, address, cachedRegion, priv);
+    Bool       inTCM         = addressInTCM(arm, unit, address, cachedRegion, priv, True);
 
     if(!(vmirtGetDomainPrivileges(virtualDomain, address) & priv)) {
 
@@ -3825,6 +4088,101 @@ static Bool validateAddressDMA(
     }
 }
 
+//
+// Largest run of a DMA transfer moved as a block. This is the smallest MMU page
+// size, so an MMU mapping found at the start of an aligned run covers all of it
+//
+#define DMA_RUN_BYTES 1024
+
+//
+// Return the number of bytes from the passed address to the end of its run
+//
+inline static Uns32 getRunRemainder(Uns32 address) {
+    return DMA_RUN_BYTES - (address & (DMA_RUN_BYTES-1));
+}
+
+//
+// Can the run of the passed size at the passed address be transferred as a
+// block? This is a probe with no side effects: any fault or invalid address
+// is left to the element-by-element transfer to report.
+//
+static Bool validateRunDMA(
+    armP        arm,
+    armDMAUnitP unit,
+    Uns32       address,
+    Uns32       bytes,
+    memPriv     priv
+) {
+    memDomainP virtualDomain = getVirtualDataDomain(arm);
+    Uns32      lastAddress   = address + bytes - 1;
+    memRegionP region        = 0;
+
+    return (
+        (addressInTCM(arm, unit, address, &region, priv, False) != unit->isExternal) &&
+        (vmirtGetDomainPrivileges(virtualDomain, address) & priv)                    &&
+        (vmirtGetDomainPrivileges(virtualDomain, lastAddress) & priv)
+    );
+}
+
+//
+// Try to do the next run of the DMA transfer as a block, within one run on
+// both sides. Returns False if the next element must be transferred on its
+// own, either because there is no contiguous run or the run is not valid.
+//
+static Bool doRunDMA(armP arm, armDMAUnitP unit, memDomainP domain) {
+
+    Bool  DT      = unit->DMAControl.DT;
+    Uns32 TS      = getTransactionSize(unit);
+    Uns32 intAddr = unit->internalStart;
+    Uns32 extAddr = unit->externalStart;
+    Uns32 srcAddr = DT ? intAddr : extAddr;
+    Uns32 dstAddr = DT ? extAddr : intAddr;
+    Uns32 bytes   = unit->internalEnd - intAddr;
+    Uns8  buffer[DMA_RUN_BYTES];
+
+    // only contiguous transfers on an MMU (or with no MMU or MPU) are done in
+    // runs, MPU regions can be smaller than a run
+    if((unit->DMAControl.ST!=TS) || MPU_PRESENT(arm)) {
+        return False;
+    }
+
+    // limit the run to the current run of both source and destination
+    if(bytes>getRunRemainder(srcAddr)) {
+        bytes = getRunRemainder(srcAddr);
+    }
+    if(bytes>getRunRemainder(dstAddr)) {
+        bytes = getRunRemainder(dstAddr);
+    }
+
+    // a single element is transferred on its own
+    if(bytes<=TS) {
+        return False;
+    }
+
+    // validate the source run
+    unit->isExternal = !DT;
+    if(!validateRunDMA(arm, unit, srcAddr, bytes, MEM_PRIV_R)) {
+        return False;
+    }
+
+    // validate the destination run
+    unit->isExternal = DT;
+    if(!validateRunDMA(arm, unit, dstAddr, bytes, MEM_PRIV_W)) {
+        return False;
+    }
+
+    // elements are little endian in both source and destination, so the run
+    // is a copy of bytes
+    vmirtReadNByteDomain(domain, srcAddr, buffer, bytes, 0, True);
+    vmirtWriteNByteDomain(domain, dstAddr, buffer, bytes, 0, True);
+
+    // move past the run
+    unit->internalStart = intAddr + bytes;
+    unit->externalStart = extAddr + bytes;
+
+    return True;
+}
+
 //
 // Do DMA transfer using the passed unit
 //
@@ -3863,6 +4221,11 @@ static void doDMA(armP arm, armDMAUnitP unit) {
         // do each iteration
         while(unit->internalStart<unit->internalEnd) {
 
+            // transfer the next run as a block if possible
+            if(doRunDMA(arm, unit, domain)) {
+                continue;
+            }
+
             memEndian endian  = MEM_ENDIAN_LITTLE;
             Uns32     intAddr = unit->internalStart;
             Uns32     extAddr = unit->externalStart;
@@ -4071,6 +4434,7 @@ void armVMTranslateVAtoPA(armP arm, Uns32 VA, Bool isUser, memPriv priv) {
 //
 void armVMInvalidate(armP arm, memPriv priv) {
     invalidateRange(arm, priv, 0, ARM_MAX_ADDR, MM_ANY_UNLOCKED, 0);
+    invalidateWalkCache(arm, 0, True, 0, True);
 }
 
 //
@@ -4078,6 +4442,7 @@ void armVMInvalidate(armP arm, memPriv priv) {
 //
 void armVMInvalidateEntryMVA(armP arm, Uns32 MVA, Uns32 ASID, memPriv priv) {
     invalidateRange(arm, priv, MVA, MVA, MM_ASID_GLOBAL, ASID);
+    invalidateWalkCache(arm, MVA, False, 0, True);
 }
 
 //
@@ -4085,6 +4450,7 @@ void armVMInvalidateEntryMVA(armP arm, Uns32 MVA, Uns32 ASID, memPriv priv) {
 //
 void armVMInvalidateEntryASID(armP arm, Uns32 ASID, memPriv priv) {
     invalidateRange(arm, priv, 0, ARM_MAX_ADDR, MM_ASID, ASID);
+    invalidateWalkCache(arm, 0, True, ASID, False);
 }
 
 //
@@ -4092,6 +4458,15 @@ void armVMInvalidateEntryASID(armP arm, Uns32 ASID, memPriv priv) {
 //
 void armVMInvalidateEntryMVAA(armP arm, Uns32 MVA, memPriv priv) {
     invalidateRange(arm, priv, MVA, MVA, MM_ANY_UNLOCKED, 0);
+    invalidateWalkCache(arm, MVA, False, 0, True);
+}
+
+//
+// Invalidate the page table walk cache when the translation table layout or
+// endianness changes
+//
+void armVMInvalidateWalkCache(armP arm) {
+    invalidateWalkCache(arm, 0, True, 0, True);
 }
 
 //
@@ -4693,6 +5068,8 @@ void armVMDumpTLB(armP arm) {
     if(!TLB_UNIFIED(arm)) {
         dumpTLB(arm, getDTLB(arm));
     }
+
+    dumpWalkCache(arm);
 }
 
 //
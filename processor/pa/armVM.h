@@ -93,6 +93,11 @@ void armVMInvalidateEntryASID(armP arm, Uns32 ASID, memPriv priv);
 //
 void armVMInvalidateEntryMVAA(armP arm, Uns32 MVA, memPriv priv);
 
+//
+// Invalidate the page table walk cache
+//
+void armVMInvalidateWalkCache(armP arm);
+
 //
 // Perform any required memory mapping updates on a PID or mode switch
 //
@@ -55,4 +55,59 @@ class murac_arm : public icmCpu
 
 }; /* class arm */
 
+#define MURAC_ARM_MAX_CPUS 4
+
+//
+// MPCore cluster variant (Cortex-A9MPxN); per-CPU nets are named
+// <net>_CPU<index> by the processor model
+//
+class murac_arm_mp : public icmCpu
+{
+  private:
+    const char *getModel() {
+        return icmGetVlnvString (NULL, "arm.ovpworld.org", "processor", "arm", "1.0", "model");
+    }
+
+    const char *getSHL() {
+        return icmGetVlnvString (NULL, 0, 0, "armNewlib", 0, "model");
+    }
+
+    char netNames[MURAC_ARM_MAX_CPUS][3][16];
+
+    const char *cpuNet(unsigned int cpu, unsigned int net, const char *name) {
+        sprintf(netNames[cpu][net], "%s_CPU%u", name, cpu);
+        return netNames[cpu][net];
+    }
+
+  public:
+    icmCpuMasterPort     INSTRUCTION;
+    icmCpuMasterPort     DATA;
+    icmCpuInterrupt     *fiq[MURAC_ARM_MAX_CPUS];
+    icmCpuInterrupt     *irq[MURAC_ARM_MAX_CPUS];
+    icmCpuOutputNetPort *brarch[MURAC_ARM_MAX_CPUS];
+    const unsigned int   numCPUs;
+
+    murac_arm_mp(
+        sc_module_name        name,
+        const unsigned int    ID,
+        const unsigned int    cpus,
+        const char           *model_file,
+        icmNewProcAttrs       attrs    = ICM_ATTR_DEFAULT,
+        icmAttrListObject    *attrList = NULL,
+        const char           *semiHost = NULL
+     )
+    : icmCpu(name, ID, "murac_arm", model_file ? model_file : getModel(), "modelAttrs", semiHost ? semiHost : getSHL(), attrs, attrList)
+    , INSTRUCTION (this, "INSTRUCTION", 32)
+    , DATA (this, "DATA", 32)
+    , numCPUs(cpus > MURAC_ARM_MAX_CPUS ? MURAC_ARM_MAX_CPUS : cpus)
+    {
+        for (unsigned int i = 0; i < numCPUs; i++) {
+            fiq[i]    = new icmCpuInterrupt(cpuNet(i, 0, "fiq"), this);
+            irq[i]    = new icmCpuInterrupt(cpuNet(i, 1, "irq"), this);
+            brarch[i] = new icmCpuOutputNetPort(cpuNet(i, 2, "brarch"), this);
+        }
+    }
+
+}; /* class arm_mp */
+
 #endif
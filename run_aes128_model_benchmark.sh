@@ -0,0 +1,7 @@
+#!/bin/bash
+# Compare the RTL and transaction-level AES models on the streaming example.
+# verify checks the FIPS-197 vectors and every block against both models.
+for MODEL in rtl tlm verify; do
+    echo "===== AES128_MODEL=$MODEL ====="
+    time AES128_MODEL=$MODEL ./murac_sim example/aes128/pa/aes128_stream.ARM7.elf example/aes128/aa/aes_lib.so 2>&1 | grep -E "\[AA\] (AES|FIPS|  )"
+done
@@ -0,0 +1,3 @@
+#!/bin/bash
+# Reports AES blocks per simulated ms and per wall second for ECB, CTR and CBC
+./murac_sim example/aes128/pa/aes128_stream.ARM7.elf example/aes128/aa/aes_lib.so
@@ -0,0 +1,20 @@
+#!/bin/bash
+# Time a PA workload that logs heavily with semihosting writes per printf
+# and with the console buffered in the host, and compare their output.
+ELF=example/console_log/pa/console_log.ARM7.elf
+for MODE in unbuffered buffered; do
+    echo "===== $MODE ====="
+    OPTS=""
+    if [ $MODE = buffered ]; then
+        OPTS=-bufferconsole
+    fi
+    time ./murac_sim $OPTS $ELF > console_log.$MODE.log 2>&1
+    grep -E "clock ticks|MURAC_PA_CONSOLE" console_log.$MODE.log
+done
+if diff <(grep "\[PA\]" console_log.unbuffered.log | grep -v "clock ticks") \
+        <(grep "\[PA\]" console_log.buffered.log | grep -v "clock ticks") > /dev/null; then
+    echo "Console output matches"
+else
+    echo "Console output DIFFERS"
+    exit 1
+fi
@@ -0,0 +1,4 @@
+#!/bin/bash
+# Time MMU table walks under frequent TTBR0/ASID switches on the PA. The
+# page table walk cache counters are reported when the simulation ends.
+time ./murac_sim example/context_switch/pa/context_switch.ARM7.elf 2>&1 | grep -E "\[PA\]|walk cache"
@@ -0,0 +1,3 @@
+#!/bin/bash
+# Time 4 KB to 4 MB DMA transfers through the data TCM of an ARM1136 PA.
+time ./murac_sim -variant ARM1136J-S example/dma_transfer/pa/dma_transfer.ARM7.elf 2>&1 | grep -E "\[PA\]"
@@ -0,0 +1,13 @@
+#!/bin/bash
+# Compare PA throughput of the SystemC TLM platform (murac_sim) and the
+# ICM platform (murac_sim_icm) on the same application.
+# Usage: ./run_icm_benchmark.sh [<pa application> [<aa library>]]
+ELF=${1:-example/matrix_multiply/pa/matrix_multiply.ARM7.elf}
+LIB=${2:-example/matrix_multiply/aa/matrix_multiply_lib.so}
+
+echo "===== murac_sim (SystemC TLM) ====="
+time ./murac_sim $ELF $LIB 2>&1 | grep -i -E "instructions|mips|elapsed|time"
+
+echo "===== murac_sim_icm (ICM) ====="
+time ./murac_sim_icm $ELF $LIB 2>&1 | grep -i -E "instructions|mips|elapsed|time|AA calls"
+
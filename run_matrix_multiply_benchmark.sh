@@ -0,0 +1,18 @@
+#!/bin/bash
+# Compare the SystemC (murac_sim) and PSE (arm_tlm_platform) AA engines on the
+# matrix multiply example. Each reports the modelled cycles and the wall time
+# of the kernel. The SystemC cycle model computes on the modelled MAC array;
+# its fast model and the PSE, through its native kernel library, run the same
+# host kernel natively. Build the PSE platform first with
+#   make MAKEPASS=3 arm_tlm_platform
+ELF=example/matrix_multiply/pa/matrix_multiply.ARM7.elf
+LIB=example/matrix_multiply/aa/matrix_multiply_lib.so
+
+echo "===== SystemC muracAA, cycle model ====="
+./murac_sim $ELF $LIB 2>&1 | grep -E "^\[AA\] [0-9]+x"
+
+echo "===== SystemC muracAA, fast model ====="
+./murac_sim -fidelity matrix_multiply=fast $ELF $LIB 2>&1 | grep -E "^\[AA\] [0-9]+x"
+
+echo "===== PSE muracFPGA, native kernel ====="
+./arm_tlm_platform $ELF 2>&1 | grep -E "^\[AA\] [0-9]+x"
@@ -0,0 +1,3 @@
+#!/bin/bash
+./murac_sim example/matrix_multiply/pa/matrix_multiply.ARM7.elf example/matrix_multiply/aa/matrix_multiply_lib.so
+
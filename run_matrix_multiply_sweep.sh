@@ -0,0 +1,4 @@
+#!/bin/bash
+# PA-only against offloaded matrix multiply, 16x16 up to 1024x1024. Extra
+# arguments go to murac_sim, e.g. -fidelity matrix_multiply=fast
+./murac_sim "$@" example/matrix_multiply/pa/matrix_multiply_sweep.ARM7.elf example/matrix_multiply/aa/matrix_multiply_lib.so
@@ -0,0 +1,3 @@
+#!/bin/bash
+# Every core of a 4-core MPCore PA branches to the shared AA at the same time.
+./murac_sim_mp -cores 4 example/mp_sum/pa/mp_sum.ARM7.elf example/mp_sum/aa/mp_sum_lib.so
@@ -0,0 +1,15 @@
+#!/bin/bash
+# Run the NEON differential test with SIMD operations per element and on
+# whole registers, time both and compare their result signatures.
+ELF=example/neon_diff/pa/neon_diff.ARM7.elf
+for WIDE in 0 1; do
+    echo "wideSIMD=$WIDE"
+    time ./murac_sim -paparam wideSIMD=$WIDE $ELF 2>&1 | grep -E "\[PA\]" > neon_diff.$WIDE.log
+    grep -E "kernel" neon_diff.$WIDE.log
+done
+if diff <(grep -v "kernel time" neon_diff.0.log) <(grep -v "kernel time" neon_diff.1.log); then
+    echo "NEON results match"
+else
+    echo "NEON results DIFFER"
+    exit 1
+fi
@@ -0,0 +1,20 @@
+#!/bin/bash
+# Host speedup of the single-process PE array model over sw_gen_affine.
+# Build with: make -C example/seqalign bench
+BENCH=example/seqalign/bench/seqalign_bench
+RECORDS=${1:-20}
+
+# Value of a key in the RESULT line of a bench run
+result() {
+    echo "$1" | sed -n "s/^RESULT .*\<$2=\([^ ]*\).*/\1/p"
+}
+
+for LENGTH in 4 48 256; do
+    $BENCH check $LENGTH 5 | grep -v "^RESULT"
+    RTL=$($BENCH rtl $LENGTH $RECORDS)
+    ARRAY=$($BENCH array $LENGTH $RECORDS)
+    echo "$RTL" | grep -v "^RESULT"
+    echo "$ARRAY" | grep -v "^RESULT"
+    awk -v pes=$LENGTH -v rtl=$(result "$RTL" wall_s) -v array=$(result "$ARRAY" wall_s) \
+        'BEGIN { printf "LENGTH %d speedup %.1fx\n", pes, (array > 0 ? rtl / array : 0) }'
+done
@@ -0,0 +1,3 @@
+#!/bin/bash
+# Alignments per wall second, one job per call against all jobs in one call
+./murac_sim example/seqalign/pa/seqalign_batch.ARM7.elf example/seqalign/aa/seqalign_lib.so
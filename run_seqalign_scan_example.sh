@@ -0,0 +1,3 @@
+#!/bin/bash
+# Scans a 2 Mbase synthetic database and reports cells per second (CUPS)
+./murac_sim example/seqalign/pa/seqalign_scan.ARM7.elf example/seqalign/aa/seqalign_lib.so
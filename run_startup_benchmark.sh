@@ -0,0 +1,14 @@
+#!/bin/bash
+# Compare PA startup time with the decoders generated at build time and with
+# decode tables built at startup, over several runs of the simple example.
+# Usage: ./run_startup_benchmark.sh [runs]
+RUNS=${1:-10}
+EX="example/simple/pa/simple.ARM7.elf example/simple/aa/simple_lib.so"
+for MODE in "static" "runtime"; do
+    FLAGS=""
+    if [ "$MODE" = "runtime" ]; then
+        FLAGS="-runtimedecode"
+    fi
+    echo "--- $MODE decode, $RUNS runs ---"
+    time (for i in $(seq $RUNS); do ./murac_sim $FLAGS $EX > /dev/null 2>&1; done)
+done
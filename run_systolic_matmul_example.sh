@@ -0,0 +1,3 @@
+#!/bin/bash
+# Array shape and bus width, e.g. SYSTOLIC_ARRAY=32x32 SYSTOLIC_BUS_BYTES=128 ./run_systolic_matmul_example.sh
+./murac_sim example/systolic_matmul/pa/systolic_matmul.ARM7.elf example/systolic_matmul/aa/systolic_matmul_lib.so
@@ -0,0 +1,3 @@
+#!/bin/bash
+# Time a 1 kHz private timer tick on an MPCore PA, idle in WFI and busy.
+time ./murac_sim -variant Cortex-A9MPx1 example/timer_tick/pa/timer_tick.ARM7.elf 2>&1 | grep -E "\[PA\]"
@@ -0,0 +1,15 @@
+#!/bin/bash
+# Record a binary trace of the PA instructions in the simple example, and
+# disassemble it offline. OBJDUMP is the objdump of the PA cross toolchain.
+OBJDUMP=${OBJDUMP:-arm-elf-objdump}
+ELF=example/simple/pa/simple.ARM7.elf
+echo "===== untraced ====="
+time ./murac_sim $ELF example/simple/aa/simple_lib.so > /dev/null 2>&1
+echo "===== binary trace ====="
+time ./murac_sim -binarytrace $ELF example/simple/aa/simple_lib.so 2>&1 | grep MURAC_PA_TRACE | tee murac_pa.trace.log
+# The trace file is named after the PA processor, as reported at exit
+TRACE=$(sed -n 's/.* traced to \(.*\) in [0-9]* host writes.*/\1/p' murac_pa.trace.log | head -1)
+$OBJDUMP -d $ELF > murac_pa.lst
+./framework/murac_tracedump ${TRACE:-murac_pa.trace} murac_pa.lst > murac_pa.trace.txt
+tail -1 murac_pa.trace.txt
+grep -B 4 -A 1 " baa " murac_pa.trace.txt | head -20